@@ -21,8 +21,8 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
-#include <float.h>
 
 #include <time.h>
 
@@ -32,117 +32,222 @@
 #include <gsl/gsl_errno.h>
 
 #include "complex_internal.h"
-#include "bitreverse.h"
 #include "urand.c"
 
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "c_pass_2.c"
+#include "c_pass_4.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+/* Reports the time per transform of gsl_fft_complex_forward for each
+   length, together with its factorization.  For powers of two it also
+   reports the time of gsl_fft_complex_radix2_forward and the gain of
+   the mixed-radix transform over it, and the time of the radix-2 and
+   radix-4 passes of the transform with the generic strided passes and
+   with the unit-stride ones, and the gain of the latter.  Each time is
+   the best of several runs.  With an argument n only that length is
+   measured, otherwise a range of lengths up to 2^20 is used. */
+
+typedef struct
+{
+  const gsl_fft_complex_wavetable * cw;
+  gsl_fft_complex_workspace * cwork;
+  int unit;
+}
+params;
+
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
-int
-main (int argc, char *argv[])
+static int mixed_radix (double *data, size_t n, const params * p);
+static int radix2 (double *data, size_t n, const params * p);
+static int passes (double *data, size_t n, const params * p);
+static double best_time (int (*transform) (double *, size_t, const params *),
+                         double *data, size_t n, const params * p);
+static void benchmark (size_t n);
+
+static int
+mixed_radix (double *data, size_t n, const params * p)
 {
-  double *data, *fft_data;
-  gsl_fft_complex_wavetable * cw;
-  unsigned int i, logn;
-  int result;
-  int status;
-  clock_t start, end;
-  int resolution = CLOCKS_PER_SEC;
-  unsigned int n = 1;
+  return gsl_fft_complex_forward (data, 1, n, p->cw, p->cwork);
+}
 
-  gsl_set_error_handler (&my_error_handler);
+static int
+radix2 (double *data, size_t n, const params * p)
+{
+  (void) p;
+  return gsl_fft_complex_radix2_forward (data, 1, n);
+}
 
-  if (argc == 2)
-    {
-      n = strtol (argv[1], NULL, 0);
-    }
-  else
+static int
+passes (double *data, size_t n, const params * p)
+{
+  /* the passes of gsl_fft_complex_forward at stride 1 for a length
+     whose factors are 2 and 4, without the final copy.  The generic
+     passes are given strides which are not known at compile time, as
+     in the library */
+
+  static volatile size_t one = 1;
+  const size_t stride = one;
+  double *in = data, *out = p->cwork->scratch, *tmp;
+  size_t i, product = 1;
+
+  for (i = 0; i < p->cw->nf; i++)
     {
-      printf ("test n\n");
-      exit (EXIT_FAILURE);
+      const size_t factor = p->cw->factor[i];
+      const gsl_complex *twiddle1 = p->cw->twiddle[i];
+      size_t q;
+
+      product *= factor;
+      q = n / product;
+
+      if (factor == 2 && p->unit)
+        fft_complex_pass_2_unit (in, out, gsl_fft_forward, product, n,
+                                 twiddle1);
+      else if (factor == 2)
+        fft_complex_pass_2 (in, stride, out, stride, gsl_fft_forward,
+                            product, n, twiddle1);
+      else if (p->unit)
+        fft_complex_pass_4_unit (in, out, gsl_fft_forward, product, n,
+                                 twiddle1, twiddle1 + q, twiddle1 + 2 * q);
+      else
+        fft_complex_pass_4 (in, stride, out, stride, gsl_fft_forward,
+                            product, n, twiddle1, twiddle1 + q,
+                            twiddle1 + 2 * q);
+
+      tmp = in;
+      in = out;
+      out = tmp;
     }
 
-  cw = gsl_fft_complex_wavetable_alloc (n);
-  cwork = gsl_fft_complex_wavetable_workspace_alloc (n);
-  status = gsl_fft_complex_init (n, cw, cwork);
-  status = gsl_fft_complex_generate (n, cw, cwork);
+  return 0;
+}
 
-  data = (double *) malloc (n * 2 * sizeof (double));
-  fft_data = (double *) malloc (n * 2 * sizeof (double));
+static double
+best_time (int (*transform) (double *, size_t, const params *),
+           double *data, size_t n, const params * p)
+{
+  const clock_t resolution = CLOCKS_PER_SEC / 10;
+  double best = 0.0;
+  size_t run;
 
-  for (i = 0; i < n; i++)
+  for (run = 0; run < 5; run++)
     {
-      REAL(data,1,i) = urand ();
-      IMAG(data,1,i) = urand ();
+      clock_t start, end;
+      size_t i = 0;
+      int status;
+      double t;
+
+      start = clock ();
+
+      do
+        {
+          status = transform (data, n, p);
+          i++;
+          end = clock ();
+        }
+      while (end < start + resolution && status == 0);
+
+      t = (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC);
+
+      if (run == 0 || t < best)
+        best = t;
     }
 
+  return best;
+}
 
-  /* compute the fft */
+static void
+benchmark (size_t n)
+{
+  gsl_fft_complex_wavetable * cw = gsl_fft_complex_wavetable_alloc (n);
+  gsl_fft_complex_workspace * cwork = gsl_fft_complex_workspace_alloc (n);
+  double *data = (double *) malloc (2 * n * sizeof (double));
+  char factors[128] = "";
+  params p;
+  double t_mr;
+  size_t i;
 
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+  p.cw = cw;
+  p.cwork = cwork;
+  p.unit = 0;
 
-  start = clock ();
-  i = 0;
-  do
+  for (i = 0; i < n; i++)
     {
-      status = gsl_fft_complex_forward (fft_data, 1, n, cw, cwork);
-      i++;
-      end = clock ();
+      REAL(data,1,i) = urand ();
+      IMAG(data,1,i) = urand ();
     }
-  while (end < start + resolution && status == 0);
 
-  if (status == 0)
+  if (cw->nb)
     {
-      printf ("n = %d gsl_fft_complex_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      /* the factors in the wavetable are those of the padded length */
+      sprintf (factors, "bluestein(%lu)", (unsigned long) cw->nb);
     }
   else
     {
-      printf ("MR fft failed\n");
+      for (i = 0; i < cw->nf; i++)
+        {
+          char f[32];
+          sprintf (f, i ? "*%lu" : "%lu", (unsigned long) cw->factor[i]);
+          strncat (factors, f, sizeof (factors) - strlen (factors) - 1);
+        }
     }
 
+  t_mr = best_time (&mixed_radix, data, n, &p);
 
-  /* compute the fft with radix2 */
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+  printf ("%8lu %-24s %12.3f", (unsigned long) n, factors, 1e6 * t_mr);
 
-  result = fft_binary_logn(n) ;
+  if ((n & (n - 1)) == 0)
+    {
+      double t_r2 = best_time (&radix2, data, n, &p);
+      double t_generic, t_unit;
 
-  if (result == -1) {
-    exit(EXIT_SUCCESS) ;
-  } else {
-    logn = result ;
-  }
+      p.unit = 0;
+      t_generic = best_time (&passes, data, n, &p);
+      p.unit = 1;
+      t_unit = best_time (&passes, data, n, &p);
 
-  start = clock ();
-  i = 0;
-  do
-    {
-      status = gsl_fft_complex_radix2_forward (fft_data, 1, n);
-      i++;
-      end = clock ();
+      printf (" %12.3f %8.2f %12.3f %12.3f %8.2f", 1e6 * t_r2, t_r2 / t_mr,
+              1e6 * t_generic, 1e6 * t_unit, t_generic / t_unit);
     }
-  while (end < start + resolution && status == 0);
 
-  if (status == 0)
+  printf ("\n");
+
+  gsl_fft_complex_wavetable_free (cw);
+  gsl_fft_complex_workspace_free (cwork);
+  free (data);
+}
+
+int
+main (int argc, char *argv[])
+{
+  gsl_set_error_handler (&my_error_handler);
+
+  printf ("%8s %-24s %12s %12s %8s %12s %12s %8s\n", "n", "factors",
+          "mixed (us)", "radix2 (us)", "gain", "strided (us)", "unit (us)",
+          "gain");
+
+  if (argc == 2)
     {
-      printf ("n = %d gsl_fft_complex_radix2_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      benchmark (strtoul (argv[1], NULL, 0));
     }
   else
     {
-      printf ("fft_radix2: not a power of 2\n");
-    }
-
-  start = clock ();
-  i = 0;
-  do
-    {
-      status = fft_complex_bitreverse_order (fft_data, 1, n, logn);
-      i++;
-      end = clock ();
-    }
-  while (end < start + resolution && status == 0);
+      size_t n;
 
-  printf ("n = %d gsl_fft_complex_bitreverse_order %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      for (n = 8; n <= (1 << 20); n *= 2)
+        {
+          benchmark (n);
+        }
 
+      for (n = 10; n <= 100000; n *= 10)
+        {
+          benchmark (n);
+          benchmark (3 * n);
+        }
+    }
 
   return 0;
 }
@@ -0,0 +1,225 @@
+/* fft/c_bluestein.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Bluestein's algorithm computes a transform of length n with a prime
+   factor p too large for the O(p^2) generic pass.  Writing
+   jk = (j^2 + k^2 - (k-j)^2)/2 turns the transform into a convolution,
+
+     x_k = c_k sum_j (z_j c_j) conj(c_(k-j)),   c_j = exp(-i pi j^2/n),
+
+   which is evaluated with mixed-radix transforms of a power of 2 length
+   nb >= 2n-1.  The wavetable holds the factors and trigonometric table
+   for length nb, the chirp c_j and the forward transform of conj(c_j),
+   wrapped to length nb and scaled by 1/nb.  The backward transform uses
+   the complex conjugates of both tables. */
+
+static int
+FUNCTION(fft_complex,bluestein_init) (TYPE(gsl_fft_complex_wavetable) * wavetable)
+{
+  const size_t n = wavetable->n;
+  const size_t nb = wavetable->nb;
+  const double scale = 1.0 / (double) nb;
+  size_t k, m = 0;
+  BASE *scratch;
+
+  wavetable->chirp = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
+  wavetable->kernel = (TYPE(gsl_complex) *) malloc (nb * sizeof (TYPE(gsl_complex)));
+  scratch = (BASE *) malloc (2 * nb * sizeof (BASE));
+
+  if (wavetable->chirp == NULL || wavetable->kernel == NULL || scratch == NULL)
+    {
+      free (scratch);
+      GSL_ERROR ("failed to allocate Bluestein tables", GSL_ENOMEM);
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      /* m = k^2 mod 2n, keeping the argument of exp small */
+
+      const double theta = -M_PI * (double) m / (double) n;
+      GSL_REAL(wavetable->chirp[k]) = cos (theta);
+      GSL_IMAG(wavetable->chirp[k]) = sin (theta);
+      m = (m + 2 * k + 1) % (2 * n);
+    }
+
+  for (k = 0; k < nb; k++)
+    {
+      GSL_REAL(wavetable->kernel[k]) = 0;
+      GSL_IMAG(wavetable->kernel[k]) = 0;
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      const BASE re = scale * GSL_REAL(wavetable->chirp[k]);
+      const BASE im = -scale * GSL_IMAG(wavetable->chirp[k]);
+
+      GSL_REAL(wavetable->kernel[k]) = re;
+      GSL_IMAG(wavetable->kernel[k]) = im;
+
+      if (k > 0)
+        {
+          GSL_REAL(wavetable->kernel[nb - k]) = re;
+          GSL_IMAG(wavetable->kernel[nb - k]) = im;
+        }
+    }
+
+  FUNCTION(fft_complex,mixed_radix) ((BASE *) wavetable->kernel, 1, 1, nb,
+                                     wavetable, scratch, gsl_fft_forward);
+
+  free (scratch);
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_complex,bluestein) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign)
+{
+  /* scratch holds 4 nb elements, the convolution followed by the
+     scratch space of its transforms */
+
+  const size_t nb = wavetable->nb;
+  const TYPE(gsl_complex) * const chirp = wavetable->chirp;
+  const TYPE(gsl_complex) * const kernel = wavetable->kernel;
+  const ATOMIC c = (sign == gsl_fft_forward) ? 1 : -1;
+  BASE * const a = scratch;
+  BASE * const s = scratch + 2 * nb;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      const ATOMIC w_real = GSL_REAL(chirp[k]);
+      const ATOMIC w_imag = c * GSL_IMAG(chirp[k]);
+      const ATOMIC z_real = REAL(data,stride,k);
+      const ATOMIC z_imag = IMAG(data,stride,k);
+      REAL(a,1,k) = z_real * w_real - z_imag * w_imag;
+      IMAG(a,1,k) = z_real * w_imag + z_imag * w_real;
+    }
+
+  for (k = n; k < nb; k++)
+    {
+      REAL(a,1,k) = 0;
+      IMAG(a,1,k) = 0;
+    }
+
+  FUNCTION(fft_complex,mixed_radix) (a, 1, 1, nb, wavetable, s, gsl_fft_forward);
+
+  for (k = 0; k < nb; k++)
+    {
+      const ATOMIC w_real = GSL_REAL(kernel[k]);
+      const ATOMIC w_imag = c * GSL_IMAG(kernel[k]);
+      const ATOMIC z_real = REAL(a,1,k);
+      const ATOMIC z_imag = IMAG(a,1,k);
+      REAL(a,1,k) = z_real * w_real - z_imag * w_imag;
+      IMAG(a,1,k) = z_real * w_imag + z_imag * w_real;
+    }
+
+  FUNCTION(fft_complex,mixed_radix) (a, 1, 1, nb, wavetable, s, gsl_fft_backward);
+
+  for (k = 0; k < n; k++)
+    {
+      const ATOMIC w_real = GSL_REAL(chirp[k]);
+      const ATOMIC w_imag = c * GSL_IMAG(chirp[k]);
+      const ATOMIC z_real = REAL(a,1,k);
+      const ATOMIC z_imag = IMAG(a,1,k);
+      REAL(data,stride,k) = z_real * w_real - z_imag * w_imag;
+      IMAG(data,stride,k) = z_real * w_imag + z_imag * w_real;
+    }
+
+  return 0;
+}
+
+/* The real and halfcomplex transforms of lengths with a large prime
+   factor copy the data to a complex array of length n in the scratch
+   space and use the complex Bluestein transform, which needs a further
+   4 nb elements of scratch after it. */
+
+static int
+FUNCTION(fft_real,bluestein) (BASE data[], const size_t stride, const size_t n,
+                              const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                              BASE scratch[])
+{
+  BASE * const z = scratch;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      REAL(z,1,k) = data[stride * k];
+      IMAG(z,1,k) = 0;
+    }
+
+  FUNCTION(fft_complex,bluestein) (z, 1, n, wavetable, scratch + 2 * n,
+                                   gsl_fft_forward);
+
+  data[0] = REAL(z,1,0);
+
+  for (k = 1; k < n - k; k++)
+    {
+      data[stride * (2 * k - 1)] = REAL(z,1,k);
+      data[stride * 2 * k] = IMAG(z,1,k);
+    }
+
+  if (k == n - k)
+    {
+      data[stride * (n - 1)] = REAL(z,1,k);
+    }
+
+  return 0;
+}
+
+static int
+FUNCTION(fft_halfcomplex,bluestein) (BASE data[], const size_t stride,
+                                     const size_t n,
+                                     const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                     BASE scratch[])
+{
+  BASE * const z = scratch;
+  size_t k;
+
+  REAL(z,1,0) = data[0];
+  IMAG(z,1,0) = 0;
+
+  for (k = 1; k < n - k; k++)
+    {
+      const BASE z_real = data[stride * (2 * k - 1)];
+      const BASE z_imag = data[stride * 2 * k];
+      REAL(z,1,k) = z_real;
+      IMAG(z,1,k) = z_imag;
+      REAL(z,1,n - k) = z_real;
+      IMAG(z,1,n - k) = -z_imag;
+    }
+
+  if (k == n - k)
+    {
+      REAL(z,1,k) = data[stride * (n - 1)];
+      IMAG(z,1,k) = 0;
+    }
+
+  FUNCTION(fft_complex,bluestein) (z, 1, n, wavetable, scratch + 2 * n,
+                                   gsl_fft_backward);
+
+  for (k = 0; k < n; k++)
+    {
+      data[stride * k] = REAL(z,1,k);
+    }
+
+  return 0;
+}
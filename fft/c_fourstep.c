@@ -0,0 +1,179 @@
+/* fft/c_fourstep.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A transform of length n = n1 n2 is computed in four steps, viewing
+   the data as an n1 x n2 array x[n2 j1 + j2],
+
+     1. transforms of length n1 down each column j2,
+     2. multiplication of element k1 of column j2 by w^(j2 k1),
+        w = exp(-+2 pi i/n),
+     3. transforms of length n2 along each row k1 of the result,
+     4. transposition, the result for k1 + n1 k2 being in row k1.
+
+   The columns are gathered FFT_BLOCK at a time, reading FFT_BLOCK
+   consecutive elements from each row, into a block in which they are
+   interleaved element by element, so that the mixed-radix passes
+   transform them together.  They are multiplied by the twiddle
+   factors as they are scattered to a copy of the data in the scratch
+   space, in which each group of FFT_BLOCK rows is likewise stored
+   interleaved.  Each group of rows is then transformed in place and
+   written back to the data in transposed order, which takes FFT_BLOCK
+   consecutive elements from each of its columns.  Each pass reads and
+   writes the whole array once, while the mixed-radix passes stream it
+   through memory once for each factor.
+
+   The twiddle factor w^m, m = j2 k1 < n, is the product of
+   step[m / n2] = w^(n2 (m / n2)) and step[n1 + m % n2] = w^(m % n2),
+   which keeps the table short. */
+
+static int
+FUNCTION(fft_complex,four_step_init) (TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                      const size_t n1)
+{
+  const size_t n = wavetable->n;
+  const size_t n2 = n / n1;
+  const double d_theta = -2.0 * M_PI / ((double) n);
+  size_t i;
+
+  wavetable->columns = FUNCTION(fft_complex_wavetable,alloc_roots) (n1, NULL);
+  wavetable->rows = FUNCTION(fft_complex_wavetable,alloc_roots) (n2, NULL);
+  wavetable->step = (TYPE(gsl_complex) *) malloc ((n1 + n2) * sizeof (TYPE(gsl_complex)));
+
+  if (wavetable->columns == NULL || wavetable->rows == NULL ||
+      wavetable->step == NULL)
+    {
+      GSL_ERROR ("failed to allocate four-step tables", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < n1 + n2; i++)
+    {
+      const size_t m = (i < n1) ? i * n2 : i - n1;
+      const double theta = d_theta * m;
+
+      GSL_REAL(wavetable->step[i]) = cos (theta);
+      GSL_IMAG(wavetable->step[i]) = sin (theta);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_complex,four_step) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign)
+{
+  /* scratch holds the copy y of the data, a block of FFT_BLOCK
+     columns and the scratch space for the transforms of FFT_BLOCK
+     rows.  Element j of row k of group g (rows g..g+ng-1) is element
+     g n2 + ng j + k - g of y. */
+
+  const TYPE(gsl_fft_complex_wavetable) * const columns = wavetable->columns;
+  const TYPE(gsl_fft_complex_wavetable) * const rows = wavetable->rows;
+  const size_t n1 = columns->n;
+  const size_t n2 = rows->n;
+  const TYPE(gsl_complex) * const step_hi = wavetable->step;
+  const TYPE(gsl_complex) * const step_lo = wavetable->step + n1;
+  const ATOMIC c = (sign == gsl_fft_forward) ? 1 : -1;
+  BASE * const y = scratch;
+  BASE * const block = scratch + 2 * n;
+  BASE * const s = block + 2 * FFT_BLOCK * n1;
+  size_t hi[FFT_BLOCK], lo[FFT_BLOCK];
+  size_t i, j, k, g;
+
+  /* steps 1 and 2, columns j..j+nj-1 of the data are transformed in
+     the block and multiplied by the twiddle factors on the way to y */
+
+  for (j = 0; j < n2; j += FFT_BLOCK)
+    {
+      const size_t nj = GSL_MIN (FFT_BLOCK, n2 - j);
+
+      for (k = 0; k < n1; k++)
+        {
+          for (i = 0; i < nj; i++)
+            {
+              REAL(block,1,k * nj + i) = REAL(data,stride,k * n2 + j + i);
+              IMAG(block,1,k * nj + i) = IMAG(data,stride,k * n2 + j + i);
+            }
+        }
+
+      FUNCTION(fft_complex,mixed_radix) (block, 1, nj, n1, columns, s, sign);
+
+      for (i = 0; i < nj; i++)
+        {
+          hi[i] = 0;
+          lo[i] = 0;
+        }
+
+      for (g = 0; g < n1; g += FFT_BLOCK)
+        {
+          const size_t ng = GSL_MIN (FFT_BLOCK, n1 - g);
+          BASE * const yg = y + 2 * g * n2;
+
+          for (k = g; k < g + ng; k++)
+            {
+              for (i = 0; i < nj; i++)
+                {
+                  const ATOMIC h_real = GSL_REAL(step_hi[hi[i]]);
+                  const ATOMIC h_imag = GSL_IMAG(step_hi[hi[i]]);
+                  const ATOMIC l_real = GSL_REAL(step_lo[lo[i]]);
+                  const ATOMIC l_imag = GSL_IMAG(step_lo[lo[i]]);
+                  const ATOMIC w_real = h_real * l_real - h_imag * l_imag;
+                  const ATOMIC w_imag = c * (h_real * l_imag + h_imag * l_real);
+                  const ATOMIC z_real = REAL(block,1,k * nj + i);
+                  const ATOMIC z_imag = IMAG(block,1,k * nj + i);
+                  size_t carry;
+
+                  REAL(yg,1,(j + i) * ng + k - g) = z_real * w_real - z_imag * w_imag;
+                  IMAG(yg,1,(j + i) * ng + k - g) = z_real * w_imag + z_imag * w_real;
+
+                  /* hi n2 + lo = (j + i) k, updated without a branch
+                     as the carry is unpredictable */
+
+                  lo[i] += j + i;
+                  carry = (lo[i] >= n2);
+                  lo[i] -= carry * n2;
+                  hi[i] += carry;
+                }
+            }
+        }
+    }
+
+  /* steps 3 and 4, rows g..g+ng-1 of y are transformed together and
+     written to the elements g + i + n1 k2 of the data */
+
+  for (g = 0; g < n1; g += FFT_BLOCK)
+    {
+      const size_t ng = GSL_MIN (FFT_BLOCK, n1 - g);
+      BASE * const yg = y + 2 * g * n2;
+
+      FUNCTION(fft_complex,mixed_radix) (yg, 1, ng, n2, rows, s, sign);
+
+      for (j = 0; j < n2; j++)
+        {
+          for (i = 0; i < ng; i++)
+            {
+              REAL(data,stride,j * n1 + g + i) = REAL(yg,1,j * ng + i);
+              IMAG(data,stride,j * n1 + g + i) = IMAG(yg,1,j * ng + i);
+            }
+        }
+    }
+
+  return 0;
+}
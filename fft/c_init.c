@@ -17,13 +17,22 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
-TYPE(gsl_fft_complex_wavetable) * 
-FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
+#include "c_pass.h"
+
+/* The trigonometric values are computed directly unless a table of the
+   n-th roots of unity, roots[2m] + i roots[2m+1] = exp(2 pi i m/n), is
+   supplied, which lets tables of the same length share one evaluation.
+   For a length with a large prime factor the table describes the power
+   of 2 length nb of the Bluestein convolution, see c_bluestein.c. */
+
+static TYPE(gsl_fft_complex_wavetable) *
+FUNCTION(fft_complex_wavetable,alloc_roots) (size_t n, const double roots[])
 {
   int status ;
   size_t i;
   size_t n_factors;
   size_t t, product, product_1, q;
+  size_t nb, nt;
   double d_theta;
 
   TYPE(gsl_fft_complex_wavetable) * wavetable ;
@@ -41,7 +50,27 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
-  wavetable->trig = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
+  wavetable->n = n ;
+  wavetable->nb = 0 ;
+  wavetable->chirp = NULL ;
+  wavetable->kernel = NULL ;
+  wavetable->columns = NULL ;
+  wavetable->rows = NULL ;
+  wavetable->step = NULL ;
+
+  nb = fft_bluestein_length (n);
+
+  if (nb)
+    {
+      nt = nb;                  /* length of the mixed-radix transforms */
+      roots = NULL;
+    }
+  else
+    {
+      nt = n;
+    }
+
+  wavetable->trig = (TYPE(gsl_complex) *) malloc (nt * sizeof (TYPE(gsl_complex)));
 
   if (wavetable->trig == NULL)
     {
@@ -51,9 +80,9 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
                         GSL_ENOMEM, 0);
     }
 
-  wavetable->n = n ;
+  wavetable->nb = nb ;
 
-  status = fft_complex_factorize (n, &n_factors, wavetable->factor);
+  status = fft_complex_factorize (nt, &n_factors, wavetable->factor);
 
   if (status)
     {
@@ -67,7 +96,7 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
 
   wavetable->nf = n_factors;
 
-  d_theta = -2.0 * M_PI / ((double) n);
+  d_theta = -2.0 * M_PI / ((double) nt);
 
   t = 0;
   product = 1;
@@ -78,7 +107,7 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
       wavetable->twiddle[i] = wavetable->trig + t;
       product_1 = product;      /* product_1 = p_(i-1) */
       product *= factor;
-      q = n / product;
+      q = nt / product;
 
       for (j = 1; j < factor; j++)
         {
@@ -88,17 +117,25 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
             {
               double theta;
               m = m + j * product_1;
-              m = m % n;
-              theta = d_theta * m;      /*  d_theta*j*k*p_(i-1) */
-              GSL_REAL(wavetable->trig[t]) = cos (theta);
-              GSL_IMAG(wavetable->trig[t]) = sin (theta);
+              m = m % nt;
+              if (roots)
+                {
+                  GSL_REAL(wavetable->trig[t]) = roots[2 * m];
+                  GSL_IMAG(wavetable->trig[t]) = -roots[2 * m + 1];
+                }
+              else
+                {
+                  theta = d_theta * m;      /*  d_theta*j*k*p_(i-1) */
+                  GSL_REAL(wavetable->trig[t]) = cos (theta);
+                  GSL_IMAG(wavetable->trig[t]) = sin (theta);
+                }
 
               t++;
             }
         }
     }
 
-  if (t > n)
+  if (t > nt)
     {
       /* exception in constructor, avoid memory leak */
 
@@ -109,20 +146,100 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
                         GSL_ESANITY, 0);
     }
 
+  if (nb)
+    {
+      status = FUNCTION(fft_complex,bluestein_init) (wavetable);
+
+      if (status)
+        {
+          FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+          GSL_ERROR_VAL ("failed to initialize Bluestein tables",
+                         GSL_ENOMEM, 0);
+        }
+    }
+
+  return wavetable;
+}
+
+TYPE(gsl_fft_complex_wavetable) *
+FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
+{
+  return FUNCTION(fft_complex_wavetable,alloc_roots) (n, NULL);
+}
+
+TYPE(gsl_fft_complex_wavetable) *
+FUNCTION(gsl_fft_complex_wavetable,alloc_four_step) (size_t n)
+{
+  int status;
+  size_t n1;
+
+  TYPE(gsl_fft_complex_wavetable) * wavetable ;
+
+  n1 = fft_bluestein_length (n) ? 0 : fft_four_step_length (n);
+
+  if (n1 == 0)
+    {
+      /* lengths which cannot be split use the mixed-radix passes or
+         Bluestein's algorithm as usual */
+
+      return FUNCTION(fft_complex_wavetable,alloc_roots) (n, NULL);
+    }
+
+  wavetable = (TYPE(gsl_fft_complex_wavetable) *) 
+    malloc(sizeof(TYPE(gsl_fft_complex_wavetable)));
+
+  if (wavetable == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  /* the transform is computed from transforms of lengths n1 and n/n1,
+     see c_fourstep.c, and has no factors of its own */
+
+  wavetable->n = n ;
+  wavetable->nf = 0 ;
+  wavetable->nb = 0 ;
+  wavetable->trig = NULL ;
+  wavetable->chirp = NULL ;
+  wavetable->kernel = NULL ;
+  wavetable->columns = NULL ;
+  wavetable->rows = NULL ;
+  wavetable->step = NULL ;
+
+  status = FUNCTION(fft_complex,four_step_init) (wavetable, n1);
+
+  if (status)
+    {
+      FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+      GSL_ERROR_VAL ("failed to initialize four-step tables", GSL_ENOMEM, 0);
+    }
+
   return wavetable;
 }
 
 
 TYPE(gsl_fft_complex_workspace) * 
 FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
+{
+  return FUNCTION(gsl_fft_complex_workspace,alloc_lanes) (n, 1);
+}
+
+TYPE(gsl_fft_complex_workspace) * 
+FUNCTION(gsl_fft_complex_workspace,alloc_lanes) (size_t n, size_t lanes)
 {
   TYPE(gsl_fft_complex_workspace) * workspace ;
+  size_t size;
 
   if (n == 0)
     {
       GSL_ERROR_VAL ("length n must be positive integer", GSL_EDOM, 0);
     }
 
+  if (lanes == 0)
+    {
+      GSL_ERROR_VAL ("number of lanes must be positive integer", GSL_EDOM, 0);
+    }
+
   workspace = (TYPE(gsl_fft_complex_workspace) *) 
     malloc(sizeof(TYPE(gsl_fft_complex_workspace)));
 
@@ -132,8 +249,19 @@ FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
     }
 
   workspace->n = n ;
+  workspace->lanes = lanes ;
+
+  /* the batch transforms pass lanes signals through the mixed-radix
+     passes together, with a scratch copy of all of them */
+
+  size = fft_complex_scratch_size (n);
 
-  workspace->scratch = (BASE *) malloc (2 * n * sizeof (BASE));
+  if (size < 2 * lanes * n)
+    {
+      size = 2 * lanes * n;
+    }
+
+  workspace->scratch = (BASE *) malloc (size * sizeof (BASE));
 
   if (workspace->scratch == NULL)
     {
@@ -154,6 +282,11 @@ FUNCTION(gsl_fft_complex_wavetable,free) (TYPE(gsl_fft_complex_wavetable) * wave
 
   free (wavetable->trig);
   wavetable->trig = NULL;
+  free (wavetable->chirp);
+  free (wavetable->kernel);
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->columns);
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->rows);
+  free (wavetable->step);
 
   free (wavetable) ;
 }
@@ -180,11 +313,37 @@ FUNCTION(gsl_fft_complex,memcpy) (TYPE(gsl_fft_complex_wavetable) * dest,
     {
       GSL_ERROR ("length of src and dest do not match", GSL_EINVAL);
     } 
+
+  if ((dest->columns == NULL) != (src->columns == NULL)
+      || dest->nb != src->nb)
+    {
+      GSL_ERROR ("src and dest are different kinds of wavetable", GSL_EINVAL);
+    }
   
-  n = dest->n ;
+  if (dest->columns)
+    {
+      const size_t n1 = dest->columns->n, n2 = dest->rows->n;
+      int status;
+
+      memcpy (dest->step, src->step, (n1 + n2) * sizeof (TYPE(gsl_complex)));
+
+      status = FUNCTION(gsl_fft_complex,memcpy) (dest->columns, src->columns);
+      if (status)
+        return status;
+
+      return FUNCTION(gsl_fft_complex,memcpy) (dest->rows, src->rows);
+    }
+
+  n = dest->nb ? dest->nb : dest->n ;
   nf = dest->nf ;
 
-  memcpy(dest->trig, src->trig, n * sizeof (double)) ;
+  memcpy(dest->trig, src->trig, n * sizeof (TYPE(gsl_complex))) ;
+
+  if (dest->nb)
+    {
+      memcpy (dest->chirp, src->chirp, dest->n * sizeof (TYPE(gsl_complex)));
+      memcpy (dest->kernel, src->kernel, dest->nb * sizeof (TYPE(gsl_complex)));
+    }
   
   for (i = 0 ; i < nf ; i++)
     {
@@ -75,33 +75,154 @@ FUNCTION(gsl_fft_complex,inverse) (TYPE(gsl_complex_packed_array) data,
   return status;
 }
 
+/* The batch functions transform howmany signals of length n, the i-th
+   starting at data + i dist (in complex elements) with elements stride
+   apart, using the same wavetable and workspace for all of them.
+   When the signals are interleaved element by element (stride equal
+   to howmany dist) and the workspace was allocated with at least
+   howmany lanes, the mixed-radix passes transform all of them
+   together, loading each twiddle factor once for all the signals. */
+
 int
-FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data, 
-                                     const size_t stride, 
-                                     const size_t n,
-                                     const TYPE(gsl_fft_complex_wavetable) * wavetable,
-                                     TYPE(gsl_fft_complex_workspace) * work,
-                                     const gsl_fft_direction sign)
+FUNCTION(gsl_fft_complex,forward_batch) (TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t howmany,
+                                         const size_t n,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_workspace) * work)
 {
-  const size_t nf = wavetable->nf;
+  return FUNCTION(gsl_fft_complex,transform_batch) (data, stride, dist, howmany,
+                                                    n, wavetable, work,
+                                                    gsl_fft_forward);
+}
+
+int
+FUNCTION(gsl_fft_complex,backward_batch) (TYPE(gsl_complex_packed_array) data,
+                                          const size_t stride,
+                                          const size_t dist,
+                                          const size_t howmany,
+                                          const size_t n,
+                                          const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                          TYPE(gsl_fft_complex_workspace) * work)
+{
+  return FUNCTION(gsl_fft_complex,transform_batch) (data, stride, dist, howmany,
+                                                    n, wavetable, work,
+                                                    gsl_fft_backward);
+}
+
+int
+FUNCTION(gsl_fft_complex,inverse_batch) (TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t howmany,
+                                         const size_t n,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_workspace) * work)
+{
+  int status = FUNCTION(gsl_fft_complex,transform_batch) (data, stride, dist,
+                                                          howmany, n, wavetable,
+                                                          work, gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/n */
+
+  {
+    const ATOMIC norm = ONE / (ATOMIC)n;
+    size_t i, j;
+    for (i = 0; i < howmany; i++)
+      {
+        BASE *const x = data + 2 * i * dist;
+
+        for (j = 0; j < n; j++)
+          {
+            REAL(x,stride,j) *= norm;
+            IMAG(x,stride,j) *= norm;
+          }
+      }
+  }
+  return status;
+}
 
+int
+FUNCTION(gsl_fft_complex,transform_batch) (TYPE(gsl_complex_packed_array) data,
+                                           const size_t stride,
+                                           const size_t dist,
+                                           const size_t howmany,
+                                           const size_t n,
+                                           const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                           TYPE(gsl_fft_complex_workspace) * work,
+                                           const gsl_fft_direction sign)
+{
   size_t i;
 
-  size_t q, product = 1;
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
 
-  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4,
-    *twiddle5, *twiddle6;
+  if (n == 1)
+    {                           /* FFT of 1 data point is the identity */
+      return 0;
+    }
 
-  size_t state = 0;
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
 
-  BASE * const scratch = work->scratch;
+  if (n != work->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
 
-  BASE * in = data;
-  size_t istride = stride;
+  /* signals interleaved element by element are transformed together,
+     in place, when the workspace holds all of them */
 
-  BASE * out = scratch;
-  size_t ostride = 1;
+  if (howmany > 1 && howmany <= work->lanes && stride == howmany * dist
+      && !wavetable->nb && !wavetable->columns)
+    {
+      return FUNCTION(fft_complex,mixed_radix) (data, dist, howmany, n,
+                                                wavetable, work->scratch,
+                                                sign);
+    }
 
+  for (i = 0; i < howmany; i++)
+    {
+      BASE *const x = data + 2 * i * dist;
+
+      if (wavetable->nb)
+        {
+          FUNCTION(fft_complex,bluestein) (x, stride, n, wavetable,
+                                           work->scratch, sign);
+        }
+      else if (wavetable->columns)
+        {
+          FUNCTION(fft_complex,four_step) (x, stride, n, wavetable,
+                                           work->scratch, sign);
+        }
+      else
+        {
+          FUNCTION(fft_complex,mixed_radix) (x, stride, 1, n, wavetable,
+                                             work->scratch, sign);
+        }
+    }
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data, 
+                                     const size_t stride, 
+                                     const size_t n,
+                                     const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                     TYPE(gsl_fft_complex_workspace) * work,
+                                     const gsl_fft_direction sign)
+{
   if (n == 0)
     {
       GSL_ERROR ("length n must be positive integer", GSL_EDOM);
@@ -122,6 +243,55 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->nb)
+    {
+      return FUNCTION(fft_complex,bluestein) (data, stride, n, wavetable,
+                                              work->scratch, sign);
+    }
+
+  if (wavetable->columns)
+    {
+      return FUNCTION(fft_complex,four_step) (data, stride, n, wavetable,
+                                              work->scratch, sign);
+    }
+
+  return FUNCTION(fft_complex,mixed_radix) (data, stride, 1, n, wavetable,
+                                            work->scratch, sign);
+}
+
+static int
+FUNCTION(fft_complex,mixed_radix) (BASE data[],
+                                   const size_t stride,
+                                   const size_t lanes,
+                                   const size_t n,
+                                   const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                   BASE scratch[],
+                                   const gsl_fft_direction sign)
+{
+  /* applies the passes for the factors in the wavetable to lanes
+     signals of length n, which is the product of the factors.  Element
+     i of signal b is element lanes*i + b of data, so the passes for
+     length n*lanes with every product scaled by lanes transform all
+     the signals together, loading each twiddle factor once for all of
+     them.  With lanes = 1 this is the ordinary transform. */
+
+  const size_t nf = wavetable->nf;
+
+  size_t i;
+
+  size_t q, product = 1;
+
+  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4,
+    *twiddle5, *twiddle6;
+
+  size_t state = 0;
+
+  BASE * in = data;
+  size_t istride = stride;
+
+  BASE * out = scratch;
+  size_t ostride = 1;
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -145,18 +315,34 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           state = 0;
         }
 
-      if (factor == 2)
+      if (factor == 2 && istride == 1 && ostride == 1)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          FUNCTION(fft_complex,pass_2_unit) (in, out, sign, product * lanes,
+                                             n * lanes, twiddle1);
+        }
+      else if (factor == 2)
         {
           twiddle1 = wavetable->twiddle[i];
           FUNCTION(fft_complex,pass_2) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1);
+                                        product * lanes, n * lanes, twiddle1);
         }
       else if (factor == 3)
         {
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + q;
           FUNCTION(fft_complex,pass_3) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1, twiddle2);
+                                        product * lanes, n * lanes,
+                                        twiddle1, twiddle2);
+        }
+      else if (factor == 4 && istride == 1 && ostride == 1)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          twiddle2 = twiddle1 + q;
+          twiddle3 = twiddle2 + q;
+          FUNCTION(fft_complex,pass_4_unit) (in, out, sign, product * lanes,
+                                             n * lanes, twiddle1, twiddle2,
+                                             twiddle3);
         }
       else if (factor == 4)
         {
@@ -164,7 +350,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle2 = twiddle1 + q;
           twiddle3 = twiddle2 + q;
           FUNCTION(fft_complex,pass_4) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1, twiddle2, 
+                                        product * lanes, n * lanes,
+                                        twiddle1, twiddle2, 
                                         twiddle3);
         }
       else if (factor == 5)
@@ -174,7 +361,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle3 = twiddle2 + q;
           twiddle4 = twiddle3 + q;
           FUNCTION(fft_complex,pass_5) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1, twiddle2, 
+                                        product * lanes, n * lanes,
+                                        twiddle1, twiddle2, 
                                         twiddle3, twiddle4);
         }
       else if (factor == 6)
@@ -185,7 +373,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle4 = twiddle3 + q;
           twiddle5 = twiddle4 + q;
           FUNCTION(fft_complex,pass_6) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1, twiddle2, 
+                                        product * lanes, n * lanes,
+                                        twiddle1, twiddle2, 
                                         twiddle3, twiddle4, twiddle5);
         }
       else if (factor == 7)
@@ -197,7 +386,8 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle5 = twiddle4 + q;
           twiddle6 = twiddle5 + q;
           FUNCTION(fft_complex,pass_7) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1, twiddle2, 
+                                        product * lanes, n * lanes,
+                                        twiddle1, twiddle2, 
                                         twiddle3, twiddle4, twiddle5, 
                                         twiddle6);
         }
@@ -205,13 +395,14 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
         {
           twiddle1 = wavetable->twiddle[i];
           FUNCTION(fft_complex,pass_n) (in, istride, out, ostride, sign, 
-                                        factor, product, n, twiddle1);
+                                        factor, product * lanes, n * lanes,
+                                        twiddle1);
         }
     }
 
   if (state == 1)               /* copy results back from scratch to data */
     {
-      for (i = 0; i < n; i++)
+      for (i = 0; i < n * lanes; i++)
         {
           REAL(data,stride,i) = REAL(scratch,1,i) ;
           IMAG(data,stride,i) = IMAG(scratch,1,i) ;
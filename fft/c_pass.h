@@ -27,6 +27,14 @@ FUNCTION(fft_complex,pass_2) (const BASE in[],
                               const size_t n,
                               const TYPE(gsl_complex) twiddle[]);
 
+static int
+FUNCTION(fft_complex,pass_2_unit) (const BASE in[],
+                                   BASE out[],
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle[]);
+
 static int
 FUNCTION(fft_complex,pass_3) (const BASE in[],
                               const size_t istride,
@@ -50,6 +58,16 @@ FUNCTION(fft_complex,pass_4) (const BASE in[],
                               const TYPE(gsl_complex) twiddle2[],
                               const TYPE(gsl_complex) twiddle3[]);
 
+static int
+FUNCTION(fft_complex,pass_4_unit) (const BASE in[],
+                                   BASE out[],
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle1[],
+                                   const TYPE(gsl_complex) twiddle2[],
+                                   const TYPE(gsl_complex) twiddle3[]);
+
 static int
 FUNCTION(fft_complex,pass_5) (const BASE in[],
                               const size_t istride,
@@ -104,3 +122,34 @@ FUNCTION(fft_complex,pass_n) (BASE in[],
                               const size_t n,
                               const TYPE(gsl_complex) twiddle[]);
 
+static int
+FUNCTION(fft_complex,mixed_radix) (BASE data[],
+                                   const size_t stride,
+                                   const size_t lanes,
+                                   const size_t n,
+                                   const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                   BASE scratch[],
+                                   const gsl_fft_direction sign);
+
+static int
+FUNCTION(fft_complex,bluestein) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign);
+
+static int
+FUNCTION(fft_complex,bluestein_init) (TYPE(gsl_fft_complex_wavetable) * wavetable);
+
+static int
+FUNCTION(fft_complex,four_step_init) (TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                      const size_t n1);
+
+static int
+FUNCTION(fft_complex,four_step) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign);
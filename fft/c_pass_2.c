@@ -96,3 +96,70 @@ FUNCTION(fft_complex,pass_2) (const BASE in[],
     }
   return 0;
 }
+
+/* the same pass for unit strides, with the elements of each butterfly
+   addressed directly and the twiddle factor 1 of the first block
+   skipped */
+
+static int
+FUNCTION(fft_complex,pass_2_unit) (const BASE in[],
+                                   BASE out[],
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle[])
+{
+  size_t k, k1;
+
+  const size_t factor = 2;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t product_1 = product / factor;
+
+  const BASE *z0 = in;
+  const BASE *z1 = in + 2 * m;
+
+  for (k = 0; k < q; k++)
+    {
+      BASE *x0 = out + 2 * k * product;
+      BASE *x1 = x0 + 2 * product_1;
+
+      if (k == 0)
+        {
+          for (k1 = 0; k1 < 2 * product_1; k1++)
+            {
+              const ATOMIC a = z0[k1];
+              const ATOMIC b = z1[k1];
+
+              x0[k1] = a + b;
+              x1[k1] = a - b;
+            }
+        }
+      else
+        {
+          const ATOMIC w_real = GSL_REAL(twiddle[k - 1]);
+          const ATOMIC w_imag = ((int) sign) * -GSL_IMAG(twiddle[k - 1]);
+
+          for (k1 = 0; k1 < product_1; k1++)
+            {
+              const ATOMIC z0_real = z0[2 * k1];
+              const ATOMIC z0_imag = z0[2 * k1 + 1];
+              const ATOMIC z1_real = z1[2 * k1];
+              const ATOMIC z1_imag = z1[2 * k1 + 1];
+
+              const ATOMIC x1_real = z0_real - z1_real;
+              const ATOMIC x1_imag = z0_imag - z1_imag;
+
+              x0[2 * k1] = z0_real + z1_real;
+              x0[2 * k1 + 1] = z0_imag + z1_imag;
+
+              x1[2 * k1] = w_real * x1_real - w_imag * x1_imag;
+              x1[2 * k1 + 1] = w_real * x1_imag + w_imag * x1_real;
+            }
+        }
+
+      z0 += 2 * product_1;
+      z1 += 2 * product_1;
+    }
+  return 0;
+}
@@ -145,3 +145,128 @@ FUNCTION(fft_complex,pass_4) (const BASE in[],
     }
   return 0;
 }
+
+/* the same pass for unit strides, with the elements of each butterfly
+   addressed directly and the twiddle factors 1 of the first block
+   skipped */
+
+static int
+FUNCTION(fft_complex,pass_4_unit) (const BASE in[],
+                                   BASE out[],
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle1[],
+                                   const TYPE(gsl_complex) twiddle2[],
+                                   const TYPE(gsl_complex) twiddle3[])
+{
+  size_t k, k1;
+
+  const size_t factor = 4;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+  const ATOMIC s = (int) sign;
+
+  const BASE *z0 = in;
+  const BASE *z1 = in + 2 * m;
+  const BASE *z2 = in + 4 * m;
+  const BASE *z3 = in + 6 * m;
+
+  for (k = 0; k < q; k++)
+    {
+      BASE *x0 = out + 2 * k * product;
+      BASE *x1 = x0 + 2 * p_1;
+      BASE *x2 = x1 + 2 * p_1;
+      BASE *x3 = x2 + 2 * p_1;
+
+      if (k == 0)
+        {
+          for (k1 = 0; k1 < p_1; k1++)
+            {
+              const ATOMIC z0_real = z0[2 * k1];
+              const ATOMIC z0_imag = z0[2 * k1 + 1];
+              const ATOMIC z1_real = z1[2 * k1];
+              const ATOMIC z1_imag = z1[2 * k1 + 1];
+              const ATOMIC z2_real = z2[2 * k1];
+              const ATOMIC z2_imag = z2[2 * k1 + 1];
+              const ATOMIC z3_real = z3[2 * k1];
+              const ATOMIC z3_imag = z3[2 * k1 + 1];
+
+              const ATOMIC t1_real = z0_real + z2_real;
+              const ATOMIC t1_imag = z0_imag + z2_imag;
+              const ATOMIC t2_real = z1_real + z3_real;
+              const ATOMIC t2_imag = z1_imag + z3_imag;
+              const ATOMIC t3_real = z0_real - z2_real;
+              const ATOMIC t3_imag = z0_imag - z2_imag;
+              const ATOMIC t4_real = s * (z1_real - z3_real);
+              const ATOMIC t4_imag = s * (z1_imag - z3_imag);
+
+              x0[2 * k1] = t1_real + t2_real;
+              x0[2 * k1 + 1] = t1_imag + t2_imag;
+              x1[2 * k1] = t3_real - t4_imag;
+              x1[2 * k1 + 1] = t3_imag + t4_real;
+              x2[2 * k1] = t1_real - t2_real;
+              x2[2 * k1 + 1] = t1_imag - t2_imag;
+              x3[2 * k1] = t3_real + t4_imag;
+              x3[2 * k1 + 1] = t3_imag - t4_real;
+            }
+        }
+      else
+        {
+          /* w -> conjugate(w) for the backward transform */
+          const ATOMIC w1_real = GSL_REAL(twiddle1[k - 1]);
+          const ATOMIC w1_imag = -s * GSL_IMAG(twiddle1[k - 1]);
+          const ATOMIC w2_real = GSL_REAL(twiddle2[k - 1]);
+          const ATOMIC w2_imag = -s * GSL_IMAG(twiddle2[k - 1]);
+          const ATOMIC w3_real = GSL_REAL(twiddle3[k - 1]);
+          const ATOMIC w3_imag = -s * GSL_IMAG(twiddle3[k - 1]);
+
+          for (k1 = 0; k1 < p_1; k1++)
+            {
+              const ATOMIC z0_real = z0[2 * k1];
+              const ATOMIC z0_imag = z0[2 * k1 + 1];
+              const ATOMIC z1_real = z1[2 * k1];
+              const ATOMIC z1_imag = z1[2 * k1 + 1];
+              const ATOMIC z2_real = z2[2 * k1];
+              const ATOMIC z2_imag = z2[2 * k1 + 1];
+              const ATOMIC z3_real = z3[2 * k1];
+              const ATOMIC z3_imag = z3[2 * k1 + 1];
+
+              const ATOMIC t1_real = z0_real + z2_real;
+              const ATOMIC t1_imag = z0_imag + z2_imag;
+              const ATOMIC t2_real = z1_real + z3_real;
+              const ATOMIC t2_imag = z1_imag + z3_imag;
+              const ATOMIC t3_real = z0_real - z2_real;
+              const ATOMIC t3_imag = z0_imag - z2_imag;
+              const ATOMIC t4_real = s * (z1_real - z3_real);
+              const ATOMIC t4_imag = s * (z1_imag - z3_imag);
+
+              const ATOMIC x1_real = t3_real - t4_imag;
+              const ATOMIC x1_imag = t3_imag + t4_real;
+              const ATOMIC x2_real = t1_real - t2_real;
+              const ATOMIC x2_imag = t1_imag - t2_imag;
+              const ATOMIC x3_real = t3_real + t4_imag;
+              const ATOMIC x3_imag = t3_imag - t4_real;
+
+              x0[2 * k1] = t1_real + t2_real;
+              x0[2 * k1 + 1] = t1_imag + t2_imag;
+
+              x1[2 * k1] = w1_real * x1_real - w1_imag * x1_imag;
+              x1[2 * k1 + 1] = w1_real * x1_imag + w1_imag * x1_real;
+
+              x2[2 * k1] = w2_real * x2_real - w2_imag * x2_imag;
+              x2[2 * k1 + 1] = w2_real * x2_imag + w2_imag * x2_real;
+
+              x3[2 * k1] = w3_real * x3_real - w3_imag * x3_imag;
+              x3[2 * k1 + 1] = w3_real * x3_imag + w3_imag * x3_real;
+            }
+        }
+
+      z0 += 2 * p_1;
+      z1 += 2 * p_1;
+      z2 += 2 * p_1;
+      z3 += 2 * p_1;
+    }
+  return 0;
+}
@@ -0,0 +1,189 @@
+/* fft/cache.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A cache of wavetables indexed by transform length.  It holds at most
+   cache->size lengths and replaces the least recently used one when a
+   new length is requested; the tables of the replaced length are freed,
+   so a pointer returned by an earlier lookup becomes invalid.  A cache
+   must not be shared between threads, even for lookups only: a lookup
+   reorders the entries, and the roots table of an entry is filled in
+   by whichever table kind of that length is created first. */
+
+static void
+fft_cache_entry_free (gsl_fft_cache_entry * e)
+{
+  free (e->roots);
+  gsl_fft_complex_wavetable_free (e->complex);
+  gsl_fft_real_wavetable_free (e->real);
+  gsl_fft_halfcomplex_wavetable_free (e->halfcomplex);
+  gsl_fft_complex_wavetable_float_free (e->complex_float);
+  gsl_fft_real_wavetable_float_free (e->real_float);
+  gsl_fft_halfcomplex_wavetable_float_free (e->halfcomplex_float);
+
+  e->n = 0;
+  e->roots = NULL;
+  e->complex = NULL;
+  e->real = NULL;
+  e->halfcomplex = NULL;
+  e->complex_float = NULL;
+  e->real_float = NULL;
+  e->halfcomplex_float = NULL;
+}
+
+gsl_fft_cache *
+gsl_fft_cache_alloc (const size_t size)
+{
+  gsl_fft_cache *cache;
+
+  if (size == 0)
+    {
+      GSL_ERROR_NULL ("cache size must be positive integer", GSL_EDOM);
+    }
+
+  cache = (gsl_fft_cache *) calloc (1, sizeof (gsl_fft_cache));
+
+  if (cache == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  cache->entry = (gsl_fft_cache_entry *) calloc (size, sizeof (gsl_fft_cache_entry));
+
+  if (cache->entry == NULL)
+    {
+      free (cache);
+      GSL_ERROR_NULL ("failed to allocate cache entries", GSL_ENOMEM);
+    }
+
+  cache->size = size;
+
+  return cache;
+}
+
+void
+gsl_fft_cache_free (gsl_fft_cache * cache)
+{
+  RETURN_IF_NULL (cache);
+
+  gsl_fft_cache_clear (cache);
+
+  free (cache->entry);
+  free (cache->scratch);
+  free (cache->scratch_float);
+  free (cache);
+}
+
+void
+gsl_fft_cache_clear (gsl_fft_cache * cache)
+{
+  /* releases all wavetables, the hit and miss counters are kept */
+
+  size_t i;
+
+  for (i = 0; i < cache->nentries; i++)
+    {
+      fft_cache_entry_free (&cache->entry[i]);
+    }
+
+  cache->nentries = 0;
+}
+
+size_t
+gsl_fft_cache_hits (const gsl_fft_cache * cache)
+{
+  return cache->hits;
+}
+
+size_t
+gsl_fft_cache_misses (const gsl_fft_cache * cache)
+{
+  return cache->misses;
+}
+
+static gsl_fft_cache_entry *
+fft_cache_lookup (gsl_fft_cache * cache, const size_t n)
+{
+  /* returns the entry for length n, reusing the least recently used
+     entry if n is not present and the cache is full */
+
+  gsl_fft_cache_entry *e;
+  size_t i, lru = 0;
+
+  cache->clock++;
+
+  for (i = 0; i < cache->nentries; i++)
+    {
+      if (cache->entry[i].n == n)
+        {
+          cache->entry[i].stamp = cache->clock;
+          return &cache->entry[i];
+        }
+
+      if (cache->entry[i].stamp < cache->entry[lru].stamp)
+        {
+          lru = i;
+        }
+    }
+
+  if (cache->nentries < cache->size)
+    {
+      e = &cache->entry[cache->nentries];
+      cache->nentries++;
+    }
+  else
+    {
+      e = &cache->entry[lru];
+      fft_cache_entry_free (e);
+    }
+
+  e->n = n;
+  e->stamp = cache->clock;
+
+  return e;
+}
+
+static const double *
+fft_cache_roots (gsl_fft_cache_entry * e)
+{
+  /* returns the n-th roots of unity exp(2 pi i m/n), computed with the
+     same arguments as the wavetable allocators so that the tables are
+     identical to those from gsl_fft_*_wavetable_alloc.  If there is no
+     memory for them the allocators compute their tables directly. */
+
+  if (e->roots == NULL)
+    {
+      const size_t n = e->n;
+      const double d_theta = 2.0 * M_PI / ((double) n);
+      size_t m;
+
+      e->roots = (double *) malloc (2 * n * sizeof (double));
+
+      if (e->roots == NULL)
+        {
+          return NULL;
+        }
+
+      for (m = 0; m < n; m++)
+        {
+          const double theta = d_theta * m;
+          e->roots[2 * m] = cos (theta);
+          e->roots[2 * m + 1] = sin (theta);
+        }
+    }
+
+  return e->roots;
+}
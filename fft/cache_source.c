@@ -0,0 +1,300 @@
+/* fft/cache_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* selects the members of gsl_fft_cache_entry and gsl_fft_cache which
+   belong to the current precision */
+
+#if defined(BASE_FLOAT)
+#define CACHE_FIELD(x) x ## _float
+#else
+#define CACHE_FIELD(x) x
+#endif
+
+const TYPE(gsl_fft_complex_wavetable) *
+FUNCTION(gsl_fft_cache_complex,wavetable) (gsl_fft_cache * cache, const size_t n)
+{
+  gsl_fft_cache_entry *e;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  e = fft_cache_lookup (cache, n);
+
+  if (e->CACHE_FIELD(complex) != NULL)
+    {
+      cache->hits++;
+    }
+  else
+    {
+      cache->misses++;
+      e->CACHE_FIELD(complex) =
+        FUNCTION(fft_complex_wavetable,alloc_roots) (n, fft_cache_roots (e));
+    }
+
+  return e->CACHE_FIELD(complex);
+}
+
+const TYPE(gsl_fft_real_wavetable) *
+FUNCTION(gsl_fft_cache_real,wavetable) (gsl_fft_cache * cache, const size_t n)
+{
+  gsl_fft_cache_entry *e;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  e = fft_cache_lookup (cache, n);
+
+  if (e->CACHE_FIELD(real) != NULL)
+    {
+      cache->hits++;
+    }
+  else
+    {
+      cache->misses++;
+      e->CACHE_FIELD(real) =
+        FUNCTION(fft_real_wavetable,alloc_roots) (n, fft_cache_roots (e));
+    }
+
+  return e->CACHE_FIELD(real);
+}
+
+const TYPE(gsl_fft_halfcomplex_wavetable) *
+FUNCTION(gsl_fft_cache_halfcomplex,wavetable) (gsl_fft_cache * cache, const size_t n)
+{
+  gsl_fft_cache_entry *e;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  e = fft_cache_lookup (cache, n);
+
+  if (e->CACHE_FIELD(halfcomplex) != NULL)
+    {
+      cache->hits++;
+    }
+  else
+    {
+      cache->misses++;
+      e->CACHE_FIELD(halfcomplex) =
+        FUNCTION(fft_halfcomplex_wavetable,alloc_roots) (n, fft_cache_roots (e));
+    }
+
+  return e->CACHE_FIELD(halfcomplex);
+}
+
+static BASE *
+FUNCTION(fft_cache,scratch) (gsl_fft_cache * cache, const size_t size)
+{
+  /* returns scratch space of at least size elements, shared by all the
+     transforms of this precision */
+
+  if (cache->CACHE_FIELD(scratch_size) < size)
+    {
+      free (cache->CACHE_FIELD(scratch));
+
+      cache->CACHE_FIELD(scratch) = (BASE *) malloc (size * sizeof (BASE));
+
+      if (cache->CACHE_FIELD(scratch) == NULL)
+        {
+          cache->CACHE_FIELD(scratch_size) = 0;
+          GSL_ERROR_NULL ("failed to allocate scratch space", GSL_ENOMEM);
+        }
+
+      cache->CACHE_FIELD(scratch_size) = size;
+    }
+
+  return cache->CACHE_FIELD(scratch);
+}
+
+static int
+FUNCTION(fft_cache,complex_setup) (gsl_fft_cache * cache, const size_t n,
+                                   const TYPE(gsl_fft_complex_wavetable) ** wavetable,
+                                   TYPE(gsl_fft_complex_workspace) * work)
+{
+  *wavetable = FUNCTION(gsl_fft_cache_complex,wavetable) (cache, n);
+
+  if (*wavetable == NULL)
+    {
+      GSL_ERROR ("failed to obtain wavetable", GSL_EFAILED);
+    }
+
+  /* the scratch space must match that of gsl_fft_complex_workspace_alloc */
+
+  work->n = n;
+  work->lanes = 1;
+  work->scratch = FUNCTION(fft_cache,scratch) (cache, fft_complex_scratch_size (n));
+
+  if (work->scratch == NULL)
+    {
+      GSL_ERROR ("failed to obtain workspace", GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_cache,real_setup) (gsl_fft_cache * cache, const size_t n,
+                                const TYPE(gsl_fft_complex_wavetable) * bluestein,
+                                TYPE(gsl_fft_real_workspace) * work)
+{
+  /* the scratch space must match that of gsl_fft_real_workspace_alloc */
+
+  work->n = n;
+  work->scratch = FUNCTION(fft_cache,scratch) (cache, bluestein ?
+                                               2 * n + 4 * bluestein->nb : n);
+
+  if (work->scratch == NULL)
+    {
+      GSL_ERROR ("failed to obtain workspace", GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_cache_complex,forward) (gsl_fft_cache * cache,
+                                         TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride, const size_t n)
+{
+  const TYPE(gsl_fft_complex_wavetable) * wavetable;
+  TYPE(gsl_fft_complex_workspace) work;
+
+  int status = FUNCTION(fft_cache,complex_setup) (cache, n, &wavetable, &work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_complex,forward) (data, stride, n, wavetable, &work);
+}
+
+int
+FUNCTION(gsl_fft_cache_complex,backward) (gsl_fft_cache * cache,
+                                          TYPE(gsl_complex_packed_array) data,
+                                          const size_t stride, const size_t n)
+{
+  const TYPE(gsl_fft_complex_wavetable) * wavetable;
+  TYPE(gsl_fft_complex_workspace) work;
+
+  int status = FUNCTION(fft_cache,complex_setup) (cache, n, &wavetable, &work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_complex,backward) (data, stride, n, wavetable, &work);
+}
+
+int
+FUNCTION(gsl_fft_cache_complex,inverse) (gsl_fft_cache * cache,
+                                         TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride, const size_t n)
+{
+  const TYPE(gsl_fft_complex_wavetable) * wavetable;
+  TYPE(gsl_fft_complex_workspace) work;
+
+  int status = FUNCTION(fft_cache,complex_setup) (cache, n, &wavetable, &work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_complex,inverse) (data, stride, n, wavetable, &work);
+}
+
+int
+FUNCTION(gsl_fft_cache_real,transform) (gsl_fft_cache * cache, BASE data[],
+                                        const size_t stride, const size_t n)
+{
+  const TYPE(gsl_fft_real_wavetable) * wavetable =
+    FUNCTION(gsl_fft_cache_real,wavetable) (cache, n);
+  TYPE(gsl_fft_real_workspace) work;
+  int status;
+
+  if (wavetable == NULL)
+    {
+      GSL_ERROR ("failed to obtain wavetable", GSL_EFAILED);
+    }
+
+  status = FUNCTION(fft_cache,real_setup) (cache, n, wavetable->bluestein, &work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_real,transform) (data, stride, n, wavetable, &work);
+}
+
+int
+FUNCTION(gsl_fft_cache_halfcomplex,transform) (gsl_fft_cache * cache, BASE data[],
+                                               const size_t stride, const size_t n)
+{
+  const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable =
+    FUNCTION(gsl_fft_cache_halfcomplex,wavetable) (cache, n);
+  TYPE(gsl_fft_real_workspace) work;
+  int status;
+
+  if (wavetable == NULL)
+    {
+      GSL_ERROR ("failed to obtain wavetable", GSL_EFAILED);
+    }
+
+  status = FUNCTION(fft_cache,real_setup) (cache, n, wavetable->bluestein, &work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_halfcomplex,transform) (data, stride, n, wavetable, &work);
+}
+
+int
+FUNCTION(gsl_fft_cache_halfcomplex,inverse) (gsl_fft_cache * cache, BASE data[],
+                                             const size_t stride, const size_t n)
+{
+  const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable =
+    FUNCTION(gsl_fft_cache_halfcomplex,wavetable) (cache, n);
+  TYPE(gsl_fft_real_workspace) work;
+  int status;
+
+  if (wavetable == NULL)
+    {
+      GSL_ERROR ("failed to obtain wavetable", GSL_EFAILED);
+    }
+
+  status = FUNCTION(fft_cache,real_setup) (cache, n, wavetable->bluestein, &work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_halfcomplex,inverse) (data, stride, n, wavetable, &work);
+}
+
+#undef CACHE_FIELD
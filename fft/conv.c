@@ -0,0 +1,57 @@
+/* fft/conv.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* relative cost of the FFT convolution, per n log2(n), to one
+   multiply-add of the direct sum */
+
+#define CONV_FFT_COST 3.0
+
+static size_t
+conv_fft_length (const size_t n)
+{
+  /* returns the smallest length m >= n whose only factors are 2, 3 and
+     5, which have fast passes in both the real and complex transforms */
+
+  size_t m;
+
+  for (m = n; ; m++)
+    {
+      size_t k = m;
+
+      while (k % 2 == 0)
+        k /= 2;
+      while (k % 3 == 0)
+        k /= 3;
+      while (k % 5 == 0)
+        k /= 5;
+
+      if (k == 1)
+        return m;
+    }
+}
+
+static int
+conv_use_fft (const size_t nx, const size_t ny, const size_t n)
+{
+  /* the direct sum takes nx ny multiply-adds, the three transforms of
+     length n about n log2(n) operations each */
+
+  const double direct = (double) nx * (double) ny;
+  const double fft = CONV_FFT_COST * n * log ((double) n) / M_LN2;
+
+  return direct > fft;
+}
@@ -0,0 +1,436 @@
+/* fft/conv_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The convolution z[k] = sum_j x[k-j] y[j] is summed directly when one
+   of the sequences is short, and otherwise computed as the product of
+   the transforms of x and y, zero-padded to a length n >= nx + ny - 1
+   so that the circular convolution does not wrap around.  The
+   cross-correlation z[k] = sum_i x[i + k - (ny-1)] conj(y[i]) is the
+   convolution of x with y reversed and conjugated, so z[ny-1] is the
+   term of lag zero. */
+
+static void
+FUNCTION(conv,halfcomplex_mul) (BASE a[], const BASE b[], const size_t n,
+                                const ATOMIC s)
+{
+  /* a = s a b, for halfcomplex sequences a and b of length n */
+
+  size_t k;
+
+  a[0] *= s * b[0];
+
+  for (k = 1; k < n - k; k++)
+    {
+      const ATOMIC a_real = a[2 * k - 1], a_imag = a[2 * k];
+      const ATOMIC b_real = b[2 * k - 1], b_imag = b[2 * k];
+
+      a[2 * k - 1] = s * (a_real * b_real - a_imag * b_imag);
+      a[2 * k] = s * (a_real * b_imag + a_imag * b_real);
+    }
+
+  if (k == n - k)
+    {
+      a[n - 1] *= s * b[n - 1];
+    }
+}
+
+static int
+FUNCTION(conv,real) (const BASE x[], const size_t xstride, const size_t nx,
+                     const BASE y[], const size_t ystride, const size_t ny,
+                     BASE z[], const size_t zstride, const int reverse)
+{
+  size_t i, j, k, n;
+
+  if (nx == 0 || ny == 0)
+    {
+      GSL_ERROR ("lengths must be positive integers", GSL_EDOM);
+    }
+
+  n = conv_fft_length (nx + ny - 1);
+
+  if (!conv_use_fft (nx, ny, n))
+    {
+      for (k = 0; k < nx + ny - 1; k++)
+        {
+          const size_t jmin = (k >= nx) ? k - nx + 1 : 0;
+          const size_t jmax = GSL_MIN (k, ny - 1);
+          ATOMIC sum = 0;
+
+          for (j = jmin; j <= jmax; j++)
+            {
+              const size_t jy = reverse ? ny - 1 - j : j;
+              sum += x[(k - j) * xstride] * y[jy * ystride];
+            }
+
+          z[k * zstride] = sum;
+        }
+
+      return GSL_SUCCESS;
+    }
+
+  {
+    int status;
+    BASE *a = (BASE *) malloc (2 * n * sizeof (BASE));
+    BASE *b = a + n;
+    TYPE(gsl_fft_real_wavetable) * real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+    TYPE(gsl_fft_halfcomplex_wavetable) * hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+    TYPE(gsl_fft_real_workspace) * work = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+
+    if (a == NULL || real_wavetable == NULL || hc_wavetable == NULL || work == NULL)
+      {
+        free (a);
+        FUNCTION(gsl_fft_real_wavetable,free) (real_wavetable);
+        FUNCTION(gsl_fft_halfcomplex_wavetable,free) (hc_wavetable);
+        FUNCTION(gsl_fft_real_workspace,free) (work);
+        GSL_ERROR ("failed to allocate wavetables and workspace", GSL_ENOMEM);
+      }
+
+    for (i = 0; i < n; i++)
+      {
+        a[i] = (i < nx) ? x[i * xstride] : 0;
+        b[i] = (i < ny) ? y[(reverse ? ny - 1 - i : i) * ystride] : 0;
+      }
+
+    status = FUNCTION(gsl_fft_real,transform) (a, 1, n, real_wavetable, work);
+
+    if (status == GSL_SUCCESS)
+      status = FUNCTION(gsl_fft_real,transform) (b, 1, n, real_wavetable, work);
+
+    if (status == GSL_SUCCESS)
+      {
+        FUNCTION(conv,halfcomplex_mul) (a, b, n, 1.0 / n);
+        status = FUNCTION(gsl_fft_halfcomplex,backward) (a, 1, n, hc_wavetable, work);
+      }
+
+    for (k = 0; k < nx + ny - 1; k++)
+      {
+        z[k * zstride] = a[k];
+      }
+
+    free (a);
+    FUNCTION(gsl_fft_real_wavetable,free) (real_wavetable);
+    FUNCTION(gsl_fft_halfcomplex_wavetable,free) (hc_wavetable);
+    FUNCTION(gsl_fft_real_workspace,free) (work);
+
+    return status;
+  }
+}
+
+static int
+FUNCTION(conv,complex) (const BASE x[], const size_t xstride, const size_t nx,
+                        const BASE y[], const size_t ystride, const size_t ny,
+                        BASE z[], const size_t zstride, const int reverse)
+{
+  /* when reverse is set y is also conjugated */
+
+  const ATOMIC c = reverse ? -1 : 1;
+  size_t i, j, k, n;
+
+  if (nx == 0 || ny == 0)
+    {
+      GSL_ERROR ("lengths must be positive integers", GSL_EDOM);
+    }
+
+  n = conv_fft_length (nx + ny - 1);
+
+  if (!conv_use_fft (nx, ny, n))
+    {
+      for (k = 0; k < nx + ny - 1; k++)
+        {
+          const size_t jmin = (k >= nx) ? k - nx + 1 : 0;
+          const size_t jmax = GSL_MIN (k, ny - 1);
+          ATOMIC sum_real = 0, sum_imag = 0;
+
+          for (j = jmin; j <= jmax; j++)
+            {
+              const size_t jy = reverse ? ny - 1 - j : j;
+              const ATOMIC x_real = REAL(x,xstride,k - j);
+              const ATOMIC x_imag = IMAG(x,xstride,k - j);
+              const ATOMIC y_real = REAL(y,ystride,jy);
+              const ATOMIC y_imag = c * IMAG(y,ystride,jy);
+
+              sum_real += x_real * y_real - x_imag * y_imag;
+              sum_imag += x_real * y_imag + x_imag * y_real;
+            }
+
+          REAL(z,zstride,k) = sum_real;
+          IMAG(z,zstride,k) = sum_imag;
+        }
+
+      return GSL_SUCCESS;
+    }
+
+  {
+    int status;
+    BASE *a = (BASE *) malloc (4 * n * sizeof (BASE));
+    BASE *b = a + 2 * n;
+    TYPE(gsl_fft_complex_wavetable) * wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+    TYPE(gsl_fft_complex_workspace) * work = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+
+    if (a == NULL || wavetable == NULL || work == NULL)
+      {
+        free (a);
+        FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+        FUNCTION(gsl_fft_complex_workspace,free) (work);
+        GSL_ERROR ("failed to allocate wavetable and workspace", GSL_ENOMEM);
+      }
+
+    for (i = 0; i < n; i++)
+      {
+        const size_t iy = reverse ? ny - 1 - i : i;
+
+        REAL(a,1,i) = (i < nx) ? REAL(x,xstride,i) : 0;
+        IMAG(a,1,i) = (i < nx) ? IMAG(x,xstride,i) : 0;
+        REAL(b,1,i) = (i < ny) ? REAL(y,ystride,iy) : 0;
+        IMAG(b,1,i) = (i < ny) ? c * IMAG(y,ystride,iy) : 0;
+      }
+
+    status = FUNCTION(gsl_fft_complex,forward) (a, 1, n, wavetable, work);
+
+    if (status == GSL_SUCCESS)
+      status = FUNCTION(gsl_fft_complex,forward) (b, 1, n, wavetable, work);
+
+    if (status == GSL_SUCCESS)
+      {
+        const ATOMIC s = 1.0 / n;
+
+        for (i = 0; i < n; i++)
+          {
+            const ATOMIC a_real = REAL(a,1,i), a_imag = IMAG(a,1,i);
+            const ATOMIC b_real = REAL(b,1,i), b_imag = IMAG(b,1,i);
+
+            REAL(a,1,i) = s * (a_real * b_real - a_imag * b_imag);
+            IMAG(a,1,i) = s * (a_real * b_imag + a_imag * b_real);
+          }
+
+        status = FUNCTION(gsl_fft_complex,backward) (a, 1, n, wavetable, work);
+      }
+
+    for (k = 0; k < nx + ny - 1; k++)
+      {
+        REAL(z,zstride,k) = REAL(a,1,k);
+        IMAG(z,zstride,k) = IMAG(a,1,k);
+      }
+
+    free (a);
+    FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+    FUNCTION(gsl_fft_complex_workspace,free) (work);
+
+    return status;
+  }
+}
+
+int
+TYPE(gsl_conv) (const BASE x[], const size_t xstride, const size_t nx,
+                const BASE y[], const size_t ystride, const size_t ny,
+                BASE z[], const size_t zstride)
+{
+  return FUNCTION(conv,real) (x, xstride, nx, y, ystride, ny, z, zstride, 0);
+}
+
+int
+TYPE(gsl_xcorr) (const BASE x[], const size_t xstride, const size_t nx,
+                 const BASE y[], const size_t ystride, const size_t ny,
+                 BASE z[], const size_t zstride)
+{
+  return FUNCTION(conv,real) (x, xstride, nx, y, ystride, ny, z, zstride, 1);
+}
+
+int
+TYPE(gsl_conv_complex) (TYPE(gsl_const_complex_packed_array) x, const size_t xstride, const size_t nx,
+                        TYPE(gsl_const_complex_packed_array) y, const size_t ystride, const size_t ny,
+                        TYPE(gsl_complex_packed_array) z, const size_t zstride)
+{
+  return FUNCTION(conv,complex) (x, xstride, nx, y, ystride, ny, z, zstride, 0);
+}
+
+int
+TYPE(gsl_xcorr_complex) (TYPE(gsl_const_complex_packed_array) x, const size_t xstride, const size_t nx,
+                         TYPE(gsl_const_complex_packed_array) y, const size_t ystride, const size_t ny,
+                         TYPE(gsl_complex_packed_array) z, const size_t zstride)
+{
+  return FUNCTION(conv,complex) (x, xstride, nx, y, ystride, ny, z, zstride, 1);
+}
+
+/* The streaming filter uses the overlap-save method.  Each block of m
+   <= block input samples is preceded by the last nh - 1 samples of the
+   stream and zero-padded to the transform length n >= block + nh - 1.
+   The circular convolution of this buffer with the kernel wraps around
+   only into its first nh - 1 elements, so the next m elements are the
+   filtered samples. */
+
+TYPE(gsl_conv_filter) *
+FUNCTION(gsl_conv_filter,alloc) (const BASE h[], const size_t stride,
+                                 const size_t nh, const size_t block)
+{
+  TYPE(gsl_conv_filter) * f;
+  size_t i, n;
+  int status;
+
+  if (nh == 0)
+    {
+      GSL_ERROR_NULL ("kernel length must be positive integer", GSL_EDOM);
+    }
+
+  if (block == 0)
+    {
+      GSL_ERROR_NULL ("block size must be positive integer", GSL_EDOM);
+    }
+
+  n = conv_fft_length (block + nh - 1);
+
+  f = (TYPE(gsl_conv_filter) *) calloc (1, sizeof (TYPE(gsl_conv_filter)));
+
+  if (f == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  f->nh = nh;
+  f->block = block;
+  f->n = n;
+
+  f->spectrum = (BASE *) malloc (n * sizeof (BASE));
+  f->history = (BASE *) malloc (nh * sizeof (BASE));
+  f->buf = (BASE *) malloc (n * sizeof (BASE));
+  f->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+  f->halfcomplex_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+  f->work = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+
+  if (f->spectrum == NULL || f->history == NULL || f->buf == NULL ||
+      f->real_wavetable == NULL || f->halfcomplex_wavetable == NULL ||
+      f->work == NULL)
+    {
+      FUNCTION(gsl_conv_filter,free) (f);
+      GSL_ERROR_NULL ("failed to allocate filter buffers", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      f->spectrum[i] = (i < nh) ? h[i * stride] : 0;
+    }
+
+  status = FUNCTION(gsl_fft_real,transform) (f->spectrum, 1, n,
+                                             f->real_wavetable, f->work);
+
+  if (status)
+    {
+      FUNCTION(gsl_conv_filter,free) (f);
+      GSL_ERROR_NULL ("failed to transform kernel", status);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      f->spectrum[i] /= n;
+    }
+
+  FUNCTION(gsl_conv_filter,reset) (f);
+
+  return f;
+}
+
+void
+FUNCTION(gsl_conv_filter,free) (TYPE(gsl_conv_filter) * f)
+{
+  RETURN_IF_NULL (f);
+
+  free (f->spectrum);
+  free (f->history);
+  free (f->buf);
+  FUNCTION(gsl_fft_real_wavetable,free) (f->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (f->halfcomplex_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (f->work);
+  free (f);
+}
+
+void
+FUNCTION(gsl_conv_filter,reset) (TYPE(gsl_conv_filter) * f)
+{
+  /* the stream is taken to be zero before its first sample */
+
+  size_t i;
+
+  for (i = 0; i < f->nh; i++)
+    {
+      f->history[i] = 0;
+    }
+}
+
+int
+FUNCTION(gsl_conv_filter,apply) (TYPE(gsl_conv_filter) * f,
+                                 const BASE x[], const size_t xstride,
+                                 BASE y[], const size_t ystride, const size_t n)
+{
+  const size_t h = f->nh - 1;
+  BASE * const buf = f->buf;
+  size_t i, j, m;
+
+  for (i = 0; i < n; i += m)
+    {
+      int status;
+
+      m = GSL_MIN (f->block, n - i);
+
+      for (j = 0; j < h; j++)
+        {
+          buf[j] = f->history[j];
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          buf[h + j] = x[(i + j) * xstride];
+        }
+
+      for (j = h + m; j < f->n; j++)
+        {
+          buf[j] = 0;
+        }
+
+      /* the last nh - 1 samples so far precede the next block */
+
+      for (j = 0; j < h; j++)
+        {
+          f->history[j] = buf[m + j];
+        }
+
+      status = FUNCTION(gsl_fft_real,transform) (buf, 1, f->n,
+                                                 f->real_wavetable, f->work);
+
+      if (status)
+        {
+          return status;
+        }
+
+      FUNCTION(conv,halfcomplex_mul) (buf, f->spectrum, f->n, 1.0);
+
+      status = FUNCTION(gsl_fft_halfcomplex,backward) (buf, 1, f->n,
+                                                       f->halfcomplex_wavetable,
+                                                       f->work);
+
+      if (status)
+        {
+          return status;
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          y[(i + j) * ystride] = buf[h + j];
+        }
+    }
+
+  return GSL_SUCCESS;
+}
@@ -18,6 +18,7 @@
  */
 
 #include <config.h>
+#include <math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_fft_complex.h>
 
@@ -171,6 +172,119 @@ fft_binary_logn (const size_t n)
   return binary_logn;
 }
 
+static size_t
+fft_bluestein_length (const size_t n)
+{
+  /* returns the power of 2 length nb >= 2n-1 of the convolution used to
+     transform length n by Bluestein's algorithm, or 0 if the
+     mixed-radix passes are expected to be faster.  The generic passes
+     for the prime factors p > 8 cost about n sum(p) operations and the
+     Bluestein transform about nb log2(nb).  Near the crossover the
+     mixed-radix passes are preferred, being more accurate. */
+
+  size_t nf, i, nb = 1, log2_nb = 0, generic = 0;
+  size_t factors[64];
+
+  if (fft_complex_factorize (n, &nf, factors))
+    {
+      return 0;
+    }
+
+  for (i = 0; i < nf; i++)
+    {
+      if (factors[i] > 8)
+        generic += factors[i];
+    }
 
+  if (generic == 0)
+    {
+      return 0;
+    }
 
+  while (nb < 2 * n - 1)
+    {
+      nb *= 2;
+      log2_nb++;
+    }
 
+  if (n * generic <= 2 * nb * log2_nb)
+    {
+      return 0;
+    }
+
+  return nb;
+}
+
+/* the shortest transform which gsl_fft_complex_wavetable_alloc_four_step
+   computes in four steps */
+
+#define FFT_FOUR_STEP_MIN (1 << 12)
+
+static size_t
+fft_four_step_length (const size_t n)
+{
+  /* returns the factor n1 <= sqrt(n) of n, as large as possible, for
+     which a transform of length n can be computed from transforms of
+     lengths n1 and n2 = n/n1, or 0 if it cannot.  The shorter
+     transforms must be mixed-radix ones. */
+
+  size_t n1, n2;
+
+  if (n < FFT_FOUR_STEP_MIN)
+    {
+      return 0;
+    }
+
+  n1 = (size_t) sqrt ((double) n);
+
+  while (n1 * n1 > n)
+    {
+      n1--;
+    }
+
+  while (n % n1 != 0)
+    {
+      n1--;
+    }
+
+  n2 = n / n1;
+
+  if (n1 < FFT_BLOCK ||
+      fft_bluestein_length (n1) || fft_bluestein_length (n2))
+    {
+      return 0;
+    }
+
+  return n1;
+}
+
+static size_t
+fft_complex_scratch_size (const size_t n)
+{
+  /* returns the number of real elements of scratch space needed for a
+     complex transform of length n.  A Bluestein transform needs space
+     for its convolution and for the transforms of the convolution, a
+     four-step transform a copy of the data, a block of columns and
+     the scratch space for a block of rows.  The space for four steps
+     is reserved whenever the length allows them, since a workspace
+     does not know which wavetable it will be used with. */
+
+  const size_t nb = fft_bluestein_length (n);
+  size_t n1;
+
+  if (nb)
+    {
+      return 4 * nb;
+    }
+
+  n1 = fft_four_step_length (n);
+
+  if (n1)
+    {
+      const size_t n2 = n / n1;
+
+      return 2 * n + 2 * FFT_BLOCK * (n1 + n2);
+    }
+
+  return 2 * n;
+}
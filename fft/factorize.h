@@ -27,3 +27,9 @@ static int fft_factorize (const size_t n, const size_t implemented_subtransforms
 
 static int fft_binary_logn (const size_t n) ;
 
+static size_t fft_bluestein_length (const size_t n) ;
+
+static size_t fft_four_step_length (const size_t n) ;
+
+static size_t fft_complex_scratch_size (const size_t n) ;
+
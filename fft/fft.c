@@ -22,12 +22,18 @@
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
+/* number of columns gathered at a time by the multidimensional and
+   four-step transforms */
+#define FFT_BLOCK 16
+
 #include "factorize.c"
 
 #define BASE_DOUBLE
 #include "templates_on.h"
 #include "c_init.c"
 #include "c_main.c"
+#include "c_bluestein.c"
+#include "c_fourstep.c"
 #include "c_pass_2.c"
 #include "c_pass_3.c"
 #include "c_pass_4.c"
@@ -43,6 +49,8 @@
 #include "templates_on.h"
 #include "c_init.c"
 #include "c_main.c"
+#include "c_bluestein.c"
+#include "c_fourstep.c"
 #include "c_pass_2.c"
 #include "c_pass_3.c"
 #include "c_pass_4.c"
@@ -115,3 +123,52 @@
 #include "real_unpack.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
+
+#include <gsl/gsl_fft_cache.h>
+
+#include "cache.c"
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "cache_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "cache_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#include <gsl/gsl_fft2d.h>
+#include <gsl/gsl_fft3d.h>
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "fft2d_source.c"
+#include "fft3d_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "fft2d_source.c"
+#include "fft3d_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#include <gsl/gsl_conv.h>
+
+#include "conv.c"
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "conv_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "conv_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
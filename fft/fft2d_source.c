@@ -0,0 +1,531 @@
+/* fft/fft2d_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The rows of a two-dimensional array are transformed in place, since
+   they are contiguous.  The columns are transformed FFT_BLOCK at a time:
+   a block of adjacent columns is gathered into contiguous rows of a
+   buffer, reading FFT_BLOCK consecutive elements from each row of the
+   array, transformed there and scattered back.  This avoids the cache
+   misses of transforming each column directly with a stride of tda. */
+
+static int
+FUNCTION(fft_complex,columns) (BASE data[], const size_t dist,
+                               const size_t n, const size_t ncols,
+                               const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                               TYPE(gsl_fft_complex_workspace) * work,
+                               BASE block[], const gsl_fft_direction sign)
+{
+  /* transforms the ncols adjacent sequences of length n whose elements
+     are dist complex elements apart */
+
+  size_t i, j, b;
+
+  for (j = 0; j < ncols; j += FFT_BLOCK)
+    {
+      const size_t nb = GSL_MIN (FFT_BLOCK, ncols - j);
+
+      for (i = 0; i < n; i++)
+        {
+          const BASE *src = data + 2 * (i * dist + j);
+
+          for (b = 0; b < nb; b++)
+            {
+              REAL(block,1,b * n + i) = REAL(src,1,b);
+              IMAG(block,1,b * n + i) = IMAG(src,1,b);
+            }
+        }
+
+      for (b = 0; b < nb; b++)
+        {
+          int status = FUNCTION(gsl_fft_complex,transform) (block + 2 * b * n, 1, n,
+                                                            wavetable, work, sign);
+          if (status)
+            {
+              return status;
+            }
+        }
+
+      for (i = 0; i < n; i++)
+        {
+          BASE *dest = data + 2 * (i * dist + j);
+
+          for (b = 0; b < nb; b++)
+            {
+              REAL(dest,1,b) = REAL(block,1,b * n + i);
+              IMAG(dest,1,b) = IMAG(block,1,b * n + i);
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+FUNCTION(fft_complex,scale) (BASE data[], const size_t tda,
+                             const size_t n1, const size_t n2,
+                             const ATOMIC a)
+{
+  size_t i, j;
+
+  for (i = 0; i < n1; i++)
+    {
+      BASE *row = data + 2 * i * tda;
+
+      for (j = 0; j < 2 * n2; j++)
+        {
+          row[j] *= a;
+        }
+    }
+}
+
+TYPE(gsl_fft2d_complex_workspace) *
+FUNCTION(gsl_fft2d_complex_workspace,alloc) (const size_t n1, const size_t n2)
+{
+  TYPE(gsl_fft2d_complex_workspace) * w;
+
+  if (n1 == 0 || n2 == 0)
+    {
+      GSL_ERROR_NULL ("dimensions must be positive integers", GSL_EDOM);
+    }
+
+  w = (TYPE(gsl_fft2d_complex_workspace) *) calloc (1, sizeof (TYPE(gsl_fft2d_complex_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+
+  w->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->wavetable2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+  w->work1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  w->work2 = FUNCTION(gsl_fft_complex_workspace,alloc) (n2);
+  w->block = (BASE *) malloc (2 * FFT_BLOCK * n1 * sizeof (BASE));
+
+  if (w->wavetable1 == NULL || w->wavetable2 == NULL ||
+      w->work1 == NULL || w->work2 == NULL || w->block == NULL)
+    {
+      FUNCTION(gsl_fft2d_complex_workspace,free) (w);
+      GSL_ERROR_NULL ("failed to allocate wavetables and workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft2d_complex_workspace,free) (TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable2);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work1);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work2);
+  free (w->block);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft2d_complex,transform) (TYPE(gsl_complex_packed_array) data,
+                                       const size_t tda,
+                                       const size_t n1, const size_t n2,
+                                       TYPE(gsl_fft2d_complex_workspace) * w,
+                                       const gsl_fft_direction sign)
+{
+  size_t i;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+  else if (tda < n2)
+    {
+      GSL_ERROR ("tda must be greater than or equal to n2", GSL_EINVAL);
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      status = FUNCTION(gsl_fft_complex,transform) (data + 2 * i * tda, 1, n2,
+                                                    w->wavetable2, w->work2, sign);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  status = FUNCTION(fft_complex,columns) (data, tda, n1, n2, w->wavetable1,
+                                          w->work1, w->block, sign);
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft2d_complex,forward) (TYPE(gsl_complex_packed_array) data,
+                                     const size_t tda,
+                                     const size_t n1, const size_t n2,
+                                     TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  return FUNCTION(gsl_fft2d_complex,transform) (data, tda, n1, n2, w,
+                                                gsl_fft_forward);
+}
+
+int
+FUNCTION(gsl_fft2d_complex,backward) (TYPE(gsl_complex_packed_array) data,
+                                      const size_t tda,
+                                      const size_t n1, const size_t n2,
+                                      TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  return FUNCTION(gsl_fft2d_complex,transform) (data, tda, n1, n2, w,
+                                                gsl_fft_backward);
+}
+
+int
+FUNCTION(gsl_fft2d_complex,inverse) (TYPE(gsl_complex_packed_array) data,
+                                     const size_t tda,
+                                     const size_t n1, const size_t n2,
+                                     TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft2d_complex,transform) (data, tda, n1, n2, w,
+                                                      gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2) */
+
+  FUNCTION(fft_complex,scale) (data, tda, n1, n2, ONE / ((ATOMIC) n1 * n2));
+
+  return status;
+}
+
+static int
+FUNCTION(fft2d_complex,memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                const size_t dest_tda,
+                                TYPE(gsl_const_complex_packed_array) src,
+                                const size_t src_tda,
+                                const size_t n1, const size_t n2)
+{
+  size_t i;
+
+  if (dest_tda < n2 || src_tda < n2)
+    {
+      GSL_ERROR ("tda must be greater than or equal to n2", GSL_EINVAL);
+    }
+
+  if (dest != src)
+    {
+      for (i = 0; i < n1; i++)
+        {
+          memcpy (dest + 2 * i * dest_tda, src + 2 * i * src_tda,
+                  2 * n2 * sizeof (BASE));
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft2d_complex,forward_memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                            const size_t dest_tda,
+                                            TYPE(gsl_const_complex_packed_array) src,
+                                            const size_t src_tda,
+                                            const size_t n1, const size_t n2,
+                                            TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  int status = FUNCTION(fft2d_complex,memcpy) (dest, dest_tda, src, src_tda, n1, n2);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft2d_complex,forward) (dest, dest_tda, n1, n2, w);
+}
+
+int
+FUNCTION(gsl_fft2d_complex,backward_memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                             const size_t dest_tda,
+                                             TYPE(gsl_const_complex_packed_array) src,
+                                             const size_t src_tda,
+                                             const size_t n1, const size_t n2,
+                                             TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  int status = FUNCTION(fft2d_complex,memcpy) (dest, dest_tda, src, src_tda, n1, n2);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft2d_complex,backward) (dest, dest_tda, n1, n2, w);
+}
+
+int
+FUNCTION(gsl_fft2d_complex,inverse_memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                            const size_t dest_tda,
+                                            TYPE(gsl_const_complex_packed_array) src,
+                                            const size_t src_tda,
+                                            const size_t n1, const size_t n2,
+                                            TYPE(gsl_fft2d_complex_workspace) * w)
+{
+  int status = FUNCTION(fft2d_complex,memcpy) (dest, dest_tda, src, src_tda, n1, n2);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft2d_complex,inverse) (dest, dest_tda, n1, n2, w);
+}
+
+/* The real transforms store the n2/2 + 1 non-negative frequencies of
+   each row as complex numbers; the remaining ones follow from the
+   symmetry z(k1,k2) = conj(z(n1-k1,n2-k2)).  A row is transformed with
+   the one-dimensional real transform and unpacked from halfcomplex
+   order, then the columns are transformed as complex data.  The
+   inverse reverses these steps. */
+
+static void
+FUNCTION(fft_halfcomplex,unpack_half) (const BASE hc[], BASE z[], const size_t n)
+{
+  size_t k;
+
+  REAL(z,1,0) = hc[0];
+  IMAG(z,1,0) = 0.0;
+
+  for (k = 1; k < n - k; k++)
+    {
+      REAL(z,1,k) = hc[2 * k - 1];
+      IMAG(z,1,k) = hc[2 * k];
+    }
+
+  if (k == n - k)
+    {
+      REAL(z,1,k) = hc[n - 1];
+      IMAG(z,1,k) = 0.0;
+    }
+}
+
+static void
+FUNCTION(fft_halfcomplex,pack_half) (const BASE z[], BASE hc[], const size_t n)
+{
+  size_t k;
+
+  hc[0] = REAL(z,1,0);
+
+  for (k = 1; k < n - k; k++)
+    {
+      hc[2 * k - 1] = REAL(z,1,k);
+      hc[2 * k] = IMAG(z,1,k);
+    }
+
+  if (k == n - k)
+    {
+      hc[n - 1] = REAL(z,1,k);
+    }
+}
+
+TYPE(gsl_fft2d_real_workspace) *
+FUNCTION(gsl_fft2d_real_workspace,alloc) (const size_t n1, const size_t n2)
+{
+  TYPE(gsl_fft2d_real_workspace) * w;
+
+  if (n1 == 0 || n2 == 0)
+    {
+      GSL_ERROR_NULL ("dimensions must be positive integers", GSL_EDOM);
+    }
+
+  w = (TYPE(gsl_fft2d_real_workspace) *) calloc (1, sizeof (TYPE(gsl_fft2d_real_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+
+  w->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (n2);
+  w->halfcomplex_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n2);
+  w->real_work = FUNCTION(gsl_fft_real_workspace,alloc) (n2);
+  w->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->work1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  w->row = (BASE *) malloc (n2 * sizeof (BASE));
+  w->block = (BASE *) malloc (2 * FFT_BLOCK * n1 * sizeof (BASE));
+
+  if (w->real_wavetable == NULL || w->halfcomplex_wavetable == NULL ||
+      w->real_work == NULL || w->wavetable1 == NULL || w->work1 == NULL ||
+      w->row == NULL || w->block == NULL)
+    {
+      FUNCTION(gsl_fft2d_real_workspace,free) (w);
+      GSL_ERROR_NULL ("failed to allocate wavetables and workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft2d_real_workspace,free) (TYPE(gsl_fft2d_real_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(gsl_fft_real_wavetable,free) (w->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (w->halfcomplex_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (w->real_work);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable1);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work1);
+  free (w->row);
+  free (w->block);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft2d_real,transform) (const BASE in[], const size_t in_tda,
+                                    TYPE(gsl_complex_packed_array) out,
+                                    const size_t out_tda,
+                                    const size_t n1, const size_t n2,
+                                    TYPE(gsl_fft2d_real_workspace) * w)
+{
+  const size_t nh = n2 / 2 + 1;
+  size_t i;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+  else if (in_tda < n2)
+    {
+      GSL_ERROR ("in_tda must be greater than or equal to n2", GSL_EINVAL);
+    }
+  else if (out_tda < nh)
+    {
+      GSL_ERROR ("out_tda must be greater than or equal to n2/2 + 1", GSL_EINVAL);
+    }
+
+  /* each row is copied to w->row before it is overwritten, so in and
+     out may be the same array when in_tda = 2 out_tda */
+
+  for (i = 0; i < n1; i++)
+    {
+      memcpy (w->row, in + i * in_tda, n2 * sizeof (BASE));
+
+      status = FUNCTION(gsl_fft_real,transform) (w->row, 1, n2,
+                                                 w->real_wavetable, w->real_work);
+      if (status)
+        {
+          return status;
+        }
+
+      FUNCTION(fft_halfcomplex,unpack_half) (w->row, out + 2 * i * out_tda, n2);
+    }
+
+  status = FUNCTION(fft_complex,columns) (out, out_tda, n1, nh, w->wavetable1,
+                                          w->work1, w->block, gsl_fft_forward);
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft2d_halfcomplex,backward) (TYPE(gsl_complex_packed_array) in,
+                                          const size_t in_tda,
+                                          BASE out[], const size_t out_tda,
+                                          const size_t n1, const size_t n2,
+                                          TYPE(gsl_fft2d_real_workspace) * w)
+{
+  const size_t nh = n2 / 2 + 1;
+  size_t i;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+  else if (in_tda < nh)
+    {
+      GSL_ERROR ("in_tda must be greater than or equal to n2/2 + 1", GSL_EINVAL);
+    }
+  else if (out_tda < n2)
+    {
+      GSL_ERROR ("out_tda must be greater than or equal to n2", GSL_EINVAL);
+    }
+
+  /* the column transforms are done in place on the input */
+
+  status = FUNCTION(fft_complex,columns) (in, in_tda, n1, nh, w->wavetable1,
+                                          w->work1, w->block, gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      FUNCTION(fft_halfcomplex,pack_half) (in + 2 * i * in_tda, w->row, n2);
+
+      status = FUNCTION(gsl_fft_halfcomplex,transform) (w->row, 1, n2,
+                                                        w->halfcomplex_wavetable,
+                                                        w->real_work);
+      if (status)
+        {
+          return status;
+        }
+
+      memcpy (out + i * out_tda, w->row, n2 * sizeof (BASE));
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft2d_halfcomplex,inverse) (TYPE(gsl_complex_packed_array) in,
+                                         const size_t in_tda,
+                                         BASE out[], const size_t out_tda,
+                                         const size_t n1, const size_t n2,
+                                         TYPE(gsl_fft2d_real_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft2d_halfcomplex,backward) (in, in_tda, out, out_tda,
+                                                         n1, n2, w);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2) */
+
+  {
+    const ATOMIC norm = ONE / ((ATOMIC) n1 * n2);
+    size_t i, j;
+
+    for (i = 0; i < n1; i++)
+      {
+        for (j = 0; j < n2; j++)
+          {
+            out[i * out_tda + j] *= norm;
+          }
+      }
+  }
+
+  return status;
+}
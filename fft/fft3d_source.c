@@ -0,0 +1,399 @@
+/* fft/fft3d_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The three-dimensional transforms use the rows and blocked columns of
+   fft2d_source.c: the rows of length n3 are contiguous, the n2 index of
+   each plane is transformed as the columns of an n2 x n3 array and the
+   n1 index as the columns of an n1 x (n2 n3) array. */
+
+TYPE(gsl_fft3d_complex_workspace) *
+FUNCTION(gsl_fft3d_complex_workspace,alloc) (const size_t n1, const size_t n2,
+                                             const size_t n3)
+{
+  TYPE(gsl_fft3d_complex_workspace) * w;
+
+  if (n1 == 0 || n2 == 0 || n3 == 0)
+    {
+      GSL_ERROR_NULL ("dimensions must be positive integers", GSL_EDOM);
+    }
+
+  w = (TYPE(gsl_fft3d_complex_workspace) *) calloc (1, sizeof (TYPE(gsl_fft3d_complex_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+  w->n3 = n3;
+
+  w->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->wavetable2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+  w->wavetable3 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n3);
+  w->work1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  w->work2 = FUNCTION(gsl_fft_complex_workspace,alloc) (n2);
+  w->work3 = FUNCTION(gsl_fft_complex_workspace,alloc) (n3);
+  w->block = (BASE *) malloc (2 * FFT_BLOCK * GSL_MAX (n1, n2) * sizeof (BASE));
+
+  if (w->wavetable1 == NULL || w->wavetable2 == NULL || w->wavetable3 == NULL ||
+      w->work1 == NULL || w->work2 == NULL || w->work3 == NULL ||
+      w->block == NULL)
+    {
+      FUNCTION(gsl_fft3d_complex_workspace,free) (w);
+      GSL_ERROR_NULL ("failed to allocate wavetables and workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft3d_complex_workspace,free) (TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable2);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable3);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work1);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work2);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work3);
+  free (w->block);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft3d_complex,transform) (TYPE(gsl_complex_packed_array) data,
+                                       const size_t n1, const size_t n2,
+                                       const size_t n3,
+                                       TYPE(gsl_fft3d_complex_workspace) * w,
+                                       const gsl_fft_direction sign)
+{
+  size_t i;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2 || n3 != w->n3)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < n1 * n2; i++)
+    {
+      status = FUNCTION(gsl_fft_complex,transform) (data + 2 * i * n3, 1, n3,
+                                                    w->wavetable3, w->work3, sign);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      status = FUNCTION(fft_complex,columns) (data + 2 * i * n2 * n3, n3, n2, n3,
+                                              w->wavetable2, w->work2, w->block,
+                                              sign);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  status = FUNCTION(fft_complex,columns) (data, n2 * n3, n1, n2 * n3,
+                                          w->wavetable1, w->work1, w->block, sign);
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft3d_complex,forward) (TYPE(gsl_complex_packed_array) data,
+                                     const size_t n1, const size_t n2,
+                                     const size_t n3,
+                                     TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  return FUNCTION(gsl_fft3d_complex,transform) (data, n1, n2, n3, w,
+                                                gsl_fft_forward);
+}
+
+int
+FUNCTION(gsl_fft3d_complex,backward) (TYPE(gsl_complex_packed_array) data,
+                                      const size_t n1, const size_t n2,
+                                      const size_t n3,
+                                      TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  return FUNCTION(gsl_fft3d_complex,transform) (data, n1, n2, n3, w,
+                                                gsl_fft_backward);
+}
+
+int
+FUNCTION(gsl_fft3d_complex,inverse) (TYPE(gsl_complex_packed_array) data,
+                                     const size_t n1, const size_t n2,
+                                     const size_t n3,
+                                     TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft3d_complex,transform) (data, n1, n2, n3, w,
+                                                      gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2 n3) */
+
+  FUNCTION(fft_complex,scale) (data, n3, n1 * n2, n3,
+                               ONE / ((ATOMIC) n1 * n2 * n3));
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft3d_complex,forward_memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                            TYPE(gsl_const_complex_packed_array) src,
+                                            const size_t n1, const size_t n2,
+                                            const size_t n3,
+                                            TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  if (dest != src)
+    {
+      memcpy (dest, src, 2 * n1 * n2 * n3 * sizeof (BASE));
+    }
+
+  return FUNCTION(gsl_fft3d_complex,forward) (dest, n1, n2, n3, w);
+}
+
+int
+FUNCTION(gsl_fft3d_complex,backward_memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                             TYPE(gsl_const_complex_packed_array) src,
+                                             const size_t n1, const size_t n2,
+                                             const size_t n3,
+                                             TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  if (dest != src)
+    {
+      memcpy (dest, src, 2 * n1 * n2 * n3 * sizeof (BASE));
+    }
+
+  return FUNCTION(gsl_fft3d_complex,backward) (dest, n1, n2, n3, w);
+}
+
+int
+FUNCTION(gsl_fft3d_complex,inverse_memcpy) (TYPE(gsl_complex_packed_array) dest,
+                                            TYPE(gsl_const_complex_packed_array) src,
+                                            const size_t n1, const size_t n2,
+                                            const size_t n3,
+                                            TYPE(gsl_fft3d_complex_workspace) * w)
+{
+  if (dest != src)
+    {
+      memcpy (dest, src, 2 * n1 * n2 * n3 * sizeof (BASE));
+    }
+
+  return FUNCTION(gsl_fft3d_complex,inverse) (dest, n1, n2, n3, w);
+}
+
+TYPE(gsl_fft3d_real_workspace) *
+FUNCTION(gsl_fft3d_real_workspace,alloc) (const size_t n1, const size_t n2,
+                                          const size_t n3)
+{
+  TYPE(gsl_fft3d_real_workspace) * w;
+
+  if (n1 == 0 || n2 == 0 || n3 == 0)
+    {
+      GSL_ERROR_NULL ("dimensions must be positive integers", GSL_EDOM);
+    }
+
+  w = (TYPE(gsl_fft3d_real_workspace) *) calloc (1, sizeof (TYPE(gsl_fft3d_real_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+  w->n3 = n3;
+
+  w->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (n3);
+  w->halfcomplex_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n3);
+  w->real_work = FUNCTION(gsl_fft_real_workspace,alloc) (n3);
+  w->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->wavetable2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+  w->work1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  w->work2 = FUNCTION(gsl_fft_complex_workspace,alloc) (n2);
+  w->row = (BASE *) malloc (n3 * sizeof (BASE));
+  w->block = (BASE *) malloc (2 * FFT_BLOCK * GSL_MAX (n1, n2) * sizeof (BASE));
+
+  if (w->real_wavetable == NULL || w->halfcomplex_wavetable == NULL ||
+      w->real_work == NULL || w->wavetable1 == NULL || w->wavetable2 == NULL ||
+      w->work1 == NULL || w->work2 == NULL || w->row == NULL || w->block == NULL)
+    {
+      FUNCTION(gsl_fft3d_real_workspace,free) (w);
+      GSL_ERROR_NULL ("failed to allocate wavetables and workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft3d_real_workspace,free) (TYPE(gsl_fft3d_real_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(gsl_fft_real_wavetable,free) (w->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (w->halfcomplex_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (w->real_work);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable2);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work1);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work2);
+  free (w->row);
+  free (w->block);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft3d_real,transform) (const BASE in[],
+                                    TYPE(gsl_complex_packed_array) out,
+                                    const size_t n1, const size_t n2,
+                                    const size_t n3,
+                                    TYPE(gsl_fft3d_real_workspace) * w)
+{
+  const size_t nh = n3 / 2 + 1;
+  size_t i;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2 || n3 != w->n3)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < n1 * n2; i++)
+    {
+      memcpy (w->row, in + i * n3, n3 * sizeof (BASE));
+
+      status = FUNCTION(gsl_fft_real,transform) (w->row, 1, n3,
+                                                 w->real_wavetable, w->real_work);
+      if (status)
+        {
+          return status;
+        }
+
+      FUNCTION(fft_halfcomplex,unpack_half) (w->row, out + 2 * i * nh, n3);
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      status = FUNCTION(fft_complex,columns) (out + 2 * i * n2 * nh, nh, n2, nh,
+                                              w->wavetable2, w->work2, w->block,
+                                              gsl_fft_forward);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  status = FUNCTION(fft_complex,columns) (out, n2 * nh, n1, n2 * nh,
+                                          w->wavetable1, w->work1, w->block,
+                                          gsl_fft_forward);
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft3d_halfcomplex,backward) (TYPE(gsl_complex_packed_array) in,
+                                          BASE out[],
+                                          const size_t n1, const size_t n2,
+                                          const size_t n3,
+                                          TYPE(gsl_fft3d_real_workspace) * w)
+{
+  const size_t nh = n3 / 2 + 1;
+  size_t i;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2 || n3 != w->n3)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  /* the column transforms are done in place on the input */
+
+  status = FUNCTION(fft_complex,columns) (in, n2 * nh, n1, n2 * nh,
+                                          w->wavetable1, w->work1, w->block,
+                                          gsl_fft_backward);
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      status = FUNCTION(fft_complex,columns) (in + 2 * i * n2 * nh, nh, n2, nh,
+                                              w->wavetable2, w->work2, w->block,
+                                              gsl_fft_backward);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  for (i = 0; i < n1 * n2; i++)
+    {
+      FUNCTION(fft_halfcomplex,pack_half) (in + 2 * i * nh, w->row, n3);
+
+      status = FUNCTION(gsl_fft_halfcomplex,transform) (w->row, 1, n3,
+                                                        w->halfcomplex_wavetable,
+                                                        w->real_work);
+      if (status)
+        {
+          return status;
+        }
+
+      memcpy (out + i * n3, w->row, n3 * sizeof (BASE));
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft3d_halfcomplex,inverse) (TYPE(gsl_complex_packed_array) in,
+                                         BASE out[],
+                                         const size_t n1, const size_t n2,
+                                         const size_t n3,
+                                         TYPE(gsl_fft3d_real_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft3d_halfcomplex,backward) (in, out, n1, n2, n3, w);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2 n3) */
+
+  {
+    const ATOMIC norm = ONE / ((ATOMIC) n1 * n2 * n3);
+    const size_t size = n1 * n2 * n3;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+      {
+        out[i] *= norm;
+      }
+  }
+
+  return status;
+}
@@ -0,0 +1,120 @@
+/* fft/gsl_conv.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_CONV_H__
+#define __GSL_CONV_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Linear convolution and cross-correlation of sequences x and y of
+   lengths nx and ny.  The result z has nx + ny - 1 elements. */
+
+int gsl_conv (const double x[], const size_t xstride, const size_t nx,
+              const double y[], const size_t ystride, const size_t ny,
+              double z[], const size_t zstride);
+int gsl_conv_complex (gsl_const_complex_packed_array x, const size_t xstride, const size_t nx,
+                      gsl_const_complex_packed_array y, const size_t ystride, const size_t ny,
+                      gsl_complex_packed_array z, const size_t zstride);
+int gsl_xcorr (const double x[], const size_t xstride, const size_t nx,
+               const double y[], const size_t ystride, const size_t ny,
+               double z[], const size_t zstride);
+int gsl_xcorr_complex (gsl_const_complex_packed_array x, const size_t xstride, const size_t nx,
+                       gsl_const_complex_packed_array y, const size_t ystride, const size_t ny,
+                       gsl_complex_packed_array z, const size_t zstride);
+
+int gsl_conv_float (const float x[], const size_t xstride, const size_t nx,
+                    const float y[], const size_t ystride, const size_t ny,
+                    float z[], const size_t zstride);
+int gsl_conv_complex_float (gsl_const_complex_packed_array_float x, const size_t xstride, const size_t nx,
+                            gsl_const_complex_packed_array_float y, const size_t ystride, const size_t ny,
+                            gsl_complex_packed_array_float z, const size_t zstride);
+int gsl_xcorr_float (const float x[], const size_t xstride, const size_t nx,
+                     const float y[], const size_t ystride, const size_t ny,
+                     float z[], const size_t zstride);
+int gsl_xcorr_complex_float (gsl_const_complex_packed_array_float x, const size_t xstride, const size_t nx,
+                             gsl_const_complex_packed_array_float y, const size_t ystride, const size_t ny,
+                             gsl_complex_packed_array_float z, const size_t zstride);
+
+/* Streaming FIR filter, y[i] = sum_k h[k] x[i-k], computed by the
+   overlap-save method in blocks of up to block samples with the
+   spectrum of the kernel h computed once. */
+
+typedef struct
+{
+  size_t nh;                    /* length of the kernel */
+  size_t block;                 /* number of samples per transform */
+  size_t n;                     /* length of the transforms */
+  double *spectrum;             /* halfcomplex transform of the kernel, scaled by 1/n */
+  double *history;              /* the last nh - 1 input samples */
+  double *buf;
+  gsl_fft_real_wavetable *real_wavetable;
+  gsl_fft_halfcomplex_wavetable *halfcomplex_wavetable;
+  gsl_fft_real_workspace *work;
+}
+gsl_conv_filter;
+
+gsl_conv_filter *gsl_conv_filter_alloc (const double h[], const size_t stride,
+                                        const size_t nh, const size_t block);
+void gsl_conv_filter_free (gsl_conv_filter * f);
+void gsl_conv_filter_reset (gsl_conv_filter * f);
+int gsl_conv_filter_apply (gsl_conv_filter * f,
+                           const double x[], const size_t xstride,
+                           double y[], const size_t ystride, const size_t n);
+
+typedef struct
+{
+  size_t nh;
+  size_t block;
+  size_t n;
+  float *spectrum;
+  float *history;
+  float *buf;
+  gsl_fft_real_wavetable_float *real_wavetable;
+  gsl_fft_halfcomplex_wavetable_float *halfcomplex_wavetable;
+  gsl_fft_real_workspace_float *work;
+}
+gsl_conv_filter_float;
+
+gsl_conv_filter_float *gsl_conv_filter_float_alloc (const float h[], const size_t stride,
+                                                    const size_t nh, const size_t block);
+void gsl_conv_filter_float_free (gsl_conv_filter_float * f);
+void gsl_conv_filter_float_reset (gsl_conv_filter_float * f);
+int gsl_conv_filter_float_apply (gsl_conv_filter_float * f,
+                                 const float x[], const size_t xstride,
+                                 float y[], const size_t ystride, const size_t n);
+
+__END_DECLS
+
+#endif /* __GSL_CONV_H__ */
@@ -0,0 +1,204 @@
+/* fft/gsl_fft3d.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT3D_H__
+#define __GSL_FFT3D_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Transforms of three-dimensional arrays of n1 x n2 x n3 elements,
+   stored contiguously in row-major order, so that the index n3 varies
+   fastest. */
+
+typedef struct
+{
+  size_t n1;
+  size_t n2;
+  size_t n3;
+  gsl_fft_complex_wavetable *wavetable1;
+  gsl_fft_complex_wavetable *wavetable2;
+  gsl_fft_complex_wavetable *wavetable3;
+  gsl_fft_complex_workspace *work1;
+  gsl_fft_complex_workspace *work2;
+  gsl_fft_complex_workspace *work3;
+  double *block;
+}
+gsl_fft3d_complex_workspace;
+
+typedef struct
+{
+  size_t n1;
+  size_t n2;
+  size_t n3;
+  gsl_fft_real_wavetable *real_wavetable;
+  gsl_fft_halfcomplex_wavetable *halfcomplex_wavetable;
+  gsl_fft_real_workspace *real_work;
+  gsl_fft_complex_wavetable *wavetable1;
+  gsl_fft_complex_wavetable *wavetable2;
+  gsl_fft_complex_workspace *work1;
+  gsl_fft_complex_workspace *work2;
+  double *row;
+  double *block;
+}
+gsl_fft3d_real_workspace;
+
+gsl_fft3d_complex_workspace *gsl_fft3d_complex_workspace_alloc (const size_t n1, const size_t n2,
+                                                                const size_t n3);
+void gsl_fft3d_complex_workspace_free (gsl_fft3d_complex_workspace * work);
+
+int gsl_fft3d_complex_forward (gsl_complex_packed_array data,
+                               const size_t n1, const size_t n2, const size_t n3,
+                               gsl_fft3d_complex_workspace * work);
+int gsl_fft3d_complex_backward (gsl_complex_packed_array data,
+                                const size_t n1, const size_t n2, const size_t n3,
+                                gsl_fft3d_complex_workspace * work);
+int gsl_fft3d_complex_inverse (gsl_complex_packed_array data,
+                               const size_t n1, const size_t n2, const size_t n3,
+                               gsl_fft3d_complex_workspace * work);
+int gsl_fft3d_complex_transform (gsl_complex_packed_array data,
+                                 const size_t n1, const size_t n2, const size_t n3,
+                                 gsl_fft3d_complex_workspace * work,
+                                 const gsl_fft_direction sign);
+
+int gsl_fft3d_complex_forward_memcpy (gsl_complex_packed_array dest,
+                                      gsl_const_complex_packed_array src,
+                                      const size_t n1, const size_t n2, const size_t n3,
+                                      gsl_fft3d_complex_workspace * work);
+int gsl_fft3d_complex_backward_memcpy (gsl_complex_packed_array dest,
+                                       gsl_const_complex_packed_array src,
+                                       const size_t n1, const size_t n2, const size_t n3,
+                                       gsl_fft3d_complex_workspace * work);
+int gsl_fft3d_complex_inverse_memcpy (gsl_complex_packed_array dest,
+                                      gsl_const_complex_packed_array src,
+                                      const size_t n1, const size_t n2, const size_t n3,
+                                      gsl_fft3d_complex_workspace * work);
+
+gsl_fft3d_real_workspace *gsl_fft3d_real_workspace_alloc (const size_t n1, const size_t n2,
+                                                          const size_t n3);
+void gsl_fft3d_real_workspace_free (gsl_fft3d_real_workspace * work);
+
+int gsl_fft3d_real_transform (const double in[], gsl_complex_packed_array out,
+                              const size_t n1, const size_t n2, const size_t n3,
+                              gsl_fft3d_real_workspace * work);
+int gsl_fft3d_halfcomplex_backward (gsl_complex_packed_array in, double out[],
+                                    const size_t n1, const size_t n2, const size_t n3,
+                                    gsl_fft3d_real_workspace * work);
+int gsl_fft3d_halfcomplex_inverse (gsl_complex_packed_array in, double out[],
+                                   const size_t n1, const size_t n2, const size_t n3,
+                                   gsl_fft3d_real_workspace * work);
+
+typedef struct
+{
+  size_t n1;
+  size_t n2;
+  size_t n3;
+  gsl_fft_complex_wavetable_float *wavetable1;
+  gsl_fft_complex_wavetable_float *wavetable2;
+  gsl_fft_complex_wavetable_float *wavetable3;
+  gsl_fft_complex_workspace_float *work1;
+  gsl_fft_complex_workspace_float *work2;
+  gsl_fft_complex_workspace_float *work3;
+  float *block;
+}
+gsl_fft3d_complex_workspace_float;
+
+typedef struct
+{
+  size_t n1;
+  size_t n2;
+  size_t n3;
+  gsl_fft_real_wavetable_float *real_wavetable;
+  gsl_fft_halfcomplex_wavetable_float *halfcomplex_wavetable;
+  gsl_fft_real_workspace_float *real_work;
+  gsl_fft_complex_wavetable_float *wavetable1;
+  gsl_fft_complex_wavetable_float *wavetable2;
+  gsl_fft_complex_workspace_float *work1;
+  gsl_fft_complex_workspace_float *work2;
+  float *row;
+  float *block;
+}
+gsl_fft3d_real_workspace_float;
+
+gsl_fft3d_complex_workspace_float *gsl_fft3d_complex_workspace_float_alloc (const size_t n1, const size_t n2,
+                                                                            const size_t n3);
+void gsl_fft3d_complex_workspace_float_free (gsl_fft3d_complex_workspace_float * work);
+
+int gsl_fft3d_complex_float_forward (gsl_complex_packed_array_float data,
+                                     const size_t n1, const size_t n2, const size_t n3,
+                                     gsl_fft3d_complex_workspace_float * work);
+int gsl_fft3d_complex_float_backward (gsl_complex_packed_array_float data,
+                                      const size_t n1, const size_t n2, const size_t n3,
+                                      gsl_fft3d_complex_workspace_float * work);
+int gsl_fft3d_complex_float_inverse (gsl_complex_packed_array_float data,
+                                     const size_t n1, const size_t n2, const size_t n3,
+                                     gsl_fft3d_complex_workspace_float * work);
+int gsl_fft3d_complex_float_transform (gsl_complex_packed_array_float data,
+                                       const size_t n1, const size_t n2, const size_t n3,
+                                       gsl_fft3d_complex_workspace_float * work,
+                                       const gsl_fft_direction sign);
+
+int gsl_fft3d_complex_float_forward_memcpy (gsl_complex_packed_array_float dest,
+                                            gsl_const_complex_packed_array_float src,
+                                            const size_t n1, const size_t n2, const size_t n3,
+                                            gsl_fft3d_complex_workspace_float * work);
+int gsl_fft3d_complex_float_backward_memcpy (gsl_complex_packed_array_float dest,
+                                             gsl_const_complex_packed_array_float src,
+                                             const size_t n1, const size_t n2, const size_t n3,
+                                             gsl_fft3d_complex_workspace_float * work);
+int gsl_fft3d_complex_float_inverse_memcpy (gsl_complex_packed_array_float dest,
+                                            gsl_const_complex_packed_array_float src,
+                                            const size_t n1, const size_t n2, const size_t n3,
+                                            gsl_fft3d_complex_workspace_float * work);
+
+gsl_fft3d_real_workspace_float *gsl_fft3d_real_workspace_float_alloc (const size_t n1, const size_t n2,
+                                                                      const size_t n3);
+void gsl_fft3d_real_workspace_float_free (gsl_fft3d_real_workspace_float * work);
+
+int gsl_fft3d_real_float_transform (const float in[], gsl_complex_packed_array_float out,
+                                    const size_t n1, const size_t n2, const size_t n3,
+                                    gsl_fft3d_real_workspace_float * work);
+int gsl_fft3d_halfcomplex_float_backward (gsl_complex_packed_array_float in, float out[],
+                                          const size_t n1, const size_t n2, const size_t n3,
+                                          gsl_fft3d_real_workspace_float * work);
+int gsl_fft3d_halfcomplex_float_inverse (gsl_complex_packed_array_float in, float out[],
+                                         const size_t n1, const size_t n2, const size_t n3,
+                                         gsl_fft3d_real_workspace_float * work);
+
+__END_DECLS
+
+#endif /* __GSL_FFT3D_H__ */
@@ -0,0 +1,134 @@
+/* fft/gsl_fft_cache.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_CACHE_H__
+#define __GSL_FFT_CACHE_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* wavetables held for a single transform length, created on demand */
+
+typedef struct
+{
+  size_t n;
+  unsigned long stamp;          /* time of last use, for LRU replacement */
+  double *roots;                /* exp(2 pi i m/n), shared by all tables */
+  gsl_fft_complex_wavetable *complex;
+  gsl_fft_real_wavetable *real;
+  gsl_fft_halfcomplex_wavetable *halfcomplex;
+  gsl_fft_complex_wavetable_float *complex_float;
+  gsl_fft_real_wavetable_float *real_float;
+  gsl_fft_halfcomplex_wavetable_float *halfcomplex_float;
+}
+gsl_fft_cache_entry;
+
+typedef struct
+{
+  size_t size;                  /* maximum number of lengths held */
+  size_t nentries;              /* number of lengths currently held */
+  gsl_fft_cache_entry *entry;
+  unsigned long clock;
+  size_t hits;                  /* table lookups satisfied by the cache */
+  size_t misses;                /* table lookups which created a table */
+  size_t scratch_size;          /* length of scratch, in doubles */
+  double *scratch;
+  size_t scratch_size_float;    /* length of scratch_float, in floats */
+  float *scratch_float;
+}
+gsl_fft_cache;
+
+gsl_fft_cache *gsl_fft_cache_alloc (const size_t size);
+void gsl_fft_cache_free (gsl_fft_cache * cache);
+void gsl_fft_cache_clear (gsl_fft_cache * cache);
+size_t gsl_fft_cache_hits (const gsl_fft_cache * cache);
+size_t gsl_fft_cache_misses (const gsl_fft_cache * cache);
+
+/* The wavetables returned below belong to the cache.  A table stays
+   valid only until the next call with a different length n, which may
+   evict it when the cache is full; this includes the transform
+   functions further down.  gsl_fft_cache_clear and gsl_fft_cache_free
+   also invalidate it. */
+
+const gsl_fft_complex_wavetable *
+gsl_fft_cache_complex_wavetable (gsl_fft_cache * cache, const size_t n);
+const gsl_fft_real_wavetable *
+gsl_fft_cache_real_wavetable (gsl_fft_cache * cache, const size_t n);
+const gsl_fft_halfcomplex_wavetable *
+gsl_fft_cache_halfcomplex_wavetable (gsl_fft_cache * cache, const size_t n);
+
+const gsl_fft_complex_wavetable_float *
+gsl_fft_cache_complex_float_wavetable (gsl_fft_cache * cache, const size_t n);
+const gsl_fft_real_wavetable_float *
+gsl_fft_cache_real_float_wavetable (gsl_fft_cache * cache, const size_t n);
+const gsl_fft_halfcomplex_wavetable_float *
+gsl_fft_cache_halfcomplex_float_wavetable (gsl_fft_cache * cache, const size_t n);
+
+int gsl_fft_cache_complex_forward (gsl_fft_cache * cache,
+                                   gsl_complex_packed_array data,
+                                   const size_t stride, const size_t n);
+int gsl_fft_cache_complex_backward (gsl_fft_cache * cache,
+                                    gsl_complex_packed_array data,
+                                    const size_t stride, const size_t n);
+int gsl_fft_cache_complex_inverse (gsl_fft_cache * cache,
+                                   gsl_complex_packed_array data,
+                                   const size_t stride, const size_t n);
+int gsl_fft_cache_real_transform (gsl_fft_cache * cache, double data[],
+                                  const size_t stride, const size_t n);
+int gsl_fft_cache_halfcomplex_transform (gsl_fft_cache * cache, double data[],
+                                         const size_t stride, const size_t n);
+int gsl_fft_cache_halfcomplex_inverse (gsl_fft_cache * cache, double data[],
+                                       const size_t stride, const size_t n);
+
+int gsl_fft_cache_complex_float_forward (gsl_fft_cache * cache,
+                                         gsl_complex_packed_array_float data,
+                                         const size_t stride, const size_t n);
+int gsl_fft_cache_complex_float_backward (gsl_fft_cache * cache,
+                                          gsl_complex_packed_array_float data,
+                                          const size_t stride, const size_t n);
+int gsl_fft_cache_complex_float_inverse (gsl_fft_cache * cache,
+                                         gsl_complex_packed_array_float data,
+                                         const size_t stride, const size_t n);
+int gsl_fft_cache_real_float_transform (gsl_fft_cache * cache, float data[],
+                                        const size_t stride, const size_t n);
+int gsl_fft_cache_halfcomplex_float_transform (gsl_fft_cache * cache, float data[],
+                                               const size_t stride, const size_t n);
+int gsl_fft_cache_halfcomplex_float_inverse (gsl_fft_cache * cache, float data[],
+                                             const size_t stride, const size_t n);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_CACHE_H__ */
@@ -77,13 +77,20 @@ int gsl_fft_complex_radix2_dif_transform (gsl_complex_packed_array data,
 
 /*  Mixed Radix general-N routines  */
 
-typedef struct
+typedef struct gsl_fft_complex_wavetable_struct
   {
     size_t n;
     size_t nf;
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    size_t nb;                  /* length of Bluestein convolution, or 0 */
+    gsl_complex *chirp;
+    gsl_complex *kernel;
+    /* sub-transforms and twiddle factors of a four-step transform */
+    struct gsl_fft_complex_wavetable_struct *columns;
+    struct gsl_fft_complex_wavetable_struct *rows;
+    gsl_complex *step;
   }
 gsl_fft_complex_wavetable;
 
@@ -91,16 +98,21 @@ typedef struct
 {
   size_t n;
   double *scratch;
+  size_t lanes;                 /* number of signals the scratch holds */
 }
 gsl_fft_complex_workspace;
 
 
 gsl_fft_complex_wavetable *gsl_fft_complex_wavetable_alloc (size_t n);
 
+gsl_fft_complex_wavetable *gsl_fft_complex_wavetable_alloc_four_step (size_t n);
+
 void gsl_fft_complex_wavetable_free (gsl_fft_complex_wavetable * wavetable);
 
 gsl_fft_complex_workspace *gsl_fft_complex_workspace_alloc (size_t n);
 
+gsl_fft_complex_workspace *gsl_fft_complex_workspace_alloc_lanes (size_t n, size_t lanes);
+
 void gsl_fft_complex_workspace_free (gsl_fft_complex_workspace * workspace);
 
 int gsl_fft_complex_memcpy (gsl_fft_complex_wavetable * dest,
@@ -131,6 +143,40 @@ int gsl_fft_complex_transform (gsl_complex_packed_array data,
                                gsl_fft_complex_workspace * work,
                                const gsl_fft_direction sign);
 
+
+int gsl_fft_complex_forward_batch (gsl_complex_packed_array data,
+                                   const size_t stride,
+                                   const size_t dist,
+                                   const size_t howmany,
+                                   const size_t n,
+                                   const gsl_fft_complex_wavetable * wavetable,
+                                   gsl_fft_complex_workspace * work);
+
+int gsl_fft_complex_backward_batch (gsl_complex_packed_array data,
+                                    const size_t stride,
+                                    const size_t dist,
+                                    const size_t howmany,
+                                    const size_t n,
+                                    const gsl_fft_complex_wavetable * wavetable,
+                                    gsl_fft_complex_workspace * work);
+
+int gsl_fft_complex_inverse_batch (gsl_complex_packed_array data,
+                                   const size_t stride,
+                                   const size_t dist,
+                                   const size_t howmany,
+                                   const size_t n,
+                                   const gsl_fft_complex_wavetable * wavetable,
+                                   gsl_fft_complex_workspace * work);
+
+int gsl_fft_complex_transform_batch (gsl_complex_packed_array data,
+                                     const size_t stride,
+                                     const size_t dist,
+                                     const size_t howmany,
+                                     const size_t n,
+                                     const gsl_fft_complex_wavetable * wavetable,
+                                     gsl_fft_complex_workspace * work,
+                                     const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_H__ */
@@ -77,13 +77,20 @@ int gsl_fft_complex_float_radix2_dif_transform (gsl_complex_packed_array_float d
 
 /*  Mixed Radix general-N routines  */
 
-typedef struct
+typedef struct gsl_fft_complex_wavetable_float_struct
   {
     size_t n;
     size_t nf;
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    size_t nb;                  /* length of Bluestein convolution, or 0 */
+    gsl_complex_float *chirp;
+    gsl_complex_float *kernel;
+    /* sub-transforms and twiddle factors of a four-step transform */
+    struct gsl_fft_complex_wavetable_float_struct *columns;
+    struct gsl_fft_complex_wavetable_float_struct *rows;
+    gsl_complex_float *step;
   }
 gsl_fft_complex_wavetable_float;
 
@@ -91,16 +98,21 @@ typedef struct
 {
     size_t n;
     float *scratch;
+    size_t lanes;               /* number of signals the scratch holds */
 }
 gsl_fft_complex_workspace_float;
 
 
 gsl_fft_complex_wavetable_float *gsl_fft_complex_wavetable_float_alloc (size_t n);
 
+gsl_fft_complex_wavetable_float *gsl_fft_complex_wavetable_float_alloc_four_step (size_t n);
+
 void gsl_fft_complex_wavetable_float_free (gsl_fft_complex_wavetable_float * wavetable);
 
 gsl_fft_complex_workspace_float *gsl_fft_complex_workspace_float_alloc (size_t n);
 
+gsl_fft_complex_workspace_float *gsl_fft_complex_workspace_float_alloc_lanes (size_t n, size_t lanes);
+
 void gsl_fft_complex_workspace_float_free (gsl_fft_complex_workspace_float * workspace);
 
 
@@ -132,6 +144,40 @@ int gsl_fft_complex_float_transform (gsl_complex_packed_array_float data,
                                      gsl_fft_complex_workspace_float * work,
                                      const gsl_fft_direction sign);
 
+
+int gsl_fft_complex_float_forward_batch (gsl_complex_packed_array_float data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t howmany,
+                                         const size_t n,
+                                         const gsl_fft_complex_wavetable_float * wavetable,
+                                         gsl_fft_complex_workspace_float * work);
+
+int gsl_fft_complex_float_backward_batch (gsl_complex_packed_array_float data,
+                                          const size_t stride,
+                                          const size_t dist,
+                                          const size_t howmany,
+                                          const size_t n,
+                                          const gsl_fft_complex_wavetable_float * wavetable,
+                                          gsl_fft_complex_workspace_float * work);
+
+int gsl_fft_complex_float_inverse_batch (gsl_complex_packed_array_float data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t howmany,
+                                         const size_t n,
+                                         const gsl_fft_complex_wavetable_float * wavetable,
+                                         gsl_fft_complex_workspace_float * work);
+
+int gsl_fft_complex_float_transform_batch (gsl_complex_packed_array_float data,
+                                           const size_t stride,
+                                           const size_t dist,
+                                           const size_t howmany,
+                                           const size_t n,
+                                           const gsl_fft_complex_wavetable_float * wavetable,
+                                           gsl_fft_complex_workspace_float * work,
+                                           const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_FLOAT_H__ */
@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
 #include <gsl/gsl_fft_real.h>
 
 #undef __BEGIN_DECLS
@@ -50,6 +51,7 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    gsl_fft_complex_wavetable *bluestein;
   }
 gsl_fft_halfcomplex_wavetable;
 
@@ -71,6 +73,30 @@ int gsl_fft_halfcomplex_transform (double data[], const size_t stride, const siz
                                    const gsl_fft_halfcomplex_wavetable * wavetable,
                                    gsl_fft_real_workspace * work);
 
+int gsl_fft_halfcomplex_backward_batch (double data[],
+                                        const size_t stride,
+                                        const size_t dist,
+                                        const size_t howmany,
+                                        const size_t n,
+                                        const gsl_fft_halfcomplex_wavetable * wavetable,
+                                        gsl_fft_real_workspace * work);
+
+int gsl_fft_halfcomplex_inverse_batch (double data[],
+                                       const size_t stride,
+                                       const size_t dist,
+                                       const size_t howmany,
+                                       const size_t n,
+                                       const gsl_fft_halfcomplex_wavetable * wavetable,
+                                       gsl_fft_real_workspace * work);
+
+int gsl_fft_halfcomplex_transform_batch (double data[],
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t howmany,
+                                         const size_t n,
+                                         const gsl_fft_halfcomplex_wavetable * wavetable,
+                                         gsl_fft_real_workspace * work);
+
 int
 gsl_fft_halfcomplex_unpack (const double halfcomplex_coefficient[],
                             double complex_coefficient[],
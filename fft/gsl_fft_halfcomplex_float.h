@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
 #include <gsl/gsl_fft_real_float.h>
 
 #undef __BEGIN_DECLS
@@ -50,6 +51,7 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    gsl_fft_complex_wavetable_float *bluestein;
   }
 gsl_fft_halfcomplex_wavetable_float;
 
@@ -71,6 +73,30 @@ int gsl_fft_halfcomplex_float_transform (float data[], const size_t stride, cons
                                          const gsl_fft_halfcomplex_wavetable_float * wavetable,
                                          gsl_fft_real_workspace_float * work);
 
+int gsl_fft_halfcomplex_float_backward_batch (float data[],
+                                              const size_t stride,
+                                              const size_t dist,
+                                              const size_t howmany,
+                                              const size_t n,
+                                              const gsl_fft_halfcomplex_wavetable_float * wavetable,
+                                              gsl_fft_real_workspace_float * work);
+
+int gsl_fft_halfcomplex_float_inverse_batch (float data[],
+                                             const size_t stride,
+                                             const size_t dist,
+                                             const size_t howmany,
+                                             const size_t n,
+                                             const gsl_fft_halfcomplex_wavetable_float * wavetable,
+                                             gsl_fft_real_workspace_float * work);
+
+int gsl_fft_halfcomplex_float_transform_batch (float data[],
+                                               const size_t stride,
+                                               const size_t dist,
+                                               const size_t howmany,
+                                               const size_t n,
+                                               const gsl_fft_halfcomplex_wavetable_float * wavetable,
+                                               gsl_fft_real_workspace_float * work);
+
 int
 gsl_fft_halfcomplex_float_unpack (const float halfcomplex_coefficient[],
                                   float complex_coefficient[],
@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -47,6 +48,7 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    gsl_fft_complex_wavetable *bluestein;
   }
 gsl_fft_real_wavetable;
 
@@ -71,6 +73,14 @@ int gsl_fft_real_transform (double data[], const size_t stride, const size_t n,
                             gsl_fft_real_workspace * work);
 
 
+int gsl_fft_real_transform_batch (double data[],
+                                  const size_t stride,
+                                  const size_t dist,
+                                  const size_t howmany,
+                                  const size_t n,
+                                  const gsl_fft_real_wavetable * wavetable,
+                                  gsl_fft_real_workspace * work);
+
 int gsl_fft_real_unpack (const double real_coefficient[],
                          double complex_coefficient[],
                          const size_t stride, const size_t n);
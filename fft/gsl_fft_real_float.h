@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -47,6 +48,7 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    gsl_fft_complex_wavetable_float *bluestein;
   }
 gsl_fft_real_wavetable_float;
 
@@ -70,6 +72,14 @@ int gsl_fft_real_float_transform (float data[], const size_t stride, const size_
                                   gsl_fft_real_workspace_float * work);
 
 
+int gsl_fft_real_float_transform_batch (float data[],
+                                        const size_t stride,
+                                        const size_t dist,
+                                        const size_t howmany,
+                                        const size_t n,
+                                        const gsl_fft_real_wavetable_float * wavetable,
+                                        gsl_fft_real_workspace_float * work);
+
 int gsl_fft_real_float_unpack (const float real_float_coefficient[],
                                float complex_coefficient[],
                                const size_t stride, const size_t n);
@@ -17,8 +17,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
-TYPE(gsl_fft_halfcomplex_wavetable) *
-FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
+/* roots, if not null, supplies exp(2 pi i m/n) as in c_init.c */
+
+static TYPE(gsl_fft_halfcomplex_wavetable) *
+FUNCTION(fft_halfcomplex_wavetable,alloc_roots) (size_t n, const double roots[])
 {
   int status;
   size_t i;
@@ -41,6 +43,27 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  wavetable->bluestein = NULL;
+
+  if (fft_bluestein_length (n))
+    {
+      /* a length with a large prime factor is transformed as complex
+         data by Bluestein's algorithm, see c_bluestein.c */
+
+      wavetable->n = n;
+      wavetable->nf = 0;
+      wavetable->trig = NULL;
+      wavetable->bluestein = FUNCTION(fft_complex_wavetable,alloc_roots) (n, NULL);
+
+      if (wavetable->bluestein == NULL)
+        {
+          free (wavetable);
+          GSL_ERROR_VAL ("failed to allocate Bluestein wavetable", GSL_ENOMEM, 0);
+        }
+
+      return wavetable;
+    }
+
   wavetable->trig = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
 
   if (wavetable->trig == NULL)
@@ -91,9 +114,17 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
               double theta;
               m = m + j * product_1;
               m = m % n;
-              theta = d_theta * m;      /*  d_theta*j*k*product_1 */
-              GSL_REAL(wavetable->trig[t]) = cos (theta);
-              GSL_IMAG(wavetable->trig[t]) = sin (theta);
+              if (roots)
+                {
+                  GSL_REAL(wavetable->trig[t]) = roots[2 * m];
+                  GSL_IMAG(wavetable->trig[t]) = roots[2 * m + 1];
+                }
+              else
+                {
+                  theta = d_theta * m;      /*  d_theta*j*k*product_1 */
+                  GSL_REAL(wavetable->trig[t]) = cos (theta);
+                  GSL_IMAG(wavetable->trig[t]) = sin (theta);
+                }
 
               t++;
             }
@@ -113,6 +144,12 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
   return wavetable;
 }
 
+TYPE(gsl_fft_halfcomplex_wavetable) *
+FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
+{
+  return FUNCTION(fft_halfcomplex_wavetable,alloc_roots) (n, NULL);
+}
+
 
 void
 FUNCTION(gsl_fft_halfcomplex_wavetable,free) (TYPE(gsl_fft_halfcomplex_wavetable) * wavetable)
@@ -122,6 +159,7 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,free) (TYPE(gsl_fft_halfcomplex_wavetable
 
   free (wavetable->trig);
   wavetable->trig = NULL;
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->bluestein);
 
   free (wavetable);
 }
@@ -103,6 +103,12 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->bluestein)
+    {
+      return FUNCTION(fft_halfcomplex,bluestein) (data, stride, n,
+                                                  wavetable->bluestein, scratch);
+    }
+
   nf = wavetable->nf;
   product = 1;
   state = 0;
@@ -185,4 +191,72 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
 
 }
 
+/* The batch functions transform howmany signals of length n, the i-th
+   starting at data + i dist, one at a time with the same wavetable and
+   workspace. */
+
+int
+FUNCTION(gsl_fft_halfcomplex,backward_batch) (BASE data[], const size_t stride,
+                                              const size_t dist, const size_t howmany,
+                                              const size_t n,
+                                              const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                              TYPE(gsl_fft_real_workspace) * work)
+{
+  size_t i;
+
+  for (i = 0; i < howmany; i++)
+    {
+      int status = FUNCTION(gsl_fft_halfcomplex,backward) (data + i * dist, stride, n,
+                                                           wavetable, work);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,inverse_batch) (BASE data[], const size_t stride,
+                                             const size_t dist, const size_t howmany,
+                                             const size_t n,
+                                             const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                             TYPE(gsl_fft_real_workspace) * work)
+{
+  size_t i;
+
+  for (i = 0; i < howmany; i++)
+    {
+      int status = FUNCTION(gsl_fft_halfcomplex,inverse) (data + i * dist, stride, n,
+                                                          wavetable, work);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,transform_batch) (BASE data[], const size_t stride,
+                                               const size_t dist, const size_t howmany,
+                                               const size_t n,
+                                               const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable,
+                                               TYPE(gsl_fft_real_workspace) * work)
+{
+  size_t i;
 
+  for (i = 0; i < howmany; i++)
+    {
+      int status = FUNCTION(gsl_fft_halfcomplex,transform) (data + i * dist, stride, n,
+                                                            wavetable, work);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  return 0;
+}
@@ -17,8 +17,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
-TYPE(gsl_fft_real_wavetable) *
-FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
+/* roots, if not null, supplies exp(2 pi i m/n) as in c_init.c */
+
+static TYPE(gsl_fft_real_wavetable) *
+FUNCTION(fft_real_wavetable,alloc_roots) (size_t n, const double roots[])
 {
   int status;
   size_t i;
@@ -41,6 +43,27 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  wavetable->bluestein = NULL;
+
+  if (fft_bluestein_length (n))
+    {
+      /* a length with a large prime factor is transformed as complex
+         data by Bluestein's algorithm, see c_bluestein.c */
+
+      wavetable->n = n;
+      wavetable->nf = 0;
+      wavetable->trig = NULL;
+      wavetable->bluestein = FUNCTION(fft_complex_wavetable,alloc_roots) (n, NULL);
+
+      if (wavetable->bluestein == NULL)
+        {
+          free (wavetable);
+          GSL_ERROR_VAL ("failed to allocate Bluestein wavetable", GSL_ENOMEM, 0);
+        }
+
+      return wavetable;
+    }
+
   if (n == 1) 
     {
       wavetable->trig = 0;
@@ -99,9 +122,17 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
               double theta;
               m = m + j * q;
               m = m % n;
-              theta = d_theta * m;      /*  d_theta*j*k*q */
-              GSL_REAL(wavetable->trig[t]) = cos (theta);
-              GSL_IMAG(wavetable->trig[t]) = sin (theta);
+              if (roots)
+                {
+                  GSL_REAL(wavetable->trig[t]) = roots[2 * m];
+                  GSL_IMAG(wavetable->trig[t]) = roots[2 * m + 1];
+                }
+              else
+                {
+                  theta = d_theta * m;      /*  d_theta*j*k*q */
+                  GSL_REAL(wavetable->trig[t]) = cos (theta);
+                  GSL_IMAG(wavetable->trig[t]) = sin (theta);
+                }
 
               t++;
             }
@@ -122,10 +153,17 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
   return wavetable;
 }
 
+TYPE(gsl_fft_real_wavetable) *
+FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
+{
+  return FUNCTION(fft_real_wavetable,alloc_roots) (n, NULL);
+}
+
 TYPE(gsl_fft_real_workspace) *
 FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 {
   TYPE(gsl_fft_real_workspace) * workspace;
+  size_t nb;
 
   if (n == 0)
     {
@@ -142,7 +180,12 @@ FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 
   workspace->n = n;
 
-  workspace->scratch = (BASE *) malloc (n * sizeof (BASE));
+  /* a Bluestein transform needs a complex copy of the data and the
+     scratch space of the complex transform */
+
+  nb = fft_bluestein_length (n);
+
+  workspace->scratch = (BASE *) malloc ((nb ? 2 * n + 4 * nb : n) * sizeof (BASE));
 
   if (workspace->scratch == NULL)
     {
@@ -166,6 +209,7 @@ FUNCTION(gsl_fft_real_wavetable,free) (TYPE(gsl_fft_real_wavetable) * wavetable)
 
   free (wavetable->trig);
   wavetable->trig = NULL;
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->bluestein);
 
   free (wavetable) ;
 }
@@ -69,6 +69,12 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->bluestein)
+    {
+      return FUNCTION(fft_real,bluestein) (data, stride, n, wavetable->bluestein,
+                                           scratch);
+    }
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -143,3 +149,29 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
   return 0;
 
 }
+
+int
+FUNCTION(gsl_fft_real,transform_batch) (BASE data[], const size_t stride,
+                                        const size_t dist, const size_t howmany,
+                                        const size_t n,
+                                        const TYPE(gsl_fft_real_wavetable) * wavetable,
+                                        TYPE(gsl_fft_real_workspace) * work)
+{
+  /* transforms howmany signals, the i-th starting at data + i dist,
+     one at a time, as the real passes cannot share their twiddle
+     factors between signals the way the complex ones do */
+
+  size_t i;
+
+  for (i = 0; i < howmany; i++)
+    {
+      int status = FUNCTION(gsl_fft_real,transform) (data + i * dist, stride, n,
+                                                     wavetable, work);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  return 0;
+}
@@ -34,12 +34,18 @@
 #include <gsl/gsl_fft_real_float.h>
 #include <gsl/gsl_fft_halfcomplex.h>
 #include <gsl/gsl_fft_halfcomplex_float.h>
+#include <gsl/gsl_fft_cache.h>
+#include <gsl/gsl_fft2d.h>
+#include <gsl/gsl_fft3d.h>
+#include <gsl/gsl_conv.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_test.h>
 
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
+double urand (void);
+
 #include "complex_internal.h"
 
 /* Usage: test [n]
@@ -53,6 +59,10 @@ void my_error_handler (const char *reason, const char *file,
 #include "test_complex_source.c"
 #include "test_real_source.c"
 #include "test_trap_source.c"
+#include "test_cache_source.c"
+#include "test_fft2d_source.c"
+#include "test_batch_source.c"
+#include "test_conv_source.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -63,6 +73,10 @@ void my_error_handler (const char *reason, const char *file,
 #include "test_complex_source.c"
 #include "test_real_source.c"
 #include "test_trap_source.c"
+#include "test_cache_source.c"
+#include "test_fft2d_source.c"
+#include "test_batch_source.c"
+#include "test_conv_source.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
@@ -111,6 +125,168 @@ main (int argc, char *argv[])
         }
     }
 
+  {
+    gsl_fft_cache * cache = gsl_fft_cache_alloc (4);
+
+    for (i = start ; i <= end ; i++) 
+      {
+        for (stride = 1 ; stride < 4 ; stride++)
+          {
+            test_cache_func (cache, stride, i) ;
+            test_cache_float_func (cache, stride, i) ;
+          }
+      }
+
+    gsl_fft_cache_free (cache);
+  }
+
+  {
+    gsl_fft_cache * cache = gsl_fft_cache_alloc (2);
+
+    gsl_fft_cache_complex_wavetable (cache, 16);    /* miss */
+    gsl_fft_cache_complex_wavetable (cache, 16);    /* hit */
+    gsl_fft_cache_real_wavetable (cache, 16);       /* miss */
+    gsl_fft_cache_complex_float_wavetable (cache, 32); /* miss */
+    gsl_fft_cache_complex_wavetable (cache, 48);    /* miss, replaces 16 */
+    gsl_fft_cache_complex_float_wavetable (cache, 32); /* hit */
+    gsl_fft_cache_real_wavetable (cache, 16);       /* miss, replaces 48 */
+
+    gsl_test (gsl_fft_cache_hits (cache) != 2, "gsl_fft_cache_hits");
+    gsl_test (gsl_fft_cache_misses (cache) != 5, "gsl_fft_cache_misses");
+    gsl_test (cache->nentries != 2, "gsl_fft_cache bounded size");
+
+    gsl_fft_cache_free (cache);
+  }
+
+  for (i = start ; i <= end ; i++) 
+    {
+      /* consecutive signals, and signals interleaved element by
+         element, transformed one, some or all at a time */
+
+      test_batch_func (1, i + 2, 4, 2, i) ;
+      test_batch_float_func (1, i + 2, 4, 2, i) ;
+      test_batch_func (3, 1, 3, 1, i) ;
+      test_batch_float_func (3, 1, 3, 1, i) ;
+      test_batch_func (6, 1, 5, 2, i) ;
+      test_batch_float_func (6, 1, 5, 2, i) ;
+      test_batch_func (4, 1, 4, 4, i) ;
+      test_batch_float_func (4, 1, 4, 4, i) ;
+      test_batch_func (6, 2, 3, 3, i) ;
+      test_batch_float_func (6, 2, 3, 3, i) ;
+      test_batch_func (5, 1, 5, 8, i) ;
+      test_batch_float_func (5, 1, 5, 8, i) ;
+    }
+
+  if (!n)
+    {
+      /* lengths computed in four steps, including one which is not a
+         power of 2, the longest only in double precision as a single
+         precision dft is not accurate enough to compare with */
+
+      static const size_t lengths[] = { 1 << 12, 4200, 1 << 14 };
+
+      for (i = 0; i < sizeof (lengths) / sizeof (lengths[0]); i++)
+        {
+          test_complex_four_step (1, lengths[i]) ;
+          test_complex_float_four_step (3, lengths[i]) ;
+        }
+
+      test_complex_four_step (2, 1 << 16) ;
+    }
+
+  {
+    /* lengths with a large prime factor, transformed by Bluestein's
+       algorithm */
+
+    static const size_t lengths[] = { 1009, 2 * 557, 3 * 331 };
+    gsl_fft_cache * cache = gsl_fft_cache_alloc (2);
+
+    if (!n)
+      {
+        for (i = 0 ; i < sizeof (lengths) / sizeof (lengths[0]) ; i++)
+          {
+            for (stride = 1 ; stride < 3 ; stride++)
+              {
+                test_complex_func (stride, lengths[i]) ;
+                test_complex_float_func (stride, lengths[i]) ;
+                test_real_func (stride, lengths[i]) ;
+                test_real_float_func (stride, lengths[i]) ;
+                test_cache_func (cache, stride, lengths[i]) ;
+              }
+          }
+      }
+
+    gsl_fft_cache_free (cache);
+  }
+
+  {
+    gsl_fft_complex_wavetable * cw1 = gsl_fft_complex_wavetable_alloc (1009);
+    gsl_fft_complex_wavetable * cw2 = gsl_fft_complex_wavetable_alloc (1024 * 29);
+
+    gsl_test (cw1->nb != 2048,
+              "gsl_fft_complex_wavetable_alloc, Bluestein length of 1009 is 2048");
+    gsl_test (cw2->nb != 0,
+              "gsl_fft_complex_wavetable_alloc, no Bluestein for 1024*29");
+
+    gsl_fft_complex_wavetable_free (cw1);
+    gsl_fft_complex_wavetable_free (cw2);
+  }
+
+  {
+    /* short sequences are summed directly, long ones through FFTs */
+
+    static const size_t lengths[] = { 1, 2, 5, 16, 37, 200, 1001 };
+    const size_t nlengths = sizeof (lengths) / sizeof (lengths[0]);
+    size_t j;
+
+    for (i = 0 ; i < nlengths ; i++)
+      {
+        for (j = 0 ; j < nlengths ; j++)
+          {
+            test_conv_func (1, lengths[i], lengths[j]) ;
+            test_conv_float_func (1, lengths[i], lengths[j]) ;
+          }
+      }
+
+    test_conv_func (3, 1001, 200) ;
+    test_conv_float_func (3, 1001, 200) ;
+
+    test_conv_filter (1, 16, 3000) ;
+    test_conv_filter (33, 16, 3000) ;
+    test_conv_filter (33, 256, 3000) ;
+    test_conv_filter (200, 1000, 3000) ;
+    test_conv_float_filter (33, 256, 3000) ;
+  }
+
+  {
+    static const size_t dims[] = { 1, 2, 3, 5, 8, 12, 17, 20, 33 };
+    const size_t ndims = sizeof (dims) / sizeof (dims[0]);
+    size_t j, k;
+
+    for (i = 0 ; i < ndims ; i++)
+      {
+        for (j = 0 ; j < ndims ; j++)
+          {
+            test_fft2d_func (dims[i], dims[j], 0) ;
+            test_fft2d_func (dims[i], dims[j], 3) ;
+            test_fft2d_float_func (dims[i], dims[j], 0) ;
+            test_fft2d_float_func (dims[i], dims[j], 3) ;
+          }
+      }
+
+    for (i = 0 ; i < ndims ; i += 2)
+      {
+        for (j = 0 ; j < ndims ; j += 3)
+          {
+            for (k = 1 ; k < ndims ; k += 2)
+              {
+                test_fft3d_func (dims[i], dims[j], dims[k]) ;
+                test_fft3d_float_func (dims[i], dims[j], dims[k]) ;
+              }
+          }
+      }
+  }
+
   gsl_set_error_handler (&my_error_handler);
   test_trap () ;
   test_float_trap () ;
@@ -0,0 +1,136 @@
+/* fft/test_batch_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_batch,func) (size_t stride, size_t dist, size_t howmany,
+                                size_t lanes, size_t n);
+
+/* the batch transforms must reproduce the results of separate calls
+   for each signal exactly, with workspaces holding lanes signals */
+
+void
+FUNCTION(test_batch,func) (size_t stride, size_t dist, size_t howmany,
+                           size_t lanes, size_t n)
+{
+  const size_t size = (howmany - 1) * dist + (n - 1) * stride + 1;
+  size_t i;
+  int status;
+
+  BASE * data = (BASE *) malloc (2 * size * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * size * sizeof (BASE));
+
+  TYPE(gsl_fft_complex_wavetable) * cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+  TYPE(gsl_fft_complex_workspace) * cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+  TYPE(gsl_fft_complex_workspace) * cbwork = FUNCTION(gsl_fft_complex_workspace,alloc_lanes) (n, lanes);
+  TYPE(gsl_fft_real_wavetable) * rw = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+  TYPE(gsl_fft_halfcomplex_wavetable) * hw = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+  TYPE(gsl_fft_real_workspace) * rwork = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+
+  for (i = 0; i < 2 * size; i++)
+    {
+      data[i] = (BASE) urand ();
+    }
+
+  memcpy (ref, data, 2 * size * sizeof (BASE));
+
+  FUNCTION(gsl_fft_complex,forward_batch) (data, stride, dist, howmany, n, cw, cbwork);
+
+  for (i = 0; i < howmany; i++)
+    {
+      FUNCTION(gsl_fft_complex,forward) (ref + 2 * i * dist, stride, n, cw, cwork);
+    }
+
+  status = memcmp (ref, data, 2 * size * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_complex) "_forward_batch, n = %d, "
+            "stride = %d, dist = %d, howmany = %d, lanes = %d",
+            n, stride, dist, howmany, lanes);
+
+  FUNCTION(gsl_fft_complex,inverse_batch) (data, stride, dist, howmany, n, cw, cbwork);
+
+  for (i = 0; i < howmany; i++)
+    {
+      FUNCTION(gsl_fft_complex,inverse) (ref + 2 * i * dist, stride, n, cw, cwork);
+    }
+
+  status = memcmp (ref, data, 2 * size * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_complex) "_inverse_batch, n = %d, "
+            "stride = %d, dist = %d, howmany = %d, lanes = %d",
+            n, stride, dist, howmany, lanes);
+
+  FUNCTION(gsl_fft_complex,backward_batch) (data, stride, dist, howmany, n, cw, cbwork);
+
+  for (i = 0; i < howmany; i++)
+    {
+      FUNCTION(gsl_fft_complex,backward) (ref + 2 * i * dist, stride, n, cw, cwork);
+    }
+
+  status = memcmp (ref, data, 2 * size * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_complex) "_backward_batch, n = %d, "
+            "stride = %d, dist = %d, howmany = %d, lanes = %d",
+            n, stride, dist, howmany, lanes);
+
+  /* real signals use only the first size elements */
+
+  for (i = 0; i < size; i++)
+    {
+      data[i] = (BASE) urand ();
+    }
+
+  memcpy (ref, data, size * sizeof (BASE));
+
+  FUNCTION(gsl_fft_real,transform_batch) (data, stride, dist, howmany, n, rw, rwork);
+
+  for (i = 0; i < howmany; i++)
+    {
+      FUNCTION(gsl_fft_real,transform) (ref + i * dist, stride, n, rw, rwork);
+    }
+
+  status = memcmp (ref, data, size * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_real) "_transform_batch, n = %d, "
+            "stride = %d, dist = %d, howmany = %d", n, stride, dist, howmany);
+
+  FUNCTION(gsl_fft_halfcomplex,inverse_batch) (data, stride, dist, howmany, n, hw, rwork);
+
+  for (i = 0; i < howmany; i++)
+    {
+      FUNCTION(gsl_fft_halfcomplex,inverse) (ref + i * dist, stride, n, hw, rwork);
+    }
+
+  status = memcmp (ref, data, size * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_halfcomplex) "_inverse_batch, n = %d, "
+            "stride = %d, dist = %d, howmany = %d", n, stride, dist, howmany);
+
+  FUNCTION(gsl_fft_halfcomplex,backward_batch) (data, stride, dist, howmany, n, hw, rwork);
+
+  for (i = 0; i < howmany; i++)
+    {
+      FUNCTION(gsl_fft_halfcomplex,backward) (ref + i * dist, stride, n, hw, rwork);
+    }
+
+  status = memcmp (ref, data, size * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_halfcomplex) "_backward_batch, n = %d, "
+            "stride = %d, dist = %d, howmany = %d", n, stride, dist, howmany);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork);
+  FUNCTION(gsl_fft_complex_workspace,free) (cbwork);
+  FUNCTION(gsl_fft_real_wavetable,free) (rw);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (hw);
+  FUNCTION(gsl_fft_real_workspace,free) (rwork);
+
+  free (data);
+  free (ref);
+}
@@ -0,0 +1,106 @@
+/* fft/test_cache_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_cache,func) (gsl_fft_cache * cache, size_t stride, size_t n);
+
+/* the cached transforms must reproduce the results of the uncached
+   ones exactly, since the wavetables are identical */
+
+void
+FUNCTION(test_cache,func) (gsl_fft_cache * cache, size_t stride, size_t n)
+{
+  size_t i;
+  int status;
+
+  BASE * data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * fft = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+
+  TYPE(gsl_fft_complex_wavetable) * cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+  TYPE(gsl_fft_complex_workspace) * cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+  TYPE(gsl_fft_real_wavetable) * rw = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+  TYPE(gsl_fft_halfcomplex_wavetable) * hw = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+  TYPE(gsl_fft_real_workspace) * rwork = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+
+  FUNCTION(fft_signal,complex_noise) (n, stride, data, fft);
+  memcpy (ref, data, 2 * n * stride * sizeof (BASE));
+
+  FUNCTION(gsl_fft_cache_complex,forward) (cache, data, stride, n);
+  FUNCTION(gsl_fft_complex,forward) (ref, stride, n, cw, cwork);
+
+  status = memcmp (ref, data, 2 * n * stride * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_cache_complex)
+            "_forward, n = %d, stride = %d", n, stride);
+
+  FUNCTION(gsl_fft_cache_complex,inverse) (cache, data, stride, n);
+  FUNCTION(gsl_fft_complex,inverse) (ref, stride, n, cw, cwork);
+
+  status = memcmp (ref, data, 2 * n * stride * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_cache_complex)
+            "_inverse, n = %d, stride = %d", n, stride);
+
+  FUNCTION(gsl_fft_cache_complex,backward) (cache, data, stride, n);
+  FUNCTION(gsl_fft_complex,backward) (ref, stride, n, cw, cwork);
+
+  status = memcmp (ref, data, 2 * n * stride * sizeof (BASE)) != 0;
+  gsl_test (status, NAME(gsl_fft_cache_complex)
+            "_backward, n = %d, stride = %d", n, stride);
+
+  FUNCTION(fft_signal,real_noise) (n, stride, data, fft);
+
+  for (i = 0; i < n; i++)
+    {
+      ref[i * stride] = data[2 * i * stride];
+      data[i * stride] = ref[i * stride];
+    }
+
+  FUNCTION(gsl_fft_cache_real,transform) (cache, data, stride, n);
+  FUNCTION(gsl_fft_real,transform) (ref, stride, n, rw, rwork);
+
+  status = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      status |= (data[i * stride] != ref[i * stride]);
+    }
+
+  gsl_test (status, NAME(gsl_fft_cache_real)
+            "_transform, n = %d, stride = %d", n, stride);
+
+  FUNCTION(gsl_fft_cache_halfcomplex,inverse) (cache, data, stride, n);
+  FUNCTION(gsl_fft_halfcomplex,inverse) (ref, stride, n, hw, rwork);
+
+  status = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      status |= (data[i * stride] != ref[i * stride]);
+    }
+
+  gsl_test (status, NAME(gsl_fft_cache_halfcomplex)
+            "_inverse, n = %d, stride = %d", n, stride);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork);
+  FUNCTION(gsl_fft_real_wavetable,free) (rw);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (hw);
+  FUNCTION(gsl_fft_real_workspace,free) (rwork);
+
+  free (data);
+  free (ref);
+  free (fft);
+}
@@ -26,6 +26,7 @@ int FUNCTION(test,offset) (const BASE data[], size_t stride,
                            size_t n, size_t offset);
 void FUNCTION(test_complex,bitreverse_order) (size_t stride, size_t n) ;
 void FUNCTION(test_complex,radix2) (size_t stride, size_t n);
+void FUNCTION(test_complex,four_step) (size_t stride, size_t n);
 
 int FUNCTION(test,offset) (const BASE data[], size_t stride, 
                            size_t n, size_t offset)
@@ -446,3 +447,79 @@ void FUNCTION(test_complex,radix2) (size_t stride, size_t n)
   free (fft_complex_tmp);
 }
 
+/* Transforms computed in four steps are checked against the dft like
+   the mixed-radix ones.  The dft takes O(n^2) time, so longer ones are
+   checked against the mixed-radix passes instead, which the shorter
+   lengths have checked against the dft. */
+
+void FUNCTION(test_complex,four_step) (size_t stride, size_t n)
+{
+  size_t i;
+  int status;
+
+  BASE * complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * complex_tmp = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * fft_complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+
+  TYPE(gsl_fft_complex_wavetable) * cw = FUNCTION(gsl_fft_complex_wavetable,alloc_four_step) (n);
+  TYPE(gsl_fft_complex_workspace) * cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+
+  gsl_test (cw->columns == NULL, NAME(gsl_fft_complex_wavetable)
+            "_alloc_four_step uses four steps, n = %d", n);
+
+  for (i = 0; i < 2 * n * stride; i++)
+    {
+      complex_data[i] = (BASE) i;
+    }
+
+  if (n <= 1 << 14)
+    {
+      FUNCTION(fft_signal,complex_noise) (n, stride, complex_data,
+                                          fft_complex_data);
+    }
+  else
+    {
+      TYPE(gsl_fft_complex_wavetable) * mw = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+
+      for (i = 0; i < n; i++)
+        {
+          REAL(complex_data,stride,i) = (BASE) urand ();
+          IMAG(complex_data,stride,i) = (BASE) urand ();
+        }
+
+      memcpy (fft_complex_data, complex_data, 2 * n * stride * sizeof (BASE));
+      FUNCTION(gsl_fft_complex,forward) (fft_complex_data, stride, n, mw, cwork);
+      FUNCTION(gsl_fft_complex_wavetable,free) (mw);
+    }
+
+  memcpy (complex_tmp, complex_data, 2 * n * stride * sizeof (BASE));
+
+  FUNCTION(gsl_fft_complex,forward) (complex_data, stride, n, cw, cwork);
+  status = FUNCTION(compare_complex,results) ("reference", fft_complex_data,
+                                              "four-step fft of noise",
+                                              complex_data, stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex)
+            "_forward with four steps, n = %d, stride = %d", n, stride);
+
+  if (stride > 1)
+    {
+      status = FUNCTION(test, offset) (complex_data, stride, n, 0);
+      gsl_test (status, NAME(gsl_fft_complex)
+                "_forward with four steps avoids unstrided data, n = %d, "
+                "stride = %d", n, stride);
+    }
+
+  FUNCTION(gsl_fft_complex,inverse) (complex_data, stride, n, cw, cwork);
+  status = FUNCTION(compare_complex,results) ("orig", complex_tmp,
+                                              "four-step inverse", complex_data,
+                                              stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex)
+            "_inverse with four steps, n = %d, stride = %d", n, stride);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork);
+
+  free (complex_data);
+  free (complex_tmp);
+  free (fft_complex_data);
+}
@@ -0,0 +1,220 @@
+/* fft/test_conv_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_conv,func) (size_t stride, size_t nx, size_t ny);
+void FUNCTION(test_conv,filter) (size_t nh, size_t block, size_t len);
+
+/* The results are compared with direct sums in double precision.  The
+   rounding errors of an FFT convolution are spread over all the
+   elements, so the error allowed is relative to the largest sum of
+   |x[k-j] y[j]| over k. */
+
+static int
+FUNCTION(test_conv,compare) (const BASE z[], const size_t zstride,
+                             const double ref[], const double scale[],
+                             const size_t n, const size_t multiplicity)
+{
+  double smax = 0;
+  size_t k, m;
+
+  for (k = 0; k < n; k++)
+    {
+      smax = GSL_MAX (smax, scale[k]);
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      for (m = 0; m < multiplicity; m++)
+        {
+          const double dz = z[(k * zstride) * multiplicity + m] - ref[k * multiplicity + m];
+
+          if (fabs (dz) > 100 * BASE_EPSILON * smax)
+            return 1;
+        }
+    }
+
+  return 0;
+}
+
+void
+FUNCTION(test_conv,func) (size_t stride, size_t nx, size_t ny)
+{
+  const size_t nz = nx + ny - 1;
+  size_t i, j, k, pass;
+  int status;
+
+  BASE * x = (BASE *) malloc (2 * nx * stride * sizeof (BASE));
+  BASE * y = (BASE *) malloc (2 * ny * stride * sizeof (BASE));
+  BASE * z = (BASE *) malloc (2 * nz * stride * sizeof (BASE));
+  double * ref = (double *) malloc (2 * nz * sizeof (double));
+  double * scale = (double *) malloc (nz * sizeof (double));
+
+  for (i = 0; i < 2 * nx * stride; i++)
+    {
+      x[i] = (BASE) (urand () - 0.5);
+    }
+
+  for (i = 0; i < 2 * ny * stride; i++)
+    {
+      y[i] = (BASE) (urand () - 0.5);
+    }
+
+  /* pass 0 is the convolution, pass 1 the cross-correlation */
+
+  for (pass = 0; pass < 2; pass++)
+    {
+      for (k = 0; k < nz; k++)
+        {
+          ref[2 * k] = 0;
+          ref[2 * k + 1] = 0;
+          scale[k] = 0;
+
+          for (j = 0; j < ny; j++)
+            {
+              const size_t jy = pass ? ny - 1 - j : j;
+              double x_real, x_imag, y_real, y_imag;
+
+              if (k < j || k - j >= nx)
+                continue;
+
+              x_real = REAL(x,stride,k - j);
+              x_imag = IMAG(x,stride,k - j);
+              y_real = REAL(y,stride,jy);
+              y_imag = pass ? -IMAG(y,stride,jy) : IMAG(y,stride,jy);
+
+              ref[2 * k] += x_real * y_real - x_imag * y_imag;
+              ref[2 * k + 1] += x_real * y_imag + x_imag * y_real;
+              scale[k] += (fabs (x_real) + fabs (x_imag)) * (fabs (y_real) + fabs (y_imag));
+            }
+        }
+
+      if (pass == 0)
+        status = TYPE(gsl_conv_complex) (x, stride, nx, y, stride, ny, z, stride);
+      else
+        status = TYPE(gsl_xcorr_complex) (x, stride, nx, y, stride, ny, z, stride);
+
+      status |= FUNCTION(test_conv,compare) (z, stride, ref, scale, nz, 2);
+      gsl_test (status, "%s, nx = %d, ny = %d, stride = %d",
+                pass ? NAME(gsl_xcorr_complex) : NAME(gsl_conv_complex),
+                nx, ny, stride);
+
+      /* the real parts alone, as real sequences with stride 2 stride */
+
+      for (k = 0; k < nz; k++)
+        {
+          ref[k] = 0;
+          scale[k] = 0;
+
+          for (j = 0; j < ny; j++)
+            {
+              const size_t jy = pass ? ny - 1 - j : j;
+
+              if (k < j || k - j >= nx)
+                continue;
+
+              ref[k] += (double) x[2 * stride * (k - j)] * y[2 * stride * jy];
+              scale[k] += fabs (x[2 * stride * (k - j)] * y[2 * stride * jy]);
+            }
+        }
+
+      if (pass == 0)
+        status = TYPE(gsl_conv) (x, 2 * stride, nx, y, 2 * stride, ny, z, 2 * stride);
+      else
+        status = TYPE(gsl_xcorr) (x, 2 * stride, nx, y, 2 * stride, ny, z, 2 * stride);
+
+      status |= FUNCTION(test_conv,compare) (z, 2 * stride, ref, scale, nz, 1);
+      gsl_test (status, "%s, nx = %d, ny = %d, stride = %d",
+                pass ? NAME(gsl_xcorr) : NAME(gsl_conv), nx, ny, 2 * stride);
+    }
+
+  free (x);
+  free (y);
+  free (z);
+  free (ref);
+  free (scale);
+}
+
+/* a stream of len samples is filtered in pieces of varying length,
+   including pieces longer than the block size of the filter, and
+   compared with the convolution of the whole stream */
+
+void
+FUNCTION(test_conv,filter) (size_t nh, size_t block, size_t len)
+{
+  static const size_t pieces[] = { 1, 7, 100, 3, 1000 };
+  size_t i, j, k;
+  int status = 0;
+
+  BASE * h = (BASE *) malloc (nh * sizeof (BASE));
+  BASE * x = (BASE *) malloc (len * sizeof (BASE));
+  BASE * y = (BASE *) malloc (len * sizeof (BASE));
+  double * ref = (double *) malloc (len * sizeof (double));
+  double * scale = (double *) malloc (len * sizeof (double));
+
+  TYPE(gsl_conv_filter) * f;
+
+  for (i = 0; i < nh; i++)
+    {
+      h[i] = (BASE) (urand () - 0.5);
+    }
+
+  for (i = 0; i < len; i++)
+    {
+      x[i] = (BASE) (urand () - 0.5);
+    }
+
+  for (k = 0; k < len; k++)
+    {
+      ref[k] = 0;
+      scale[k] = 0;
+
+      for (j = 0; j < nh && j <= k; j++)
+        {
+          ref[k] += (double) x[k - j] * h[j];
+          scale[k] += fabs (x[k - j] * h[j]);
+        }
+    }
+
+  f = FUNCTION(gsl_conv_filter,alloc) (h, 1, nh, block);
+
+  for (i = 0, k = 0; i < len; k++)
+    {
+      const size_t m = GSL_MIN (pieces[k % 5], len - i);
+      status |= FUNCTION(gsl_conv_filter,apply) (f, x + i, 1, y + i, 1, m);
+      i += m;
+    }
+
+  status |= FUNCTION(test_conv,compare) (y, 1, ref, scale, len, 1);
+  gsl_test (status, NAME(gsl_conv_filter) "_apply, nh = %d, block = %d, len = %d",
+            nh, block, len);
+
+  /* after a reset the stream is filtered in place in one call */
+
+  FUNCTION(gsl_conv_filter,reset) (f);
+  memcpy (y, x, len * sizeof (BASE));
+  status = FUNCTION(gsl_conv_filter,apply) (f, y, 1, y, 1, len);
+  status |= FUNCTION(test_conv,compare) (y, 1, ref, scale, len, 1);
+  gsl_test (status, NAME(gsl_conv_filter) "_apply in place after reset, "
+            "nh = %d, block = %d, len = %d", nh, block, len);
+
+  FUNCTION(gsl_conv_filter,free) (f);
+  free (h);
+  free (x);
+  free (y);
+  free (ref);
+  free (scale);
+}
@@ -0,0 +1,290 @@
+/* fft/test_fft2d_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_fft2d,func) (size_t n1, size_t n2, size_t pad);
+void FUNCTION(test_fft3d,func) (size_t n1, size_t n2, size_t n3);
+
+/* The multidimensional complex transforms are compared with strided
+   one-dimensional transforms along each index.  The real transforms are
+   compared with the complex transform of the same data and with the
+   original data after an inverse transform. */
+
+void
+FUNCTION(test_fft2d,func) (size_t n1, size_t n2, size_t pad)
+{
+  const size_t tda = n2 + pad;
+  const size_t nh = n2 / 2 + 1;
+  size_t i, j;
+  int status;
+
+  BASE * data = (BASE *) malloc (2 * n1 * tda * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * n1 * tda * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (2 * n1 * tda * sizeof (BASE));
+  BASE * rdata = (BASE *) malloc (n1 * n2 * sizeof (BASE));
+  BASE * hc = (BASE *) malloc (2 * n1 * nh * sizeof (BASE));
+  BASE * hcref = (BASE *) malloc (2 * n1 * nh * sizeof (BASE));
+
+  TYPE(gsl_fft_complex_wavetable) * cw1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  TYPE(gsl_fft_complex_wavetable) * cw2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+  TYPE(gsl_fft_complex_workspace) * cwork1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  TYPE(gsl_fft_complex_workspace) * cwork2 = FUNCTION(gsl_fft_complex_workspace,alloc) (n2);
+  TYPE(gsl_fft2d_complex_workspace) * cw = FUNCTION(gsl_fft2d_complex_workspace,alloc) (n1, n2);
+  TYPE(gsl_fft2d_real_workspace) * rw = FUNCTION(gsl_fft2d_real_workspace,alloc) (n1, n2);
+
+  for (i = 0; i < 2 * n1 * tda; i++)
+    {
+      orig[i] = (BASE) urand ();
+    }
+
+  memcpy (data, orig, 2 * n1 * tda * sizeof (BASE));
+  memcpy (ref, orig, 2 * n1 * tda * sizeof (BASE));
+
+  FUNCTION(gsl_fft2d_complex,forward) (data, tda, n1, n2, cw);
+
+  for (i = 0; i < n1; i++)
+    {
+      FUNCTION(gsl_fft_complex,forward) (ref + 2 * i * tda, 1, n2, cw2, cwork2);
+    }
+
+  for (j = 0; j < n2; j++)
+    {
+      FUNCTION(gsl_fft_complex,forward) (ref + 2 * j, tda, n1, cw1, cwork1);
+    }
+
+  status = 0;
+
+  for (i = 0; i < n1; i++)
+    {
+      status |= FUNCTION(compare_complex,results) ("1d", ref + 2 * i * tda,
+                                                   "2d", data + 2 * i * tda,
+                                                   1, n2, 1.0);
+    }
+
+  gsl_test (status, NAME(gsl_fft2d_complex)
+            "_forward, n1 = %d, n2 = %d, tda = %d", n1, n2, tda);
+
+  /* the padding between the rows must not be touched */
+
+  status = 0;
+
+  for (i = 0; i < n1; i++)
+    {
+      for (j = 2 * n2; j < 2 * tda; j++)
+        {
+          status |= (data[2 * i * tda + j] != orig[2 * i * tda + j]);
+        }
+    }
+
+  gsl_test (status, NAME(gsl_fft2d_complex)
+            "_forward preserves padding, n1 = %d, n2 = %d, tda = %d",
+            n1, n2, tda);
+
+  FUNCTION(gsl_fft2d_complex,inverse) (data, tda, n1, n2, cw);
+
+  status = 0;
+
+  for (i = 0; i < n1; i++)
+    {
+      status |= FUNCTION(compare_complex,results) ("orig", orig + 2 * i * tda,
+                                                   "2d inverse", data + 2 * i * tda,
+                                                   1, n2, 1e6);
+    }
+
+  gsl_test (status, NAME(gsl_fft2d_complex)
+            "_inverse, n1 = %d, n2 = %d, tda = %d", n1, n2, tda);
+
+  /* real data, compared with the complex transform of the same data */
+
+  for (i = 0; i < n1; i++)
+    {
+      for (j = 0; j < n2; j++)
+        {
+          rdata[i * n2 + j] = orig[2 * (i * tda + j)];
+          ref[2 * (i * n2 + j)] = rdata[i * n2 + j];
+          ref[2 * (i * n2 + j) + 1] = 0;
+        }
+    }
+
+  FUNCTION(gsl_fft2d_complex,forward) (ref, n2, n1, n2, cw);
+
+  for (i = 0; i < n1; i++)
+    {
+      memcpy (hcref + 2 * i * nh, ref + 2 * i * n2, 2 * nh * sizeof (BASE));
+    }
+
+  FUNCTION(gsl_fft2d_real,transform) (rdata, n2, hc, nh, n1, n2, rw);
+
+  status = FUNCTION(compare_complex,results) ("complex 2d", hcref,
+                                              "real 2d", hc,
+                                              1, n1 * nh, 1e6);
+
+  gsl_test (status, NAME(gsl_fft2d_real)
+            "_transform, n1 = %d, n2 = %d", n1, n2);
+
+  FUNCTION(gsl_fft2d_halfcomplex,inverse) (hc, nh, rdata, n2, n1, n2, rw);
+
+  status = 0;
+
+  for (i = 0; i < n1; i++)
+    {
+      for (j = 0; j < n2; j++)
+        {
+          ref[i * n2 + j] = orig[2 * (i * tda + j)];
+        }
+    }
+
+  status = FUNCTION(compare_real,results) ("orig", ref, "2d inverse", rdata,
+                                           1, n1 * n2, 1e6);
+
+  gsl_test (status, NAME(gsl_fft2d_halfcomplex)
+            "_inverse, n1 = %d, n2 = %d", n1, n2);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw2);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork1);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork2);
+  FUNCTION(gsl_fft2d_complex_workspace,free) (cw);
+  FUNCTION(gsl_fft2d_real_workspace,free) (rw);
+
+  free (data);
+  free (ref);
+  free (orig);
+  free (rdata);
+  free (hc);
+  free (hcref);
+}
+
+void
+FUNCTION(test_fft3d,func) (size_t n1, size_t n2, size_t n3)
+{
+  const size_t n = n1 * n2 * n3;
+  const size_t nh = n3 / 2 + 1;
+  size_t i, j, k;
+  int status;
+
+  BASE * data = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * rdata = (BASE *) malloc (n * sizeof (BASE));
+  BASE * hc = (BASE *) malloc (2 * n1 * n2 * nh * sizeof (BASE));
+  BASE * hcref = (BASE *) malloc (2 * n1 * n2 * nh * sizeof (BASE));
+
+  TYPE(gsl_fft_complex_wavetable) * cw1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  TYPE(gsl_fft_complex_wavetable) * cw2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+  TYPE(gsl_fft_complex_wavetable) * cw3 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n3);
+  TYPE(gsl_fft_complex_workspace) * cwork1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  TYPE(gsl_fft_complex_workspace) * cwork2 = FUNCTION(gsl_fft_complex_workspace,alloc) (n2);
+  TYPE(gsl_fft_complex_workspace) * cwork3 = FUNCTION(gsl_fft_complex_workspace,alloc) (n3);
+  TYPE(gsl_fft3d_complex_workspace) * cw = FUNCTION(gsl_fft3d_complex_workspace,alloc) (n1, n2, n3);
+  TYPE(gsl_fft3d_real_workspace) * rw = FUNCTION(gsl_fft3d_real_workspace,alloc) (n1, n2, n3);
+
+  for (i = 0; i < 2 * n; i++)
+    {
+      orig[i] = (BASE) urand ();
+    }
+
+  memcpy (ref, orig, 2 * n * sizeof (BASE));
+
+  FUNCTION(gsl_fft3d_complex,forward_memcpy) (data, orig, n1, n2, n3, cw);
+
+  for (i = 0; i < n1 * n2; i++)
+    {
+      FUNCTION(gsl_fft_complex,forward) (ref + 2 * i * n3, 1, n3, cw3, cwork3);
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      for (k = 0; k < n3; k++)
+        {
+          FUNCTION(gsl_fft_complex,forward) (ref + 2 * (i * n2 * n3 + k), n3, n2,
+                                             cw2, cwork2);
+        }
+    }
+
+  for (j = 0; j < n2 * n3; j++)
+    {
+      FUNCTION(gsl_fft_complex,forward) (ref + 2 * j, n2 * n3, n1, cw1, cwork1);
+    }
+
+  status = FUNCTION(compare_complex,results) ("1d", ref, "3d", data,
+                                              1, n, 1.0);
+
+  gsl_test (status, NAME(gsl_fft3d_complex)
+            "_forward, n1 = %d, n2 = %d, n3 = %d", n1, n2, n3);
+
+  FUNCTION(gsl_fft3d_complex,inverse) (data, n1, n2, n3, cw);
+
+  status = FUNCTION(compare_complex,results) ("orig", orig, "3d inverse", data,
+                                              1, n, 1e6);
+
+  gsl_test (status, NAME(gsl_fft3d_complex)
+            "_inverse, n1 = %d, n2 = %d, n3 = %d", n1, n2, n3);
+
+  /* real data, compared with the complex transform of the same data */
+
+  for (i = 0; i < n; i++)
+    {
+      rdata[i] = orig[2 * i];
+      ref[2 * i] = rdata[i];
+      ref[2 * i + 1] = 0;
+    }
+
+  FUNCTION(gsl_fft3d_complex,forward) (ref, n1, n2, n3, cw);
+
+  for (i = 0; i < n1 * n2; i++)
+    {
+      memcpy (hcref + 2 * i * nh, ref + 2 * i * n3, 2 * nh * sizeof (BASE));
+    }
+
+  FUNCTION(gsl_fft3d_real,transform) (rdata, hc, n1, n2, n3, rw);
+
+  status = FUNCTION(compare_complex,results) ("complex 3d", hcref,
+                                              "real 3d", hc,
+                                              1, n1 * n2 * nh, 1e6);
+
+  gsl_test (status, NAME(gsl_fft3d_real)
+            "_transform, n1 = %d, n2 = %d, n3 = %d", n1, n2, n3);
+
+  FUNCTION(gsl_fft3d_halfcomplex,inverse) (hc, rdata, n1, n2, n3, rw);
+
+  for (i = 0; i < n; i++)
+    {
+      ref[i] = orig[2 * i];
+    }
+
+  status = FUNCTION(compare_real,results) ("orig", ref, "3d inverse", rdata,
+                                           1, n, 1e6);
+
+  gsl_test (status, NAME(gsl_fft3d_halfcomplex)
+            "_inverse, n1 = %d, n2 = %d, n3 = %d", n1, n2, n3);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw2);
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw3);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork1);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork2);
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork3);
+  FUNCTION(gsl_fft3d_complex_workspace,free) (cw);
+  FUNCTION(gsl_fft3d_real_workspace,free) (rw);
+
+  free (data);
+  free (ref);
+  free (orig);
+  free (rdata);
+  free (hc);
+  free (hcref);
+}
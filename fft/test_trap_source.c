@@ -42,6 +42,33 @@ FUNCTION(test,trap) (void)
   cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (0);
   gsl_test (cw != 0, "trap for n = 0 in " NAME(gsl_fft_complex_wavetable) "_alloc");
 
+  cw = FUNCTION(gsl_fft_complex_wavetable,alloc_four_step) (0);
+  gsl_test (cw != 0, "trap for n = 0 in " NAME(gsl_fft_complex_wavetable) "_alloc_four_step");
+
+  /* copy between a four-step and a plain wavetable of the same length */
+
+  {
+    TYPE(gsl_fft_complex_wavetable) * fw =
+      FUNCTION(gsl_fft_complex_wavetable,alloc_four_step) (4096);
+    TYPE(gsl_fft_complex_wavetable) * fw2 =
+      FUNCTION(gsl_fft_complex_wavetable,alloc_four_step) (4096);
+    TYPE(gsl_fft_complex_wavetable) * pw =
+      FUNCTION(gsl_fft_complex_wavetable,alloc) (4096);
+
+    status = FUNCTION(gsl_fft_complex,memcpy) (fw, pw);
+    gsl_test (status != GSL_EINVAL, "trap for plain src, four-step dest in " NAME(gsl_fft_complex) "_memcpy");
+
+    status = FUNCTION(gsl_fft_complex,memcpy) (pw, fw);
+    gsl_test (status != GSL_EINVAL, "trap for four-step src, plain dest in " NAME(gsl_fft_complex) "_memcpy");
+
+    status = FUNCTION(gsl_fft_complex,memcpy) (fw2, fw);
+    gsl_test (status, NAME(gsl_fft_complex) "_memcpy between four-step wavetables");
+
+    FUNCTION(gsl_fft_complex_wavetable,free) (fw);
+    FUNCTION(gsl_fft_complex_wavetable,free) (fw2);
+    FUNCTION(gsl_fft_complex_wavetable,free) (pw);
+  }
+
   rw = FUNCTION(gsl_fft_real_wavetable,alloc) (0);
   gsl_test (rw != 0, "trap for n = 0 in " NAME(gsl_fft_real_wavetable) "_alloc" );
 
@@ -54,6 +81,9 @@ FUNCTION(test,trap) (void)
   rwork = FUNCTION(gsl_fft_real_workspace,alloc) (0);
   gsl_test (rw != 0, "trap for n = 0 in " NAME(gsl_fft_real_workspace) "_alloc" );
 
+  cwork = FUNCTION(gsl_fft_complex_workspace,alloc_lanes) (10, 0);
+  gsl_test (cwork != 0, "trap for lanes = 0 in " NAME(gsl_fft_complex_workspace) "_alloc_lanes");
+
   cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (10);
   hcw = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (10);
   rw = FUNCTION(gsl_fft_real_wavetable,alloc) (10);
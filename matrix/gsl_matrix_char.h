@@ -222,6 +222,7 @@ int gsl_matrix_char_swap_rows(gsl_matrix_char * m, const size_t i, const size_t
 int gsl_matrix_char_swap_columns(gsl_matrix_char * m, const size_t i, const size_t j);
 int gsl_matrix_char_swap_rowcol(gsl_matrix_char * m, const size_t i, const size_t j);
 int gsl_matrix_char_transpose (gsl_matrix_char * m);
+int gsl_matrix_char_transpose_rect_inplace (gsl_matrix_char * m);
 int gsl_matrix_char_transpose_memcpy (gsl_matrix_char * dest, const gsl_matrix_char * src);
 int gsl_matrix_char_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_char * dest, const gsl_matrix_char * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_char_div_elements (gsl_matrix_char * a, const gsl_matrix_char * b
 int gsl_matrix_char_scale (gsl_matrix_char * a, const double x);
 int gsl_matrix_char_add_constant (gsl_matrix_char * a, const double x);
 int gsl_matrix_char_add_diagonal (gsl_matrix_char * a, const double x);
+int gsl_matrix_char_scale_rows (gsl_matrix_char * a, const gsl_vector_char * x);
+int gsl_matrix_char_scale_columns (gsl_matrix_char * a, const gsl_vector_char * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
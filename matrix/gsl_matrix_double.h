@@ -222,6 +222,7 @@ int gsl_matrix_swap_rows(gsl_matrix * m, const size_t i, const size_t j);
 int gsl_matrix_swap_columns(gsl_matrix * m, const size_t i, const size_t j);
 int gsl_matrix_swap_rowcol(gsl_matrix * m, const size_t i, const size_t j);
 int gsl_matrix_transpose (gsl_matrix * m);
+int gsl_matrix_transpose_rect_inplace (gsl_matrix * m);
 int gsl_matrix_transpose_memcpy (gsl_matrix * dest, const gsl_matrix * src);
 int gsl_matrix_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix * dest, const gsl_matrix * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_div_elements (gsl_matrix * a, const gsl_matrix * b);
 int gsl_matrix_scale (gsl_matrix * a, const double x);
 int gsl_matrix_add_constant (gsl_matrix * a, const double x);
 int gsl_matrix_add_diagonal (gsl_matrix * a, const double x);
+int gsl_matrix_scale_rows (gsl_matrix * a, const gsl_vector * x);
+int gsl_matrix_scale_columns (gsl_matrix * a, const gsl_vector * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
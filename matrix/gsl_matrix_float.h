@@ -222,6 +222,7 @@ int gsl_matrix_float_swap_rows(gsl_matrix_float * m, const size_t i, const size_
 int gsl_matrix_float_swap_columns(gsl_matrix_float * m, const size_t i, const size_t j);
 int gsl_matrix_float_swap_rowcol(gsl_matrix_float * m, const size_t i, const size_t j);
 int gsl_matrix_float_transpose (gsl_matrix_float * m);
+int gsl_matrix_float_transpose_rect_inplace (gsl_matrix_float * m);
 int gsl_matrix_float_transpose_memcpy (gsl_matrix_float * dest, const gsl_matrix_float * src);
 int gsl_matrix_float_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_float * dest, const gsl_matrix_float * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_float_div_elements (gsl_matrix_float * a, const gsl_matrix_float
 int gsl_matrix_float_scale (gsl_matrix_float * a, const double x);
 int gsl_matrix_float_add_constant (gsl_matrix_float * a, const double x);
 int gsl_matrix_float_add_diagonal (gsl_matrix_float * a, const double x);
+int gsl_matrix_float_scale_rows (gsl_matrix_float * a, const gsl_vector_float * x);
+int gsl_matrix_float_scale_columns (gsl_matrix_float * a, const gsl_vector_float * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -222,6 +222,7 @@ int gsl_matrix_int_swap_rows(gsl_matrix_int * m, const size_t i, const size_t j)
 int gsl_matrix_int_swap_columns(gsl_matrix_int * m, const size_t i, const size_t j);
 int gsl_matrix_int_swap_rowcol(gsl_matrix_int * m, const size_t i, const size_t j);
 int gsl_matrix_int_transpose (gsl_matrix_int * m);
+int gsl_matrix_int_transpose_rect_inplace (gsl_matrix_int * m);
 int gsl_matrix_int_transpose_memcpy (gsl_matrix_int * dest, const gsl_matrix_int * src);
 int gsl_matrix_int_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_int * dest, const gsl_matrix_int * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_int_div_elements (gsl_matrix_int * a, const gsl_matrix_int * b);
 int gsl_matrix_int_scale (gsl_matrix_int * a, const double x);
 int gsl_matrix_int_add_constant (gsl_matrix_int * a, const double x);
 int gsl_matrix_int_add_diagonal (gsl_matrix_int * a, const double x);
+int gsl_matrix_int_scale_rows (gsl_matrix_int * a, const gsl_vector_int * x);
+int gsl_matrix_int_scale_columns (gsl_matrix_int * a, const gsl_vector_int * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -222,6 +222,7 @@ int gsl_matrix_long_swap_rows(gsl_matrix_long * m, const size_t i, const size_t
 int gsl_matrix_long_swap_columns(gsl_matrix_long * m, const size_t i, const size_t j);
 int gsl_matrix_long_swap_rowcol(gsl_matrix_long * m, const size_t i, const size_t j);
 int gsl_matrix_long_transpose (gsl_matrix_long * m);
+int gsl_matrix_long_transpose_rect_inplace (gsl_matrix_long * m);
 int gsl_matrix_long_transpose_memcpy (gsl_matrix_long * dest, const gsl_matrix_long * src);
 int gsl_matrix_long_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_long * dest, const gsl_matrix_long * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_long_div_elements (gsl_matrix_long * a, const gsl_matrix_long * b
 int gsl_matrix_long_scale (gsl_matrix_long * a, const double x);
 int gsl_matrix_long_add_constant (gsl_matrix_long * a, const double x);
 int gsl_matrix_long_add_diagonal (gsl_matrix_long * a, const double x);
+int gsl_matrix_long_scale_rows (gsl_matrix_long * a, const gsl_vector_long * x);
+int gsl_matrix_long_scale_columns (gsl_matrix_long * a, const gsl_vector_long * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
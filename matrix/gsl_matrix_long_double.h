@@ -222,6 +222,7 @@ int gsl_matrix_long_double_swap_rows(gsl_matrix_long_double * m, const size_t i,
 int gsl_matrix_long_double_swap_columns(gsl_matrix_long_double * m, const size_t i, const size_t j);
 int gsl_matrix_long_double_swap_rowcol(gsl_matrix_long_double * m, const size_t i, const size_t j);
 int gsl_matrix_long_double_transpose (gsl_matrix_long_double * m);
+int gsl_matrix_long_double_transpose_rect_inplace (gsl_matrix_long_double * m);
 int gsl_matrix_long_double_transpose_memcpy (gsl_matrix_long_double * dest, const gsl_matrix_long_double * src);
 int gsl_matrix_long_double_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_long_double * dest, const gsl_matrix_long_double * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_long_double_div_elements (gsl_matrix_long_double * a, const gsl_m
 int gsl_matrix_long_double_scale (gsl_matrix_long_double * a, const double x);
 int gsl_matrix_long_double_add_constant (gsl_matrix_long_double * a, const double x);
 int gsl_matrix_long_double_add_diagonal (gsl_matrix_long_double * a, const double x);
+int gsl_matrix_long_double_scale_rows (gsl_matrix_long_double * a, const gsl_vector_long_double * x);
+int gsl_matrix_long_double_scale_columns (gsl_matrix_long_double * a, const gsl_vector_long_double * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -222,6 +222,7 @@ int gsl_matrix_short_swap_rows(gsl_matrix_short * m, const size_t i, const size_
 int gsl_matrix_short_swap_columns(gsl_matrix_short * m, const size_t i, const size_t j);
 int gsl_matrix_short_swap_rowcol(gsl_matrix_short * m, const size_t i, const size_t j);
 int gsl_matrix_short_transpose (gsl_matrix_short * m);
+int gsl_matrix_short_transpose_rect_inplace (gsl_matrix_short * m);
 int gsl_matrix_short_transpose_memcpy (gsl_matrix_short * dest, const gsl_matrix_short * src);
 int gsl_matrix_short_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_short * dest, const gsl_matrix_short * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_short_div_elements (gsl_matrix_short * a, const gsl_matrix_short
 int gsl_matrix_short_scale (gsl_matrix_short * a, const double x);
 int gsl_matrix_short_add_constant (gsl_matrix_short * a, const double x);
 int gsl_matrix_short_add_diagonal (gsl_matrix_short * a, const double x);
+int gsl_matrix_short_scale_rows (gsl_matrix_short * a, const gsl_vector_short * x);
+int gsl_matrix_short_scale_columns (gsl_matrix_short * a, const gsl_vector_short * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
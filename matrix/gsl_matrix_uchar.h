@@ -222,6 +222,7 @@ int gsl_matrix_uchar_swap_rows(gsl_matrix_uchar * m, const size_t i, const size_
 int gsl_matrix_uchar_swap_columns(gsl_matrix_uchar * m, const size_t i, const size_t j);
 int gsl_matrix_uchar_swap_rowcol(gsl_matrix_uchar * m, const size_t i, const size_t j);
 int gsl_matrix_uchar_transpose (gsl_matrix_uchar * m);
+int gsl_matrix_uchar_transpose_rect_inplace (gsl_matrix_uchar * m);
 int gsl_matrix_uchar_transpose_memcpy (gsl_matrix_uchar * dest, const gsl_matrix_uchar * src);
 int gsl_matrix_uchar_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_uchar * dest, const gsl_matrix_uchar * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_uchar_div_elements (gsl_matrix_uchar * a, const gsl_matrix_uchar
 int gsl_matrix_uchar_scale (gsl_matrix_uchar * a, const double x);
 int gsl_matrix_uchar_add_constant (gsl_matrix_uchar * a, const double x);
 int gsl_matrix_uchar_add_diagonal (gsl_matrix_uchar * a, const double x);
+int gsl_matrix_uchar_scale_rows (gsl_matrix_uchar * a, const gsl_vector_uchar * x);
+int gsl_matrix_uchar_scale_columns (gsl_matrix_uchar * a, const gsl_vector_uchar * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
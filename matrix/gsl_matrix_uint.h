@@ -222,6 +222,7 @@ int gsl_matrix_uint_swap_rows(gsl_matrix_uint * m, const size_t i, const size_t
 int gsl_matrix_uint_swap_columns(gsl_matrix_uint * m, const size_t i, const size_t j);
 int gsl_matrix_uint_swap_rowcol(gsl_matrix_uint * m, const size_t i, const size_t j);
 int gsl_matrix_uint_transpose (gsl_matrix_uint * m);
+int gsl_matrix_uint_transpose_rect_inplace (gsl_matrix_uint * m);
 int gsl_matrix_uint_transpose_memcpy (gsl_matrix_uint * dest, const gsl_matrix_uint * src);
 int gsl_matrix_uint_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_uint * dest, const gsl_matrix_uint * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_uint_div_elements (gsl_matrix_uint * a, const gsl_matrix_uint * b
 int gsl_matrix_uint_scale (gsl_matrix_uint * a, const double x);
 int gsl_matrix_uint_add_constant (gsl_matrix_uint * a, const double x);
 int gsl_matrix_uint_add_diagonal (gsl_matrix_uint * a, const double x);
+int gsl_matrix_uint_scale_rows (gsl_matrix_uint * a, const gsl_vector_uint * x);
+int gsl_matrix_uint_scale_columns (gsl_matrix_uint * a, const gsl_vector_uint * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -222,6 +222,7 @@ int gsl_matrix_ulong_swap_rows(gsl_matrix_ulong * m, const size_t i, const size_
 int gsl_matrix_ulong_swap_columns(gsl_matrix_ulong * m, const size_t i, const size_t j);
 int gsl_matrix_ulong_swap_rowcol(gsl_matrix_ulong * m, const size_t i, const size_t j);
 int gsl_matrix_ulong_transpose (gsl_matrix_ulong * m);
+int gsl_matrix_ulong_transpose_rect_inplace (gsl_matrix_ulong * m);
 int gsl_matrix_ulong_transpose_memcpy (gsl_matrix_ulong * dest, const gsl_matrix_ulong * src);
 int gsl_matrix_ulong_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_ulong * dest, const gsl_matrix_ulong * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_ulong_div_elements (gsl_matrix_ulong * a, const gsl_matrix_ulong
 int gsl_matrix_ulong_scale (gsl_matrix_ulong * a, const double x);
 int gsl_matrix_ulong_add_constant (gsl_matrix_ulong * a, const double x);
 int gsl_matrix_ulong_add_diagonal (gsl_matrix_ulong * a, const double x);
+int gsl_matrix_ulong_scale_rows (gsl_matrix_ulong * a, const gsl_vector_ulong * x);
+int gsl_matrix_ulong_scale_columns (gsl_matrix_ulong * a, const gsl_vector_ulong * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -222,6 +222,7 @@ int gsl_matrix_ushort_swap_rows(gsl_matrix_ushort * m, const size_t i, const siz
 int gsl_matrix_ushort_swap_columns(gsl_matrix_ushort * m, const size_t i, const size_t j);
 int gsl_matrix_ushort_swap_rowcol(gsl_matrix_ushort * m, const size_t i, const size_t j);
 int gsl_matrix_ushort_transpose (gsl_matrix_ushort * m);
+int gsl_matrix_ushort_transpose_rect_inplace (gsl_matrix_ushort * m);
 int gsl_matrix_ushort_transpose_memcpy (gsl_matrix_ushort * dest, const gsl_matrix_ushort * src);
 int gsl_matrix_ushort_transpose_tricpy (const char uplo_src, const int copy_diag, gsl_matrix_ushort * dest, const gsl_matrix_ushort * src);
 
@@ -247,6 +248,8 @@ int gsl_matrix_ushort_div_elements (gsl_matrix_ushort * a, const gsl_matrix_usho
 int gsl_matrix_ushort_scale (gsl_matrix_ushort * a, const double x);
 int gsl_matrix_ushort_add_constant (gsl_matrix_ushort * a, const double x);
 int gsl_matrix_ushort_add_diagonal (gsl_matrix_ushort * a, const double x);
+int gsl_matrix_ushort_scale_rows (gsl_matrix_ushort * a, const gsl_vector_ushort * x);
+int gsl_matrix_ushort_scale_columns (gsl_matrix_ushort * a, const gsl_vector_ushort * x);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -29,6 +29,16 @@ FUNCTION (gsl_matrix, max) (const TYPE (gsl_matrix) * m)
   BASE max = m->data[0 * tda + 0];
   size_t i, j;
 
+  if (tda == N)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, M * N);
+
+      return FUNCTION (gsl_vector, max) (&v.vector);
+    }
+
   for (i = 0; i < M; i++)
     {
       for (j = 0; j < N; j++)
@@ -58,6 +68,16 @@ FUNCTION (gsl_matrix, min) (const TYPE (gsl_matrix) * m)
   BASE min = m->data[0 * tda + 0];
   size_t i, j;
 
+  if (tda == N)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, M * N);
+
+      return FUNCTION (gsl_vector, min) (&v.vector);
+    }
+
   for (i = 0; i < M; i++)
     {
       for (j = 0; j < N; j++)
@@ -92,6 +112,17 @@ FUNCTION (gsl_matrix, minmax) (const TYPE (gsl_matrix) * m,
 
   size_t i, j;
 
+  if (tda == N)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, M * N);
+
+      FUNCTION (gsl_vector, minmax) (&v.vector, min_out, max_out);
+      return;
+    }
+
   for (i = 0; i < M; i++)
     {
       for (j = 0; j < N; j++)
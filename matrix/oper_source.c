@@ -34,11 +34,26 @@ FUNCTION(gsl_matrix, add) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix) * b)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          /* contiguous storage: a single unit-stride loop over all
+             elements, so that short rows do not limit vectorization */
+
+          const size_t MN = M * N;
+
+          for (i = 0; i < MN; i++)
             {
-              a->data[i * tda_a + j] += b->data[i * tda_b + j];
+              a->data[i] += b->data[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              for (j = 0; j < N; j++)
+                {
+                  a->data[i * tda_a + j] += b->data[i * tda_b + j];
+                }
             }
         }
       
@@ -63,11 +78,26 @@ FUNCTION(gsl_matrix, sub) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix) * b)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          /* contiguous storage: a single unit-stride loop over all
+             elements, so that short rows do not limit vectorization */
+
+          const size_t MN = M * N;
+
+          for (i = 0; i < MN; i++)
+            {
+              a->data[i] -= b->data[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
             {
-              a->data[i * tda_a + j] -= b->data[i * tda_b + j];
+              for (j = 0; j < N; j++)
+                {
+                  a->data[i * tda_a + j] -= b->data[i * tda_b + j];
+                }
             }
         }
       
@@ -92,11 +122,26 @@ FUNCTION(gsl_matrix, mul_elements) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          /* contiguous storage: a single unit-stride loop over all
+             elements, so that short rows do not limit vectorization */
+
+          const size_t MN = M * N;
+
+          for (i = 0; i < MN; i++)
             {
-              a->data[i * tda_a + j] *= b->data[i * tda_b + j];
+              a->data[i] *= b->data[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              for (j = 0; j < N; j++)
+                {
+                  a->data[i * tda_a + j] *= b->data[i * tda_b + j];
+                }
             }
         }
       
@@ -121,11 +166,26 @@ FUNCTION(gsl_matrix, div_elements) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          /* contiguous storage: a single unit-stride loop over all
+             elements, so that short rows do not limit vectorization */
+
+          const size_t MN = M * N;
+
+          for (i = 0; i < MN; i++)
             {
-              a->data[i * tda_a + j] /= b->data[i * tda_b + j];
+              a->data[i] /= b->data[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              for (j = 0; j < N; j++)
+                {
+                  a->data[i * tda_a + j] /= b->data[i * tda_b + j];
+                }
             }
         }
       
@@ -142,11 +202,23 @@ FUNCTION(gsl_matrix, scale) (TYPE(gsl_matrix) * a, const double x)
   
   size_t i, j;
   
-  for (i = 0; i < M; i++)
+  if (tda == N)
     {
-      for (j = 0; j < N; j++)
+      const size_t MN = M * N;
+
+      for (i = 0; i < MN; i++)
         {
-          a->data[i * tda + j] *= x;
+          a->data[i] *= x;
+        }
+    }
+  else
+    {
+      for (i = 0; i < M; i++)
+        {
+          for (j = 0; j < N; j++)
+            {
+              a->data[i * tda + j] *= x;
+            }
         }
     }
   
@@ -162,11 +234,23 @@ FUNCTION(gsl_matrix, add_constant) (TYPE(gsl_matrix) * a, const double x)
 
   size_t i, j;
 
-  for (i = 0; i < M; i++)
+  if (tda == N)
+    {
+      const size_t MN = M * N;
+
+      for (i = 0; i < MN; i++)
+        {
+          a->data[i] += x;
+        }
+    }
+  else
     {
-      for (j = 0; j < N; j++)
+      for (i = 0; i < M; i++)
         {
-          a->data[i * tda + j] += x;
+          for (j = 0; j < N; j++)
+            {
+              a->data[i * tda + j] += x;
+            }
         }
     }
   
@@ -189,3 +273,90 @@ FUNCTION(gsl_matrix, add_diagonal) (TYPE(gsl_matrix) * a, const double x)
 
   return GSL_SUCCESS;
 }
+
+int
+FUNCTION(gsl_matrix, scale_rows) (TYPE(gsl_matrix) * a, const TYPE(gsl_vector) * x)
+{
+  /* scales row i of a by x_i, a = diag(x) a */
+
+  const size_t M = a->size1;
+  const size_t N = a->size2;
+
+  if (x->size != M)
+    {
+      GSL_ERROR ("vector length must match number of matrix rows", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t tda = a->tda;
+      const size_t stride = x->stride;
+
+      size_t i, j;
+
+      for (i = 0; i < M; i++)
+        {
+          const BASE xi = x->data[i * stride];
+          ATOMIC * row = a->data + i * tda;
+
+          for (j = 0; j < N; j++)
+            {
+              row[j] *= xi;
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+FUNCTION(gsl_matrix, scale_columns) (TYPE(gsl_matrix) * a, const TYPE(gsl_vector) * x)
+{
+  /* scales column j of a by x_j, a = a diag(x) */
+
+  const size_t M = a->size1;
+  const size_t N = a->size2;
+
+  if (x->size != N)
+    {
+      GSL_ERROR ("vector length must match number of matrix columns", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t tda = a->tda;
+      const size_t stride = x->stride;
+
+      size_t i, j;
+
+      if (stride == 1)
+        {
+          /* traverse a row by row so that both a and x are read with
+             unit stride */
+
+          const ATOMIC * x_data = x->data;
+
+          for (i = 0; i < M; i++)
+            {
+              ATOMIC * row = a->data + i * tda;
+
+              for (j = 0; j < N; j++)
+                {
+                  row[j] *= x_data[j];
+                }
+            }
+        }
+      else
+        {
+          for (j = 0; j < N; j++)
+            {
+              const BASE xj = x->data[j * stride];
+
+              for (i = 0; i < M; i++)
+                {
+                  a->data[i * tda + j] *= xj;
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -62,6 +62,16 @@ FUNCTION (gsl_matrix, isnull) (const TYPE (gsl_matrix) * m)
   
   size_t i, j, k;
 
+  if (tda == size2)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, size1 * size2);
+
+      return FUNCTION (gsl_vector, isnull) (&v.vector);
+    }
+
   for (i = 0; i < size1 ; i++)
     {
       for (j = 0; j < size2; j++)
@@ -89,6 +99,16 @@ FUNCTION (gsl_matrix, ispos) (const TYPE (gsl_matrix) * m)
   
   size_t i, j, k;
 
+  if (tda == size2)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, size1 * size2);
+
+      return FUNCTION (gsl_vector, ispos) (&v.vector);
+    }
+
   for (i = 0; i < size1 ; i++)
     {
       for (j = 0; j < size2; j++)
@@ -116,6 +136,16 @@ FUNCTION (gsl_matrix, isneg) (const TYPE (gsl_matrix) * m)
   
   size_t i, j, k;
 
+  if (tda == size2)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, size1 * size2);
+
+      return FUNCTION (gsl_vector, isneg) (&v.vector);
+    }
+
   for (i = 0; i < size1 ; i++)
     {
       for (j = 0; j < size2; j++)
@@ -143,6 +173,16 @@ FUNCTION (gsl_matrix, isnonneg) (const TYPE (gsl_matrix) * m)
   
   size_t i, j, k;
 
+  if (tda == size2)
+    {
+      /* contiguous storage: use the unit-stride vector kernel */
+
+      QUALIFIED_VIEW (gsl_vector, const_view) v =
+        FUNCTION (gsl_vector, const_view_array) (m->data, size1 * size2);
+
+      return FUNCTION (gsl_vector, isnonneg) (&v.vector);
+    }
+
   for (i = 0; i < size1 ; i++)
     {
       for (j = 0; j < size2; j++)
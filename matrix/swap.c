@@ -1,8 +1,13 @@
 #include <config.h>
+#include <stdlib.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_errno.h>
 
+/* largest block, in elements along each side, transposed directly by the
+   recursive transpose routines */
+#define TRANSPOSE_BLOCK 16
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "swap_source.c"
@@ -142,35 +142,206 @@ FUNCTION (gsl_matrix, swap_rowcol) (TYPE (gsl_matrix) * m,
 }
 
 
+/* Cache-oblivious transposition.  The index ranges are split in half
+   along their longer side until the block is at most TRANSPOSE_BLOCK
+   on each side, at which point both the rows being read and the rows
+   being written fit in cache whatever its size. */
+
+static void
+FUNCTION (matrix, transpose_copy_block) (ATOMIC * dest, const size_t dest_tda,
+                                         const ATOMIC * src, const size_t src_tda,
+                                         const size_t i0, const size_t i1,
+                                         const size_t j0, const size_t j1)
+{
+  /* copies src(j0:j1,i0:i1) into dest(i0:i1,j0:j1) transposed */
+
+  const size_t di = i1 - i0;
+  const size_t dj = j1 - j0;
+
+  if (di <= TRANSPOSE_BLOCK && dj <= TRANSPOSE_BLOCK)
+    {
+      size_t i, j, k;
+
+      for (i = i0; i < i1; i++)
+        {
+          ATOMIC * d = dest + MULTIPLICITY * i * dest_tda;
+
+          for (j = j0; j < j1; j++)
+            {
+              const ATOMIC * s = src + MULTIPLICITY * (j * src_tda + i);
+
+              for (k = 0; k < MULTIPLICITY; k++)
+                {
+                  d[MULTIPLICITY * j + k] = s[k];
+                }
+            }
+        }
+    }
+  else if (di >= dj)
+    {
+      const size_t im = i0 + di / 2;
+      FUNCTION (matrix, transpose_copy_block) (dest, dest_tda, src, src_tda, i0, im, j0, j1);
+      FUNCTION (matrix, transpose_copy_block) (dest, dest_tda, src, src_tda, im, i1, j0, j1);
+    }
+  else
+    {
+      const size_t jm = j0 + dj / 2;
+      FUNCTION (matrix, transpose_copy_block) (dest, dest_tda, src, src_tda, i0, i1, j0, jm);
+      FUNCTION (matrix, transpose_copy_block) (dest, dest_tda, src, src_tda, i0, i1, jm, j1);
+    }
+}
+
+static void
+FUNCTION (matrix, transpose_swap_block) (ATOMIC * data, const size_t tda,
+                                         const size_t i0, const size_t i1,
+                                         const size_t j0, const size_t j1)
+{
+  /* exchanges the elements (i,j) and (j,i) for i0 <= i < i1, j0 <= j < j1
+     and i < j, so that a diagonal block (i0 == j0, i1 == j1) is
+     transposed in place */
+
+  const size_t di = i1 - i0;
+  const size_t dj = j1 - j0;
+
+  if (j1 <= i0)
+    {
+      return;                   /* block lies entirely below the diagonal */
+    }
+
+  if (di <= TRANSPOSE_BLOCK && dj <= TRANSPOSE_BLOCK)
+    {
+      size_t i, j, k;
+
+      for (i = i0; i < i1; i++)
+        {
+          for (j = (j0 > i + 1) ? j0 : i + 1; j < j1; j++)
+            {
+              ATOMIC * e1 = data + MULTIPLICITY * (i * tda + j);
+              ATOMIC * e2 = data + MULTIPLICITY * (j * tda + i);
+
+              for (k = 0; k < MULTIPLICITY; k++)
+                {
+                  ATOMIC tmp = e1[k];
+                  e1[k] = e2[k];
+                  e2[k] = tmp;
+                }
+            }
+        }
+    }
+  else if (di >= dj)
+    {
+      const size_t im = i0 + di / 2;
+      FUNCTION (matrix, transpose_swap_block) (data, tda, i0, im, j0, j1);
+      FUNCTION (matrix, transpose_swap_block) (data, tda, im, i1, j0, j1);
+    }
+  else
+    {
+      const size_t jm = j0 + dj / 2;
+      FUNCTION (matrix, transpose_swap_block) (data, tda, i0, i1, j0, jm);
+      FUNCTION (matrix, transpose_swap_block) (data, tda, i0, i1, jm, j1);
+    }
+}
+
 int
-FUNCTION (gsl_matrix, transpose) (TYPE (gsl_matrix) * m)
+FUNCTION (gsl_matrix, transpose_rect_inplace) (TYPE (gsl_matrix) * m)
 {
-  const size_t size1 = m->size1;
-  const size_t size2 = m->size2;
-  size_t i, j, k;
+  /* In-place transpose of a contiguous rectangular M-by-N matrix by
+     following the cycles of the permutation which takes the element at
+     row-major position k = i N + j to position j M + i.  A bitmap of
+     visited positions costs one bit per element. */
 
-  if (size1 != size2)
+  const size_t M = m->size1;
+  const size_t N = m->size2;
+  const size_t MN = M * N;
+  ATOMIC * data = m->data;
+
+  unsigned char * visited;
+  size_t start, k;
+
+  if (!m->owner)
     {
-      GSL_ERROR ("matrix must be square to take transpose", GSL_ENOTSQR);
+      GSL_ERROR ("matrix must own its block to be transposed in-place",
+                 GSL_EINVAL);
+    }
+  else if (m->tda != N)
+    {
+      GSL_ERROR ("matrix rows must be contiguous to be transposed in-place",
+                 GSL_EINVAL);
     }
 
-  for (i = 0; i < size1; i++)
+  if (MN < 2)
     {
-      for (j = i + 1 ; j < size2 ; j++) 
+      m->size1 = N;
+      m->size2 = M;
+      m->tda = M;
+      return GSL_SUCCESS;
+    }
+
+  visited = (unsigned char *) calloc ((MN + 7) / 8, 1);
+
+  if (visited == 0)
+    {
+      GSL_ERROR ("failed to allocate space for transpose bitmap", GSL_ENOMEM);
+    }
+
+  /* positions 0 and MN - 1 are fixed points */
+
+  for (start = 1; start < MN - 1; start++)
+    {
+      size_t pos;
+      ATOMIC tmp[MULTIPLICITY];
+
+      if (visited[start / 8] & (1 << (start % 8)))
+        {
+          continue;
+        }
+
+      for (k = 0; k < MULTIPLICITY; k++)
         {
+          tmp[k] = data[MULTIPLICITY * start + k];
+        }
+
+      pos = start;
+
+      do
+        {
+          const size_t next = (pos % N) * M + pos / N;
+
           for (k = 0; k < MULTIPLICITY; k++)
             {
-              size_t e1 = (i *  m->tda + j) * MULTIPLICITY + k ;
-              size_t e2 = (j *  m->tda + i) * MULTIPLICITY + k ;
-              {
-                ATOMIC tmp = m->data[e1] ;
-                m->data[e1] = m->data[e2] ;
-                m->data[e2] = tmp ;
-              }
+              ATOMIC x = data[MULTIPLICITY * next + k];
+              data[MULTIPLICITY * next + k] = tmp[k];
+              tmp[k] = x;
             }
+
+          visited[next / 8] |= (unsigned char) (1 << (next % 8));
+          pos = next;
         }
+      while (pos != start);
+    }
+
+  free (visited);
+
+  m->size1 = N;
+  m->size2 = M;
+  m->tda = M;
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION (gsl_matrix, transpose) (TYPE (gsl_matrix) * m)
+{
+  const size_t size1 = m->size1;
+  const size_t size2 = m->size2;
+
+  if (size1 != size2)
+    {
+      GSL_ERROR ("matrix must be square to take transpose", GSL_ENOTSQR);
     }
 
+  FUNCTION (matrix, transpose_swap_block) (m->data, m->tda, 0, size1, 0, size2);
+
   return GSL_SUCCESS;
 }
 
@@ -184,27 +355,15 @@ FUNCTION (gsl_matrix, transpose_memcpy) (TYPE (gsl_matrix) * dest,
   const size_t dest_size1 = dest->size1;
   const size_t dest_size2 = dest->size2;
 
-  size_t i, j, k;
-
   if (dest_size2 != src_size1 || dest_size1 != src_size2)
     {
       GSL_ERROR ("dimensions of dest matrix must be transpose of src matrix", 
                  GSL_EBADLEN);
     }
 
-  for (i = 0; i < dest_size1; i++)
-    {
-      for (j = 0 ; j < dest_size2; j++) 
-        {
-          for (k = 0; k < MULTIPLICITY; k++)
-            {
-              size_t e1 = (i *  dest->tda + j) * MULTIPLICITY + k ;
-              size_t e2 = (j *  src->tda + i) * MULTIPLICITY + k ;
-
-              dest->data[e1] = src->data[e2] ;
-            }
-        }
-    }
+  FUNCTION (matrix, transpose_copy_block) (dest->data, dest->tda, 
+                                           src->data, src->tda,
+                                           0, dest_size1, 0, dest_size2);
 
   return GSL_SUCCESS;
 }
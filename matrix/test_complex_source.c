@@ -23,6 +23,7 @@ void FUNCTION (test, trap) (const size_t M, const size_t N);
 void FUNCTION (test, text) (const size_t M, const size_t N);
 void FUNCTION (test, binary) (const size_t M, const size_t N);
 void FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N);
+void FUNCTION (test, transpose) (const size_t M, const size_t N);
 
 #define TEST(expr,desc) gsl_test((expr), NAME(gsl_matrix) desc " M=%d, N=%d", M, N)
 
@@ -439,6 +440,109 @@ FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N)
   FUNCTION (gsl_matrix, free) (l);
 }
 
+void
+FUNCTION (test, transpose) (const size_t M, const size_t N)
+{
+  size_t i, j, k;
+
+  TYPE (gsl_matrix) * a = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * b = FUNCTION (gsl_matrix, alloc) (N, M);
+  TYPE (gsl_matrix) * c = FUNCTION (gsl_matrix, alloc) (M + 3, M + 5);
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          for (k = 0; k < MULTIPLICITY; k++)
+            {
+              a->data[(i * a->tda + j) * MULTIPLICITY + k] = (ATOMIC) (i * N + j + k);
+            }
+        }
+    }
+
+  {
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose_memcpy) (b, a);
+
+    for (i = 0; i < N; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                if (b->data[(i * b->tda + j) * MULTIPLICITY + k] != (ATOMIC) (j * N + i + k))
+                  status = 1;
+              }
+          }
+      }
+
+    TEST (status, "_transpose_memcpy");
+  }
+
+  {
+    int status = 0;
+
+    /* square submatrix, with tda larger than its size */
+
+    QUALIFIED_VIEW (gsl_matrix, view) s =
+      FUNCTION (gsl_matrix, submatrix) (c, 1, 2, M, M);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                s.matrix.data[(i * s.matrix.tda + j) * MULTIPLICITY + k] = (ATOMIC) (i * M + j + k);
+              }
+          }
+      }
+
+    FUNCTION (gsl_matrix, transpose) (&s.matrix);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                if (s.matrix.data[(i * s.matrix.tda + j) * MULTIPLICITY + k] != (ATOMIC) (j * M + i + k))
+                  status = 1;
+              }
+          }
+      }
+
+    TEST (status, "_transpose square");
+  }
+
+  {
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose_rect_inplace) (a);
+
+    status |= (a->size1 != N || a->size2 != M || a->tda != M);
+
+    for (i = 0; i < N; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                if (a->data[(i * a->tda + j) * MULTIPLICITY + k] != (ATOMIC) (j * N + i + k))
+                  status = 1;
+              }
+          }
+      }
+
+    TEST (status, "_transpose rectangular in-place");
+  }
+
+  FUNCTION (gsl_matrix, free) (a);
+  FUNCTION (gsl_matrix, free) (b);
+  FUNCTION (gsl_matrix, free) (c);
+}
+
 void
 FUNCTION (test, trap) (const size_t M, const size_t N)
 {
@@ -23,6 +23,7 @@ void FUNCTION (test, trap) (const size_t M, const size_t N);
 void FUNCTION (test, text) (const size_t M, const size_t N);
 void FUNCTION (test, binary) (const size_t M, const size_t N);
 void FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N);
+void FUNCTION (test, transpose) (const size_t M, const size_t N);
 
 #define TEST(expr,desc) gsl_test((expr), NAME(gsl_matrix) desc " M=%d, N=%d", M, N)
 
@@ -588,6 +589,91 @@ FUNCTION (test, ops) (const size_t M, const size_t N)
     gsl_test (status, NAME (gsl_matrix) "_add_diagonal");
   }
 
+  {
+    int status = 0;
+    TYPE (gsl_vector) * x = FUNCTION (gsl_vector, alloc) (M);
+
+    for (i = 0; i < M; i++)
+      {
+        FUNCTION (gsl_vector, set) (x, i, (BASE)(1 + (i % 3)));
+      }
+
+    FUNCTION(gsl_matrix, memcpy) (m, a);
+    FUNCTION(gsl_matrix, scale_rows) (m, x);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            BASE r = FUNCTION(gsl_matrix,get) (m,i,j);
+            BASE y = FUNCTION(gsl_matrix,get) (a,i,j);
+            BASE z = (BASE)(y * (BASE)(1 + (i % 3)));
+            if (r != z)
+              status = 1;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_scale_rows");
+
+    FUNCTION (gsl_vector, free) (x);
+  }
+
+  {
+    int status = 0;
+    TYPE (gsl_vector) * x = FUNCTION (gsl_vector, alloc) (2 * N);
+    QUALIFIED_VIEW (gsl_vector, view) xs =
+      FUNCTION (gsl_vector, subvector_with_stride) (x, 0, 2, N);
+
+    for (j = 0; j < N; j++)
+      {
+        FUNCTION (gsl_vector, set) (&xs.vector, j, (BASE)(1 + (j % 3)));
+      }
+
+    FUNCTION(gsl_matrix, memcpy) (m, a);
+    FUNCTION(gsl_matrix, scale_columns) (m, &xs.vector);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            BASE r = FUNCTION(gsl_matrix,get) (m,i,j);
+            BASE y = FUNCTION(gsl_matrix,get) (a,i,j);
+            BASE z = (BASE)(y * (BASE)(1 + (j % 3)));
+            if (r != z)
+              status = 1;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_scale_columns with stride");
+
+    {
+      QUALIFIED_VIEW (gsl_vector, view) xu =
+        FUNCTION (gsl_vector, subvector) (x, 0, N);
+
+      for (j = 0; j < N; j++)
+        {
+          FUNCTION (gsl_vector, set) (&xu.vector, j, (BASE)(1 + (j % 3)));
+        }
+
+      FUNCTION(gsl_matrix, memcpy) (m, a);
+      FUNCTION(gsl_matrix, scale_columns) (m, &xu.vector);
+      status = 0;
+
+      for (i = 0; i < M; i++)
+        {
+          for (j = 0; j < N; j++)
+            {
+              BASE r = FUNCTION(gsl_matrix,get) (m,i,j);
+              BASE y = FUNCTION(gsl_matrix,get) (a,i,j);
+              BASE z = (BASE)(y * (BASE)(1 + (j % 3)));
+              if (r != z)
+                status = 1;
+            }
+        }
+      gsl_test (status, NAME (gsl_matrix) "_scale_columns");
+    }
+
+    FUNCTION (gsl_vector, free) (x);
+  }
+
 
   FUNCTION(gsl_matrix, swap) (a, b);
 
@@ -801,6 +887,109 @@ FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N)
   FUNCTION (gsl_matrix, free) (l);
 }
 
+void
+FUNCTION (test, transpose) (const size_t M, const size_t N)
+{
+  size_t i, j, k;
+
+  TYPE (gsl_matrix) * a = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * b = FUNCTION (gsl_matrix, alloc) (N, M);
+  TYPE (gsl_matrix) * c = FUNCTION (gsl_matrix, alloc) (M + 3, M + 5);
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          for (k = 0; k < MULTIPLICITY; k++)
+            {
+              a->data[(i * a->tda + j) * MULTIPLICITY + k] = (ATOMIC) (i * N + j + k);
+            }
+        }
+    }
+
+  {
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose_memcpy) (b, a);
+
+    for (i = 0; i < N; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                if (b->data[(i * b->tda + j) * MULTIPLICITY + k] != (ATOMIC) (j * N + i + k))
+                  status = 1;
+              }
+          }
+      }
+
+    TEST (status, "_transpose_memcpy");
+  }
+
+  {
+    int status = 0;
+
+    /* square submatrix, with tda larger than its size */
+
+    QUALIFIED_VIEW (gsl_matrix, view) s =
+      FUNCTION (gsl_matrix, submatrix) (c, 1, 2, M, M);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                s.matrix.data[(i * s.matrix.tda + j) * MULTIPLICITY + k] = (ATOMIC) (i * M + j + k);
+              }
+          }
+      }
+
+    FUNCTION (gsl_matrix, transpose) (&s.matrix);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                if (s.matrix.data[(i * s.matrix.tda + j) * MULTIPLICITY + k] != (ATOMIC) (j * M + i + k))
+                  status = 1;
+              }
+          }
+      }
+
+    TEST (status, "_transpose square");
+  }
+
+  {
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose_rect_inplace) (a);
+
+    status |= (a->size1 != N || a->size2 != M || a->tda != M);
+
+    for (i = 0; i < N; i++)
+      {
+        for (j = 0; j < M; j++)
+          {
+            for (k = 0; k < MULTIPLICITY; k++)
+              {
+                if (a->data[(i * a->tda + j) * MULTIPLICITY + k] != (ATOMIC) (j * N + i + k))
+                  status = 1;
+              }
+          }
+      }
+
+    TEST (status, "_transpose rectangular in-place");
+  }
+
+  FUNCTION (gsl_matrix, free) (a);
+  FUNCTION (gsl_matrix, free) (b);
+  FUNCTION (gsl_matrix, free) (c);
+}
+
 void
 FUNCTION (test, trap) (const size_t M, const size_t N)
 {
@@ -871,5 +1060,23 @@ FUNCTION (test, trap) (const size_t M, const size_t N)
   gsl_test (x != 0,
         NAME (gsl_matrix) "_get returns zero for 2nd index at upper bound");
 
+  if (M != N)
+    {
+      status = 0;
+      FUNCTION (gsl_matrix, transpose) (m);
+      gsl_test (!status,
+                NAME (gsl_matrix) "_transpose traps rectangular matrix");
+    }
+
+  {
+    QUALIFIED_VIEW (gsl_matrix, view) v =
+      FUNCTION (gsl_matrix, submatrix) (m, 0, 0, M - 1, N);
+
+    status = 0;
+    FUNCTION (gsl_matrix, transpose_rect_inplace) (&v.matrix);
+    gsl_test (!status,
+              NAME (gsl_matrix) "_transpose_rect_inplace traps view");
+  }
+
   FUNCTION (gsl_matrix, free) (m);
 }
@@ -0,0 +1,298 @@
+/* randist/discrete_dyn.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Random discrete events with weights which can change between draws.
+
+   The weights are the leaves of a sum tree in which each node has
+   B = 8 children, so that the children of a node fill one cache line
+   and the depth is a third of that of a binary tree.  The tree is
+   stored as a heap, with the root tree[0] holding the total and the
+   children of node p at tree[8p+1..8p+8]; the weight of event k is
+   the leaf tree[offset + k].  The capacity n is a power of 8 and the
+   leaves beyond the last event are zero.
+
+   An event is chosen by taking u uniform in [0, total) and descending
+   from the root, at each node counting the prefix sums of the
+   children which are not greater than u, without branches, and
+   subtracting the sum of the children passed over.  Changing a weight
+   recomputes the sums on the path from its leaf to the root.  Both
+   take O(log K) time.  The sums are recomputed from the children
+   rather than corrected by the change in the weight, so that rounding
+   errors do not accumulate over many updates.
+
+   Inserting an event appends it, enlarging the tree by one level when
+   it is full, and deleting an event moves the last event into its
+   place, so that the events are always numbered 0..K-1. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#define CHILD(p) (8 * (p) + 1)
+#define PARENT(p) (((p) - 1) / 8)
+
+static inline double
+discrete_dyn_sum (const double *const c)
+{
+  return ((c[0] + c[1]) + (c[2] + c[3])) + ((c[4] + c[5]) + (c[6] + c[7]));
+}
+
+/* allocates a tree of capacity n = 8^depth holding the weights P[0..K-1] */
+
+static int
+discrete_dyn_build (gsl_ran_discrete_dyn_t * g, const size_t K,
+                    const double *P, const size_t depth)
+{
+  size_t n = 8, offset = 1, d, k, p;
+  double *tree;
+
+  for (d = 1; d < depth; d++)
+    {
+      offset += n;
+      n *= 8;
+    }
+
+  tree = (double *) malloc ((offset + n) * sizeof (double));
+
+  if (tree == 0)
+    {
+      GSL_ERROR ("failed to allocate space for sum tree", GSL_ENOMEM);
+    }
+
+  for (k = 0; k < K; k++)
+    tree[offset + k] = P[k];
+
+  for (k = K; k < n; k++)
+    tree[offset + k] = 0.0;
+
+  for (p = offset; p-- > 0;)
+    tree[p] = discrete_dyn_sum (tree + CHILD (p));
+
+  g->K = K;
+  g->n = n;
+  g->depth = depth;
+  g->offset = offset;
+  g->tree = tree;
+
+  return GSL_SUCCESS;
+}
+
+/* recompute the sums above leaf p */
+
+static inline void
+discrete_dyn_update (double *const tree, size_t p)
+{
+  while (p > 0)
+    {
+      p = PARENT (p);
+      tree[p] = discrete_dyn_sum (tree + CHILD (p));
+    }
+}
+
+gsl_ran_discrete_dyn_t *
+gsl_ran_discrete_dyn_alloc (const size_t K, const double *P)
+{
+  gsl_ran_discrete_dyn_t *g;
+  size_t k, n = 8, depth = 1;
+
+  for (k = 0; k < K; k++)
+    {
+      if (!(P[k] >= 0) || !gsl_finite (P[k]))
+        {
+          GSL_ERROR_NULL ("weights must be non-negative and finite",
+                          GSL_EINVAL);
+        }
+    }
+
+  while (n < K)
+    {
+      n *= 8;
+      depth++;
+    }
+
+  g = (gsl_ran_discrete_dyn_t *) malloc (sizeof (gsl_ran_discrete_dyn_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for discrete struct",
+                      GSL_ENOMEM);
+    }
+
+  if (discrete_dyn_build (g, K, P, depth))
+    {
+      free (g);
+      GSL_ERROR_NULL ("failed to allocate space for sum tree", GSL_ENOMEM);
+    }
+
+  return g;
+}
+
+void
+gsl_ran_discrete_dyn_free (gsl_ran_discrete_dyn_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g->tree);
+  free (g);
+}
+
+int
+gsl_ran_discrete_dyn_set (gsl_ran_discrete_dyn_t * g, const size_t k,
+                          const double w)
+{
+  if (k >= g->K)
+    {
+      GSL_ERROR ("index out of range", GSL_EINVAL);
+    }
+  else if (!(w >= 0) || !gsl_finite (w))
+    {
+      GSL_ERROR ("weight must be non-negative and finite", GSL_EINVAL);
+    }
+
+  g->tree[g->offset + k] = w;
+  discrete_dyn_update (g->tree, g->offset + k);
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_ran_discrete_dyn_get (const gsl_ran_discrete_dyn_t * g, const size_t k)
+{
+  if (k >= g->K)
+    {
+      GSL_ERROR_VAL ("index out of range", GSL_EINVAL, 0);
+    }
+
+  return g->tree[g->offset + k];
+}
+
+double
+gsl_ran_discrete_dyn_total (const gsl_ran_discrete_dyn_t * g)
+{
+  return g->tree[0];
+}
+
+int
+gsl_ran_discrete_dyn_insert (gsl_ran_discrete_dyn_t * g, const double w)
+{
+  if (!(w >= 0) || !gsl_finite (w))
+    {
+      GSL_ERROR ("weight must be non-negative and finite", GSL_EINVAL);
+    }
+
+  if (g->K == g->n)
+    {
+      double *old = g->tree;
+      int status = discrete_dyn_build (g, g->K, old + g->offset,
+                                       g->depth + 1);
+
+      if (status)
+        return status;
+
+      free (old);
+    }
+
+  g->tree[g->offset + g->K] = w;
+  discrete_dyn_update (g->tree, g->offset + g->K);
+  g->K++;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ran_discrete_dyn_delete (gsl_ran_discrete_dyn_t * g, const size_t k)
+{
+  size_t last;
+
+  if (k >= g->K)
+    {
+      GSL_ERROR ("index out of range", GSL_EINVAL);
+    }
+
+  last = g->K - 1;
+
+  if (k != last)
+    {
+      g->tree[g->offset + k] = g->tree[g->offset + last];
+      discrete_dyn_update (g->tree, g->offset + k);
+    }
+
+  g->tree[g->offset + last] = 0.0;
+  discrete_dyn_update (g->tree, g->offset + last);
+  g->K--;
+
+  return GSL_SUCCESS;
+}
+
+size_t
+gsl_ran_discrete_dyn (const gsl_rng * r, const gsl_ran_discrete_dyn_t * g)
+{
+  const double *const tree = g->tree;
+  double u = gsl_rng_uniform (r) * tree[0];
+  size_t d, p = 0;
+
+  if (!(tree[0] > 0))
+    {
+      GSL_ERROR_VAL ("sum of weights must be positive", GSL_EDOM, 0);
+    }
+
+  for (d = 0; d < g->depth; d++)
+    {
+      const double *const c = tree + CHILD (p);
+      double s[8];
+      int j = 0, m;
+
+      /* prefix sums, with the pairs added first to shorten the chain
+         of dependent additions; they are still non-decreasing */
+
+      s[0] = c[0];
+      s[1] = c[0] + c[1];
+      s[2] = s[1] + c[2];
+      s[3] = s[1] + (c[2] + c[3]);
+      s[4] = s[3] + c[4];
+      s[5] = s[3] + (c[4] + c[5]);
+      s[6] = s[5] + c[6];
+
+      for (m = 0; m < 7; m++)
+        j += (u >= s[m]);
+
+      /* only the last child can be reached with zero weight, when
+         rounding makes u reach the sum of the node */
+
+      while (j > 0 && c[j] == 0)
+        j--;
+
+      if (j > 0)
+        u -= s[j - 1];
+
+      p = CHILD (p) + j;
+    }
+
+  return p - g->offset;
+}
+
+double
+gsl_ran_discrete_dyn_pdf (const size_t k, const gsl_ran_discrete_dyn_t * g)
+{
+  if (k >= g->K || !(g->tree[0] > 0))
+    return 0;
+
+  return g->tree[g->offset + k] / g->tree[0];
+}
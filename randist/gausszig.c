@@ -225,3 +225,85 @@ gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
 
   return sign * sigma * x;
 }
+
+/* The array version draws the raw bits for a block of numbers at once
+   and runs the fast acceptance test over the whole block in a loop
+   without branches.  The numbers which fail it, about 1 in 100, are
+   finished in a second loop with the wedge and tail tests, and a
+   fresh number from the scalar routine if these also reject.  The
+   numbers follow the same distribution as the scalar routine but not
+   the same sequence. */
+
+#define ZIGGURAT_BLOCK 256
+
+void
+gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, const double sigma,
+                                 const size_t n, double x[])
+{
+  unsigned long int k[ZIGGURAT_BLOCK];
+  size_t reject[ZIGGURAT_BLOCK];
+  size_t i, l;
+
+  /* the sign is taken from the table to avoid a branch */
+  const double scale[2] = { -sigma, sigma };
+
+  const unsigned long int range = r->type->max - r->type->min;
+  const unsigned long int offset = r->type->min;
+
+  if (range < 0xFFFFFFFF)
+    {
+      /* generators with fewer than 32 bits take the scalar path */
+
+      for (i = 0; i < n; i++)
+        x[i] = gsl_ran_gaussian_ziggurat (r, sigma);
+
+      return;
+    }
+
+  for (i = 0; i < n; i += ZIGGURAT_BLOCK)
+    {
+      const size_t m = (n - i < ZIGGURAT_BLOCK) ? n - i : ZIGGURAT_BLOCK;
+      double *const y = x + i;
+      size_t nreject = 0;
+
+      gsl_rng_get_array (r, k, m);
+
+      for (l = 0; l < m; l++)
+        {
+          const unsigned long int b = k[l] - offset;
+          const unsigned long int s = b & 0x7f;
+          const unsigned long int j = (b >> 8) & 0xFFFFFF;
+
+          y[l] = scale[(b >> 7) & 1] * (j * wtab[s]);
+          reject[nreject] = l;
+          nreject += (j >= ktab[s]);
+        }
+
+      for (l = 0; l < nreject; l++)
+        {
+          const size_t t = reject[l];
+          const unsigned long int b = k[t] - offset;
+          const unsigned long int s = b & 0x7f;
+          const double sign = (b & 0x80) ? sigma : -sigma;
+          double u, v;
+
+          if (s < 127)
+            {
+              u = ((b >> 8) & 0xFFFFFF) * wtab[s];
+              v = ytab[s + 1] + (ytab[s] - ytab[s + 1]) * gsl_rng_uniform (r);
+            }
+          else
+            {
+              double U1 = 1.0 - gsl_rng_uniform (r);
+              double U2 = gsl_rng_uniform (r);
+              u = PARAM_R - log (U1) / PARAM_R;
+              v = exp (-PARAM_R * (u - 0.5 * PARAM_R)) * U2;
+            }
+
+          if (v < exp (-0.5 * u * u))
+            y[t] = sign * u;
+          else
+            y[t] = gsl_ran_gaussian_ziggurat (r, sigma);
+        }
+    }
+}
@@ -48,6 +48,7 @@ double gsl_ran_binomial_pdf (const unsigned int k, const double p, const unsigne
 
 double gsl_ran_exponential (const gsl_rng * r, const double mu);
 double gsl_ran_exponential_pdf (const double x, const double mu);
+void gsl_ran_exponential_array (const gsl_rng * r, const double mu, const size_t n, double x[]);
 
 double gsl_ran_exppow (const gsl_rng * r, const double a, const double b);
 double gsl_ran_exppow_pdf (const double x, const double a, const double b);
@@ -76,10 +77,12 @@ double gsl_ran_gamma_int (const gsl_rng * r, const unsigned int a);
 double gsl_ran_gamma_pdf (const double x, const double a, const double b);
 double gsl_ran_gamma_mt (const gsl_rng * r, const double a, const double b);
 double gsl_ran_gamma_knuth (const gsl_rng * r, const double a, const double b);
+void gsl_ran_gamma_array (const gsl_rng * r, const double a, const double b, const size_t n, double x[]);
 
 double gsl_ran_gaussian (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ratio_method (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma);
+void gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, const double sigma, const size_t n, double x[]);
 double gsl_ran_gaussian_pdf (const double x, const double sigma);
 
 double gsl_ran_ugaussian (const gsl_rng * r);
@@ -195,6 +198,24 @@ void gsl_ran_discrete_free(gsl_ran_discrete_t *g);
 size_t gsl_ran_discrete (const gsl_rng *r, const gsl_ran_discrete_t *g);
 double gsl_ran_discrete_pdf (size_t k, const gsl_ran_discrete_t *g);
 
+typedef struct {                /* struct for dynamic weights */
+    size_t K;                   /* number of events */
+    size_t n;                   /* capacity, a power of eight */
+    size_t depth;               /* number of levels below the root */
+    size_t offset;              /* position of the first leaf */
+    double *tree;               /* sum tree of the weights */
+} gsl_ran_discrete_dyn_t;
+
+gsl_ran_discrete_dyn_t * gsl_ran_discrete_dyn_alloc (const size_t K, const double *P);
+void gsl_ran_discrete_dyn_free (gsl_ran_discrete_dyn_t * g);
+int gsl_ran_discrete_dyn_set (gsl_ran_discrete_dyn_t * g, const size_t k, const double w);
+double gsl_ran_discrete_dyn_get (const gsl_ran_discrete_dyn_t * g, const size_t k);
+double gsl_ran_discrete_dyn_total (const gsl_ran_discrete_dyn_t * g);
+int gsl_ran_discrete_dyn_insert (gsl_ran_discrete_dyn_t * g, const double w);
+int gsl_ran_discrete_dyn_delete (gsl_ran_discrete_dyn_t * g, const size_t k);
+size_t gsl_ran_discrete_dyn (const gsl_rng * r, const gsl_ran_discrete_dyn_t * g);
+double gsl_ran_discrete_dyn_pdf (const size_t k, const gsl_ran_discrete_dyn_t * g);
+
 
 __END_DECLS
 
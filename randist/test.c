@@ -91,10 +91,15 @@ double test_discrete2 (void);
 double test_discrete2_pdf (unsigned int n);
 double test_discrete3 (void);
 double test_discrete3_pdf (unsigned int n);
+double test_discrete_dyn (void);
+double test_discrete_dyn_pdf (unsigned int n);
+void test_discrete_dyn_update (void);
 double test_erlang (void);
 double test_erlang_pdf (double x);
 double test_exponential (void);
 double test_exponential_pdf (double x);
+double test_exponential_array (void);
+double test_exponential_array_pdf (double x);
 double test_exppow0 (void);
 double test_exppow0_pdf (double x);
 double test_exppow1 (void);
@@ -125,6 +130,10 @@ double test_gamma_vlarge (void);
 double test_gamma_vlarge_pdf (double x);
 double test_gamma_small (void);
 double test_gamma_small_pdf (double x);
+double test_gamma_array (void);
+double test_gamma_array_pdf (double x);
+double test_gamma_array_small (void);
+double test_gamma_array_small_pdf (double x);
 double test_gamma_mt (void);
 double test_gamma_mt_pdf (double x);
 double test_gamma_mt1 (void);
@@ -143,6 +152,8 @@ double test_gaussian_ratio_method (void);
 double test_gaussian_ratio_method_pdf (double x);
 double test_gaussian_ziggurat (void);
 double test_gaussian_ziggurat_pdf (double x);
+double test_gaussian_ziggurat_array (void);
+double test_gaussian_ziggurat_array_pdf (double x);
 double test_gaussian_tail (void);
 double test_gaussian_tail_pdf (double x);
 double test_gaussian_tail1 (void);
@@ -259,6 +270,7 @@ gsl_rng *r_global;
 static gsl_ran_discrete_t *g1 = NULL;
 static gsl_ran_discrete_t *g2 = NULL;
 static gsl_ran_discrete_t *g3 = NULL;
+static gsl_ran_discrete_dyn_t *g4 = NULL;
 
 int
 main (void)
@@ -404,10 +416,22 @@ main (void)
   testDiscretePDF (FUNC2 (negative_binomial));
   testDiscretePDF (FUNC2 (pascal));
 
+  /* the array versions come last so that the other tests keep their
+     random numbers */
+
+  testPDF (FUNC2 (exponential_array));
+  testPDF (FUNC2 (gamma_array));
+  testPDF (FUNC2 (gamma_array_small));
+  testPDF (FUNC2 (gaussian_ziggurat_array));
+
+  testDiscretePDF (FUNC2 (discrete_dyn));
+  test_discrete_dyn_update ();
+
   gsl_rng_free (r_global);
   gsl_ran_discrete_free (g1);
   gsl_ran_discrete_free (g2);
   gsl_ran_discrete_free (g3);
+  gsl_ran_discrete_dyn_free (g4);
 
   exit (gsl_test_summary ());
 }
@@ -1209,6 +1233,110 @@ test_discrete3_pdf (unsigned int n)
   return gsl_ran_discrete_pdf ((size_t) n, g3);
 }
 
+double
+test_discrete_dyn (void)
+{
+  if (g4 == NULL)
+    {
+      double P[10] = { 50, 1, 0, 1, 0.5, 2, 30, 5, 1, 9 };
+      g4 = gsl_ran_discrete_dyn_alloc (10, P);
+
+      /* after the changes the events 0..10 have the weights
+         0, 1, 7, 1, 0.5, 0, 30, 5, 1, 9, 3 */
+
+      gsl_ran_discrete_dyn_set (g4, 2, 7.0);
+      gsl_ran_discrete_dyn_insert (g4, 3.0);
+      gsl_ran_discrete_dyn_insert (g4, 0.0);
+      gsl_ran_discrete_dyn_delete (g4, 0);
+      gsl_ran_discrete_dyn_set (g4, 5, 0.0);
+      gsl_ran_discrete_dyn_insert (g4, 3.0);
+      gsl_ran_discrete_dyn_delete (g4, 10);
+    }
+  return gsl_ran_discrete_dyn (r_global, g4);
+}
+
+double
+test_discrete_dyn_pdf (unsigned int n)
+{
+  const double P[11] = { 0, 1, 7, 1, 0.5, 0, 30, 5, 1, 9, 3 };
+  return (n < 11) ? P[n] / 57.5 : 0.0;
+}
+
+void
+test_discrete_dyn_update (void)
+{
+  const size_t K = 1000;
+  gsl_ran_discrete_dyn_t *g = gsl_ran_discrete_dyn_alloc (0, NULL);
+  double *w = (double *) malloc (2 * K * sizeof (double));
+  double sum;
+  size_t i, k, n = 0;
+  int status = 0;
+
+  /* grow to K events, then make random changes, comparing the
+     weights and their sum against a plain array */
+
+  for (i = 0; i < K; i++)
+    {
+      w[n] = gsl_rng_uniform (r_global);
+      status |= gsl_ran_discrete_dyn_insert (g, w[n]);
+      n++;
+    }
+
+  for (i = 0; i < 100000; i++)
+    {
+      double u = gsl_rng_uniform (r_global);
+      k = gsl_rng_uniform_int (r_global, n);
+
+      if (u < 0.8)
+        {
+          w[k] = (u < 0.1) ? 0.0 : gsl_rng_uniform (r_global) * 1e3;
+          status |= gsl_ran_discrete_dyn_set (g, k, w[k]);
+        }
+      else if ((u < 0.9 && n < 2 * K) || n == 1)
+        {
+          w[n] = gsl_rng_uniform (r_global);
+          status |= gsl_ran_discrete_dyn_insert (g, w[n]);
+          n++;
+        }
+      else
+        {
+          w[k] = w[n - 1];
+          status |= gsl_ran_discrete_dyn_delete (g, k);
+          n--;
+        }
+    }
+
+  gsl_test (status || g->K != n, "gsl_ran_discrete_dyn updates, K = %d", (int) n);
+
+  sum = 0;
+  status = 0;
+
+  for (k = 0; k < n; k++)
+    {
+      status |= (gsl_ran_discrete_dyn_get (g, k) != w[k]);
+      sum += w[k];
+    }
+
+  gsl_test (status, "gsl_ran_discrete_dyn_get after updates");
+  gsl_test_rel (gsl_ran_discrete_dyn_total (g), sum, 1e-10,
+                "gsl_ran_discrete_dyn_total after updates");
+
+  /* events of zero weight are never chosen */
+
+  status = 0;
+
+  for (i = 0; i < 100000; i++)
+    {
+      k = gsl_ran_discrete_dyn (r_global, g);
+      status |= (k >= n || w[k] == 0);
+    }
+
+  gsl_test (status, "gsl_ran_discrete_dyn chooses events of positive weight");
+
+  gsl_ran_discrete_dyn_free (g);
+  free (w);
+}
+
 
 double
 test_erlang (void)
@@ -1234,6 +1362,27 @@ test_exponential_pdf (double x)
   return gsl_ran_exponential_pdf (x, 2.0);
 }
 
+double
+test_exponential_array (void)
+{
+  static double x[1000];
+  static size_t i = 1000;
+
+  if (i == 1000)
+    {
+      gsl_ran_exponential_array (r_global, 2.0, 1000, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_exponential_array_pdf (double x)
+{
+  return gsl_ran_exponential_pdf (x, 2.0);
+}
+
 double
 test_exppow0 (void)
 {
@@ -1407,6 +1556,48 @@ test_gamma_small_pdf (double x)
   return gsl_ran_gamma_pdf (x, 0.92, 2.17);
 }
 
+double
+test_gamma_array (void)
+{
+  static double x[1000];
+  static size_t i = 1000;
+
+  if (i == 1000)
+    {
+      gsl_ran_gamma_array (r_global, 2.5, 2.17, 1000, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_array_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 2.5, 2.17);
+}
+
+double
+test_gamma_array_small (void)
+{
+  static double x[1000];
+  static size_t i = 1000;
+
+  if (i == 1000)
+    {
+      gsl_ran_gamma_array (r_global, 0.92, 2.17, 1000, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_array_small_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 0.92, 2.17);
+}
+
 double
 test_gamma_vlarge (void)
 {
@@ -1545,6 +1736,27 @@ test_gaussian_ziggurat_pdf (double x)
   return gsl_ran_gaussian_pdf (x, 3.12);
 }
 
+double
+test_gaussian_ziggurat_array (void)
+{
+  static double x[1000];
+  static size_t i = 1000;
+
+  if (i == 1000)
+    {
+      gsl_ran_gaussian_ziggurat_array (r_global, 3.12, 1000, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gaussian_ziggurat_array_pdf (double x)
+{
+  return gsl_ran_gaussian_pdf (x, 3.12);
+}
+
 double
 test_gaussian_tail (void)
 {
@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 /* This is a combined multiple recursive generator. The sequence is,
 
@@ -63,6 +64,10 @@
 
    The period of this generator is about 2^205.
 
+   The generator jumps ahead by applying powers of the 3x3 companion
+   matrices of the two components, modulo m1 and m2, to their states.
+   The substreams have length 2^100.
+
    From: P. L'Ecuyer, "Combined Multiple Recursive Random Number
    Generators," Operations Research, 44, 5 (1996), 816--822.
 
@@ -74,6 +79,7 @@
 static inline unsigned long int cmrg_get (void *vstate);
 static double cmrg_get_double (void *vstate);
 static void cmrg_set (void *state, unsigned long int s);
+static void cmrg_jump (void *state, unsigned long int n, unsigned long int k);
 
 static const long int m1 = 2147483647, m2 = 2145483479;
 
@@ -148,6 +154,59 @@ cmrg_get_double (void *vstate)
   return cmrg_get (vstate) / 2147483647.0 ;
 }
 
+#define CMRG_SQRT_M1 46341UL     /* ceil(sqrt(m1)) */
+#define CMRG_SQRT_M2 46320UL     /* ceil(sqrt(m2)) */
+
+/* the companion matrices raised to the power 2^100, the length of a
+   substream */
+
+static const unsigned long int cmrg_split1[9] = {
+  1992091889UL, 394620073UL, 2016443347UL,
+  1827340312UL, 1992091889UL, 78211867UL,
+  1236964492UL, 1827340312UL, 235220208UL
+};
+
+static const unsigned long int cmrg_split2[9] = {
+  1791537218UL, 110198100UL, 441003749UL,
+  638430095UL, 1523949888UL, 110198100UL,
+  1687813425UL, 1165164073UL, 1523949888UL
+};
+
+static void
+cmrg_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  cmrg_state_t *state = (cmrg_state_t *) vstate;
+
+  unsigned long int a[9] = { 0 }, b[9] = { 0 };
+  unsigned long int v[3];
+
+  a[1] = a2;
+  a[2] = m1 + a3;
+  a[3] = a[7] = 1;
+
+  b[0] = b1;
+  b[2] = m2 + b3;
+  b[3] = b[7] = 1;
+
+  jump_mod_power (a, 3, m1, CMRG_SQRT_M1, n, cmrg_split1, k);
+  jump_mod_power (b, 3, m2, CMRG_SQRT_M2, n, cmrg_split2, k);
+
+  v[0] = state->x1;
+  v[1] = state->x2;
+  v[2] = state->x3;
+  jump_mod_apply (a, 3, m1, CMRG_SQRT_M1, v);
+  state->x1 = v[0];
+  state->x2 = v[1];
+  state->x3 = v[2];
+
+  v[0] = state->y1;
+  v[1] = state->y2;
+  v[2] = state->y3;
+  jump_mod_apply (b, 3, m2, CMRG_SQRT_M2, v);
+  state->y1 = v[0];
+  state->y2 = v[1];
+  state->y3 = v[2];
+}
 
 static void
 cmrg_set (void *vstate, unsigned long int s)
@@ -192,6 +251,9 @@ static const gsl_rng_type cmrg_type =
  sizeof (cmrg_state_t),
  &cmrg_set,
  &cmrg_get,
- &cmrg_get_double};
+ &cmrg_get_double,
+ 0,
+ 0,
+ &cmrg_jump};
 
 const gsl_rng_type *gsl_rng_cmrg = &cmrg_type;
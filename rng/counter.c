@@ -0,0 +1,112 @@
+/* rng/counter.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include "counter.h"
+
+/* returns the number of 32-bit words in the key of a counter-based
+   generator, or 0 for other generators */
+
+static size_t
+counter_key_size (const gsl_rng_type * T)
+{
+  if (T == gsl_rng_philox4x32)
+    return 2;
+  else if (T == gsl_rng_threefry4x32)
+    return 4;
+  else
+    return 0;
+}
+
+/* A position in the stream is the 128-bit counter ctr[0..3] of a
+   block, least significant word first, and the index 0..3 of a word
+   in the block.  The next number returned is that word. */
+
+int
+gsl_rng_counter_set (const gsl_rng * r, const unsigned long int key[],
+                     const unsigned long int ctr[], unsigned int index)
+{
+  const size_t nk = counter_key_size (r->type);
+  unsigned long int k[4] = { 0, 0, 0, 0 };
+  size_t j;
+
+  if (nk == 0)
+    {
+      GSL_ERROR ("generator is not counter-based", GSL_EINVAL);
+    }
+
+  for (j = 0; j < nk; j++)
+    {
+      k[j] = key[j];
+    }
+
+  if (index > 3)
+    {
+      GSL_ERROR ("index must be less than 4", GSL_EINVAL);
+    }
+
+  counter_reset ((counter_state_t *) r->state, k, ctr);
+
+  for (j = 0; j < index; j++)
+    {
+      (r->type->get) (r->state);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_rng_counter_get (const gsl_rng * r, unsigned long int key[],
+                     unsigned long int ctr[], unsigned int * index)
+{
+  const size_t nk = counter_key_size (r->type);
+  const counter_state_t *state = (const counter_state_t *) r->state;
+  size_t j;
+
+  if (nk == 0)
+    {
+      GSL_ERROR ("generator is not counter-based", GSL_EINVAL);
+    }
+
+  for (j = 0; j < nk; j++)
+    {
+      key[j] = state->key[j];
+    }
+
+  /* the counter of the current block, which the state has already
+     moved past unless the block is still to be computed */
+
+  for (j = 0; j < 4; j++)
+    {
+      ctr[j] = state->ctr[j];
+    }
+
+  if (state->i < 4)
+    {
+      counter_decrement (ctr);
+      *index = state->i;
+    }
+  else
+    {
+      *index = 0;
+    }
+
+  return GSL_SUCCESS;
+}
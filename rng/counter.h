@@ -0,0 +1,222 @@
+/* rng/counter.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* State shared by the counter-based generators philox4x32 and
+   threefry4x32.  Each 128-bit counter value ctr is mapped by a keyed
+   bijection to a block of four 32-bit outputs, which are returned in
+   order before the counter is incremented.  The n-th number of the
+   stream is therefore word n % 4 of the block for counter n / 4. */
+
+#define COUNTER_MASK 0xffffffffUL
+
+typedef struct
+{
+  unsigned long int ctr[4];     /* counter of the next block */
+  unsigned long int key[4];
+  unsigned long int out[4];     /* the current block */
+  unsigned int i;               /* number of words of out returned */
+}
+counter_state_t;
+
+static inline void
+counter_increment (unsigned long int ctr[4], unsigned long int m)
+{
+  size_t j;
+
+  for (j = 0; j < 4 && m; j++)
+    {
+      ctr[j] = (ctr[j] + m) & COUNTER_MASK;
+      m = (ctr[j] < m);         /* the carry into the next word */
+    }
+}
+
+static inline void
+counter_add (unsigned long int ctr[4], size_t j, unsigned long int m)
+{
+  /* adds m 2^(32 j) to the counter, for any m */
+
+  unsigned long int carry = 0;
+
+  for (; j < 4; j++)
+    {
+      const unsigned long int lo = m & COUNTER_MASK;
+      const unsigned long int t = (ctr[j] + lo) & COUNTER_MASK;
+
+      ctr[j] = (t + carry) & COUNTER_MASK;
+      carry = (t < lo) + (ctr[j] < carry);
+      m = m >> 16 >> 16;
+    }
+}
+
+static inline void
+counter_decrement (unsigned long int ctr[4])
+{
+  size_t j;
+
+  for (j = 0; j < 4; j++)
+    {
+      ctr[j] = (ctr[j] - 1) & COUNTER_MASK;
+
+      if (ctr[j] != COUNTER_MASK)
+        break;                  /* no borrow from the next word */
+    }
+}
+
+static inline void
+counter_reset (counter_state_t * state, const unsigned long int key[4],
+               const unsigned long int ctr[4])
+{
+  size_t j;
+
+  for (j = 0; j < 4; j++)
+    {
+      state->key[j] = key[j] & COUNTER_MASK;
+      state->ctr[j] = ctr[j] & COUNTER_MASK;
+    }
+
+  state->i = 4;                 /* the first get computes block ctr */
+}
+
+static inline void
+counter_seed (counter_state_t * state, unsigned long int s)
+{
+  /* the seed is used as the key, starting at counter zero */
+
+  const unsigned long int key[4] = { s & COUNTER_MASK,
+                                     (s >> 16 >> 16) & COUNTER_MASK, 0, 0 };
+  const unsigned long int ctr[4] = { 0, 0, 0, 0 };
+
+  counter_reset (state, key, ctr);
+}
+
+static inline unsigned long int
+counter_get (counter_state_t * state,
+             void (*block) (const unsigned long int[4],
+                            const unsigned long int[4], unsigned long int[4]))
+{
+  if (state->i == 4)
+    {
+      block (state->ctr, state->key, state->out);
+      counter_increment (state->ctr, 1);
+      state->i = 0;
+    }
+
+  return state->out[state->i++];
+}
+
+/* The jump function moves n words and k substreams of 2^64 blocks
+   through the stream, by adding to the counter. */
+
+static inline void
+counter_jump (counter_state_t * state, unsigned long int n, unsigned long int k,
+              void (*block) (const unsigned long int[4],
+                             const unsigned long int[4], unsigned long int[4]))
+{
+  unsigned long int w = n % 4;
+  size_t j;
+
+  /* the position is word w of the block with counter ctr */
+
+  if (state->i < 4)
+    {
+      counter_decrement (state->ctr);
+      w += state->i;
+    }
+
+  counter_add (state->ctr, 0, n / 4 + w / 4);
+  counter_add (state->ctr, 2, k);
+  w %= 4;
+
+  state->i = 4;
+
+  for (j = 0; j < w; j++)
+    counter_get (state, block);
+}
+
+/* The fill functions write whole blocks straight to the output array,
+   COUNTER_LANES blocks at a time when their counters differ only in
+   the lowest word.  The lanes function computes the blocks for
+   counters ctr[0] + l, l = 0 ... COUNTER_LANES-1, storing word j of
+   block l in out[4*l + j]; it is written as independent loops over
+   the lanes, held in arrays of unsigned int so that the compiler can
+   pack four of them into each 128-bit vector register.  The doubles are
+   converted from the integers a chunk at a time. */
+
+#define COUNTER_LANES 8
+#define COUNTER_CHUNK 64
+
+static inline void
+counter_fill (counter_state_t * state, unsigned long int x[], size_t n,
+              void (*block) (const unsigned long int[4],
+                             const unsigned long int[4], unsigned long int[4]),
+              void (*lanes) (const unsigned long int[4],
+                             const unsigned long int[4], unsigned long int[]))
+{
+  size_t j;
+
+  while (n > 0 && state->i < 4)
+    {
+      *x++ = state->out[state->i++];
+      n--;
+    }
+
+  while (n >= 4 * COUNTER_LANES
+         && state->ctr[0] <= COUNTER_MASK - (COUNTER_LANES - 1))
+    {
+      lanes (state->ctr, state->key, x);
+      counter_increment (state->ctr, COUNTER_LANES);
+      x += 4 * COUNTER_LANES;
+      n -= 4 * COUNTER_LANES;
+    }
+
+  while (n >= 4)
+    {
+      block (state->ctr, state->key, x);
+      counter_increment (state->ctr, 1);
+      x += 4;
+      n -= 4;
+    }
+
+  if (n > 0)
+    {
+      block (state->ctr, state->key, state->out);
+      counter_increment (state->ctr, 1);
+
+      for (j = 0; j < n; j++)
+        x[j] = state->out[j];
+
+      state->i = n;
+    }
+}
+
+static inline void
+counter_fill_double (void (*fill) (void *, unsigned long int[], size_t),
+                     void *vstate, double x[], size_t n)
+{
+  unsigned long int buf[COUNTER_CHUNK];
+  size_t i, j;
+
+  for (i = 0; i < n; i += COUNTER_CHUNK)
+    {
+      const size_t m = (n - i < COUNTER_CHUNK) ? n - i : COUNTER_CHUNK;
+
+      fill (vstate, buf, m);
+
+      for (j = 0; j < m; j++)
+        x[i + j] = buf[j] / 4294967296.0;
+    }
+}
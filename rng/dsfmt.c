@@ -0,0 +1,286 @@
+/* rng/dsfmt.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the double precision SIMD-oriented Fast Mersenne Twister
+   dSFMT19937 (version 2) of Saito and Matsumoto.  The state is 191
+   blocks of 128 bits, each holding two 64-bit words which are the bit
+   patterns of IEEE doubles in [1,2), and a 128-bit block L updated
+   along with them,
+
+   L = (w_{i-N} << 19) ^ swap(L) ^ w_{i-N+POS1}
+   w_i = (L >> 12) ^ (L & MSK) ^ w_{i-N}
+
+   where the shifts act on the 64-bit words, and swap exchanges the
+   32-bit halves of the two words crosswise.  The 52-bit fraction of
+   each word is the output, so that each number is a double in [0,1)
+   with 52 random bits.  The period is a multiple of 2^19937 - 1.
+
+   The words are held as pairs of 32-bit halves in unsigned int, so
+   that no 64-bit integer type is needed, and L is kept in local
+   variables through the recursion on the blocks.  The doubles are
+   formed from the fractions arithmetically, which is exact.  The
+   integer output is the upper 32 bits of the fraction.
+
+   The seeding follows the init_gen_rand function of the reference
+   implementation, with the default seed 1234 of its test output.
+
+   M. Saito and M. Matsumoto, "A PRNG specialized in double precision
+   floating point numbers using an affine transition", Monte Carlo and
+   Quasi-Monte Carlo Methods 2008, Springer (2009) 589--602. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+
+static inline unsigned long int dsfmt_get (void *vstate);
+static double dsfmt_get_double (void *vstate);
+static void dsfmt_set (void *state, unsigned long int s);
+static void dsfmt_fill (void *vstate, unsigned long int x[], size_t n);
+static void dsfmt_fill_double (void *vstate, double x[], size_t n);
+
+#define DSFMT_N 191             /* blocks of 128 bits */
+#define DSFMT_N64 (2 * DSFMT_N) /* numbers */
+#define DSFMT_POS1 117
+#define DSFMT_SL1 19
+#define DSFMT_SR 12
+
+#define MASK32 0xffffffffU
+
+/* 64-bit constants as their halves, least significant first */
+
+static const unsigned int dsfmt_msk[4] =
+  { 0xfffffb3fU, 0x000ffaffU, 0xfc90fffdU, 0x000ffdffU };
+
+static const unsigned int dsfmt_fix[4] =
+  { 0xb32f4329U, 0x90014964U, 0x548a7c7aU, 0x3b8d12acU };
+
+static const unsigned int dsfmt_pcv[4] =
+  { 0x0dc82880U, 0x3d84e1acU, 0x00000001U, 0x00000000U };
+
+static const double two_m52 = 1.0 / 4503599627370496.0;  /* 1/2^52 */
+
+typedef struct
+  {
+    unsigned int w[4 * (DSFMT_N + 1)];  /* the last block is L */
+    int i;
+  }
+dsfmt_state_t;
+
+/* computes the block r from itself and the block b, updating the
+   block L held in l0, l1, l2 and l3 */
+
+#define DSFMT_RECURSION(r,b,l0,l1,l2,l3) \
+  do { \
+    const unsigned int t0 = ((r)[0] << DSFMT_SL1) ^ l3 ^ (b)[0]; \
+    const unsigned int t1 = ((r)[1] << DSFMT_SL1) ^ ((r)[0] >> (32 - DSFMT_SL1)) ^ l2 ^ (b)[1]; \
+    const unsigned int t2 = ((r)[2] << DSFMT_SL1) ^ l1 ^ (b)[2]; \
+    const unsigned int t3 = ((r)[3] << DSFMT_SL1) ^ ((r)[2] >> (32 - DSFMT_SL1)) ^ l0 ^ (b)[3]; \
+    l0 = t0 & MASK32; \
+    l1 = t1 & MASK32; \
+    l2 = t2 & MASK32; \
+    l3 = t3 & MASK32; \
+    (r)[0] ^= ((l0 >> DSFMT_SR) ^ (l1 << (32 - DSFMT_SR)) ^ (l0 & dsfmt_msk[0])) & MASK32; \
+    (r)[1] ^= (l1 >> DSFMT_SR) ^ (l1 & dsfmt_msk[1]); \
+    (r)[2] ^= ((l2 >> DSFMT_SR) ^ (l3 << (32 - DSFMT_SR)) ^ (l2 & dsfmt_msk[2])) & MASK32; \
+    (r)[3] ^= (l3 >> DSFMT_SR) ^ (l3 & dsfmt_msk[3]); \
+  } while (0)
+
+static void
+dsfmt_generate (unsigned int *const w)
+{
+  /* generate DSFMT_N blocks at one time, with L = (l0,l1,l2,l3) */
+
+  unsigned int l0 = w[4 * DSFMT_N], l1 = w[4 * DSFMT_N + 1];
+  unsigned int l2 = w[4 * DSFMT_N + 2], l3 = w[4 * DSFMT_N + 3];
+  int i;
+
+  for (i = 0; i < DSFMT_N - DSFMT_POS1; i++)
+    DSFMT_RECURSION (w + 4 * i, w + 4 * (i + DSFMT_POS1), l0, l1, l2, l3);
+
+  for (; i < DSFMT_N; i++)
+    DSFMT_RECURSION (w + 4 * i, w + 4 * (i + DSFMT_POS1 - DSFMT_N), l0, l1, l2, l3);
+
+  w[4 * DSFMT_N] = l0;
+  w[4 * DSFMT_N + 1] = l1;
+  w[4 * DSFMT_N + 2] = l2;
+  w[4 * DSFMT_N + 3] = l3;
+}
+
+/* number j of the state has the halves w[2j] and w[2j+1] */
+
+#define DSFMT_DOUBLE(w,j) \
+  ((((w)[2 * (j) + 1] & 0xfffffU) * 4294967296.0 + (w)[2 * (j)]) * two_m52)
+
+#define DSFMT_INT(w,j) \
+  ((((w)[2 * (j) + 1] & 0xfffffUL) << 12) | ((w)[2 * (j)] >> 20))
+
+static inline unsigned long int
+dsfmt_get (void *vstate)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  unsigned long int k;
+
+  if (state->i >= DSFMT_N64)
+    {
+      dsfmt_generate (state->w);
+      state->i = 0;
+    }
+
+  k = DSFMT_INT (state->w, state->i);
+
+  state->i++;
+
+  return k;
+}
+
+static double
+dsfmt_get_double (void *vstate)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  double x;
+
+  if (state->i >= DSFMT_N64)
+    {
+      dsfmt_generate (state->w);
+      state->i = 0;
+    }
+
+  x = DSFMT_DOUBLE (state->w, state->i);
+
+  state->i++;
+
+  return x;
+}
+
+/* The array versions convert the numbers of the state directly, one
+   block of DSFMT_N64 at a time. */
+
+static void
+dsfmt_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  const unsigned int *const w = state->w;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, m;
+
+      if (state->i >= DSFMT_N64)
+        {
+          dsfmt_generate (state->w);
+          state->i = 0;
+        }
+
+      m = DSFMT_N64 - state->i;
+
+      if (m > n - i)
+        m = n - i;
+
+      for (j = 0; j < m; j++)
+        x[i + j] = DSFMT_INT (w, state->i + j);
+
+      state->i += m;
+      i += m;
+    }
+}
+
+static void
+dsfmt_fill_double (void *vstate, double x[], size_t n)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  const unsigned int *const w = state->w;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, m;
+
+      if (state->i >= DSFMT_N64)
+        {
+          dsfmt_generate (state->w);
+          state->i = 0;
+        }
+
+      m = DSFMT_N64 - state->i;
+
+      if (m > n - i)
+        m = n - i;
+
+      for (j = 0; j < m; j++)
+        x[i + j] = DSFMT_DOUBLE (w, state->i + j);
+
+      state->i += m;
+      i += m;
+    }
+}
+
+static void
+dsfmt_set (void *vstate, unsigned long int s)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  unsigned int *const w = state->w;
+  unsigned int inner = 0;
+  int i;
+
+  if (s == 0)
+    s = 1234;   /* the default seed is 1234 */
+
+  w[0] = s & MASK32;
+
+  for (i = 1; i < 4 * (DSFMT_N + 1); i++)
+    {
+      w[i] = (1812433253U * (w[i - 1] ^ (w[i - 1] >> 30)) + i) & MASK32;
+    }
+
+  /* the numbers are doubles in [1,2), with the exponent 0x3ff */
+
+  for (i = 0; i < DSFMT_N64; i++)
+    {
+      w[2 * i + 1] = (w[2 * i + 1] & 0xfffffU) | 0x3ff00000U;
+    }
+
+  state->i = DSFMT_N64;
+
+  /* The period is certified by the parity of L, offset by the fixed
+     point, against the parity vector, which is corrected by flipping
+     the lowest bit of the second word of L if necessary. */
+
+  for (i = 0; i < 4; i++)
+    inner ^= (w[4 * DSFMT_N + i] ^ dsfmt_fix[i]) & dsfmt_pcv[i];
+
+  for (i = 16; i > 0; i >>= 1)
+    inner ^= inner >> i;
+
+  if ((inner & 1) == 0)
+    w[4 * DSFMT_N + 2] ^= 1;
+}
+
+static const gsl_rng_type dsfmt_type = {
+  "dsfmt19937",                 /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (dsfmt_state_t),
+  &dsfmt_set,
+  &dsfmt_get,
+  &dsfmt_get_double,
+  &dsfmt_fill,
+  &dsfmt_fill_double,
+  0
+};
+
+const gsl_rng_type *gsl_rng_dsfmt19937 = &dsfmt_type;
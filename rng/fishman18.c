@@ -89,7 +89,10 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  0,
+  0,
+  0
 };
 
 const gsl_rng_type *gsl_rng_fishman18 = &ran_type;
@@ -156,7 +156,10 @@ static const gsl_rng_type g05faf_type =
  sizeof (g05faf_state_t),
  &g05faf_set,
  &g05faf_get,
- &g05faf_get_double
+ &g05faf_get_double,
+ 0,
+ 0,
+ 0
 };
 
 const gsl_rng_type *gsl_rng_g05faf = &g05faf_type;
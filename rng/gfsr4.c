@@ -55,6 +55,8 @@
 static inline unsigned long int gfsr4_get (void *vstate);
 static double gfsr4_get_double (void *vstate);
 static void gfsr4_set (void *state, unsigned long int s);
+static void gfsr4_fill (void *vstate, unsigned long int x[], size_t n);
+static void gfsr4_fill_double (void *vstate, double x[], size_t n);
 
 /* Magic numbers */
 #define A 471
@@ -91,6 +93,47 @@ gfsr4_get_double (void * vstate)
   return gfsr4_get (vstate) / 4294967296.0 ;
 }
 
+/* The array versions keep the position in the table in a local
+   variable, which the compiler cannot do across calls through the
+   function pointers. */
+
+static void
+gfsr4_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  gfsr4_state_t *state = (gfsr4_state_t *) vstate;
+  unsigned long int *const ra = state->ra;
+  int nd = state->nd;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      nd = (nd + 1) & M;
+      x[i] = ra[nd] = (ra[(nd + (M + 1 - A)) & M] ^ ra[(nd + (M + 1 - B)) & M] ^
+                       ra[(nd + (M + 1 - C)) & M] ^ ra[(nd + (M + 1 - D)) & M]);
+    }
+
+  state->nd = nd;
+}
+
+static void
+gfsr4_fill_double (void *vstate, double x[], size_t n)
+{
+  gfsr4_state_t *state = (gfsr4_state_t *) vstate;
+  unsigned long int *const ra = state->ra;
+  int nd = state->nd;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      nd = (nd + 1) & M;
+      ra[nd] = (ra[(nd + (M + 1 - A)) & M] ^ ra[(nd + (M + 1 - B)) & M] ^
+                ra[(nd + (M + 1 - C)) & M] ^ ra[(nd + (M + 1 - D)) & M]);
+      x[i] = ra[nd] / 4294967296.0;
+    }
+
+  state->nd = nd;
+}
+
 static void
 gfsr4_set (void *vstate, unsigned long int s)
 {
@@ -155,7 +198,10 @@ static const gsl_rng_type gfsr4_type =
  sizeof (gfsr4_state_t),
  &gfsr4_set,
  &gfsr4_get,
- &gfsr4_get_double};
+ &gfsr4_get_double,
+ &gfsr4_fill,
+ &gfsr4_fill_double,
+ 0};
 
 const gsl_rng_type *gsl_rng_gfsr4 = &gfsr4_type;
 
@@ -45,6 +45,9 @@ typedef struct
     void (*set) (void *state, unsigned long int seed);
     unsigned long int (*get) (void *state);
     double (*get_double) (void *state);
+    void (*fill) (void *state, unsigned long int x[], size_t n);
+    void (*fill_double) (void *state, double x[], size_t n);
+    void (*jump) (void *state, unsigned long int n, unsigned long int k);
   }
 gsl_rng_type;
 
@@ -61,6 +64,7 @@ gsl_rng;
 
 GSL_VAR const gsl_rng_type *gsl_rng_borosh13;
 GSL_VAR const gsl_rng_type *gsl_rng_coveyou;
+GSL_VAR const gsl_rng_type *gsl_rng_dsfmt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_cmrg;
 GSL_VAR const gsl_rng_type *gsl_rng_fishman18;
 GSL_VAR const gsl_rng_type *gsl_rng_fishman20;
@@ -75,6 +79,7 @@ GSL_VAR const gsl_rng_type *gsl_rng_mrg;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1999;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1998;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x32;
 GSL_VAR const gsl_rng_type *gsl_rng_r250;
 GSL_VAR const gsl_rng_type *gsl_rng_ran0;
 GSL_VAR const gsl_rng_type *gsl_rng_ran1;
@@ -110,10 +115,12 @@ GSL_VAR const gsl_rng_type *gsl_rng_ranlxs0;
 GSL_VAR const gsl_rng_type *gsl_rng_ranlxs1;
 GSL_VAR const gsl_rng_type *gsl_rng_ranlxs2;
 GSL_VAR const gsl_rng_type *gsl_rng_ranmar;
+GSL_VAR const gsl_rng_type *gsl_rng_sfmt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_slatec;
 GSL_VAR const gsl_rng_type *gsl_rng_taus;
 GSL_VAR const gsl_rng_type *gsl_rng_taus2;
 GSL_VAR const gsl_rng_type *gsl_rng_taus113;
+GSL_VAR const gsl_rng_type *gsl_rng_threefry4x32;
 GSL_VAR const gsl_rng_type *gsl_rng_transputer;
 GSL_VAR const gsl_rng_type *gsl_rng_tt800;
 GSL_VAR const gsl_rng_type *gsl_rng_uni;
@@ -146,6 +153,18 @@ void * gsl_rng_state (const gsl_rng * r);
 
 void gsl_rng_print_state (const gsl_rng * r);
 
+void gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], size_t n);
+void gsl_rng_uniform_array (const gsl_rng * r, double x[], size_t n);
+void gsl_rng_uniform_pos_array (const gsl_rng * r, double x[], size_t n);
+
+int gsl_rng_jump (const gsl_rng * r, unsigned long int n);
+int gsl_rng_split (const gsl_rng * r, unsigned long int k);
+
+int gsl_rng_counter_set (const gsl_rng * r, const unsigned long int key[],
+                         const unsigned long int ctr[], unsigned int index);
+int gsl_rng_counter_get (const gsl_rng * r, unsigned long int key[],
+                         unsigned long int ctr[], unsigned int * index);
+
 const gsl_rng_type * gsl_rng_env_setup (void);
 
 INLINE_DECL unsigned long int gsl_rng_get (const gsl_rng * r);
@@ -0,0 +1,215 @@
+/* rng/jump.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Matrix powers for the jump functions of the linear generators.  A
+   generator whose state v is updated by a linear map, v -> A v, is
+   advanced by n + k 2^e steps (n numbers and k substreams of length
+   2^e) by computing
+
+   A^(n + k 2^e) = A^n (A^(2^e))^k
+
+   with two binary powers, in time logarithmic in the number of steps.
+   The matrix A^(2^e) of a substream is precomputed by each generator,
+   so that substreams are found without the e squarings. */
+
+#include "schrage.c"
+
+/* Tausworthe components: 32x32 matrices over GF(2), stored as their
+   32 columns, acting on 32-bit words. */
+
+static inline unsigned long int
+jump_gf2_apply (const unsigned long int a[32], unsigned long int v)
+{
+  unsigned long int w = 0;
+  int j;
+
+  for (j = 0; j < 32; j++, v >>= 1)
+    {
+      if (v & 1)
+        w ^= a[j];
+    }
+
+  return w;
+}
+
+static inline void
+jump_gf2_mul (unsigned long int a[32], const unsigned long int b[32])
+{
+  /* computes a = a b */
+
+  unsigned long int c[32];
+  int j;
+
+  for (j = 0; j < 32; j++)
+    c[j] = jump_gf2_apply (a, b[j]);
+
+  for (j = 0; j < 32; j++)
+    a[j] = c[j];
+}
+
+static inline void
+jump_gf2_pow (unsigned long int a[32], unsigned long int n)
+{
+  /* computes a = a^n */
+
+  unsigned long int p[32];
+  int j;
+
+  for (j = 0; j < 32; j++)
+    p[j] = 1UL << j;
+
+  for (; n; n >>= 1)
+    {
+      if (n & 1)
+        jump_gf2_mul (p, a);
+
+      if (n > 1)
+        jump_gf2_mul (a, a);
+    }
+
+  for (j = 0; j < 32; j++)
+    a[j] = p[j];
+}
+
+static inline void
+jump_gf2_power (unsigned long int a[32], unsigned long int n,
+                const unsigned long int b[32], unsigned long int k)
+{
+  /* computes a = a^n b^k, where b = a^(2^e) is the matrix of a
+     substream */
+
+  unsigned long int c[32];
+  int j;
+
+  for (j = 0; j < 32; j++)
+    c[j] = b[j];
+
+  jump_gf2_pow (a, n);
+  jump_gf2_pow (c, k);
+  jump_gf2_mul (a, c);
+}
+
+/* Multiple recursive generators: d x d matrices, d <= JUMP_MOD_MAX,
+   with elements modulo m < 2^31, stored by rows.  The products use
+   Schrage's method with sqrtm = ceil(sqrt(m)). */
+
+#define JUMP_MOD_MAX 5
+
+static inline void
+jump_mod_mul (unsigned long int a[], const unsigned long int b[],
+              const size_t d, const unsigned long int m,
+              const unsigned long int sqrtm)
+{
+  /* computes a = a b */
+
+  unsigned long int c[JUMP_MOD_MAX * JUMP_MOD_MAX];
+  size_t i, j, l;
+
+  for (i = 0; i < d; i++)
+    {
+      for (j = 0; j < d; j++)
+        {
+          unsigned long int s = 0;
+
+          for (l = 0; l < d; l++)
+            {
+              s += schrage_mult (a[i * d + l], b[l * d + j], m, sqrtm);
+
+              if (s >= m)
+                s -= m;
+            }
+
+          c[i * d + j] = s;
+        }
+    }
+
+  for (i = 0; i < d * d; i++)
+    a[i] = c[i];
+}
+
+static inline void
+jump_mod_pow (unsigned long int a[], const size_t d, unsigned long int n,
+              const unsigned long int m, const unsigned long int sqrtm)
+{
+  /* computes a = a^n */
+
+  unsigned long int p[JUMP_MOD_MAX * JUMP_MOD_MAX];
+  size_t i;
+
+  for (i = 0; i < d * d; i++)
+    p[i] = (i % (d + 1) == 0);
+
+  for (; n; n >>= 1)
+    {
+      if (n & 1)
+        jump_mod_mul (p, a, d, m, sqrtm);
+
+      if (n > 1)
+        jump_mod_mul (a, a, d, m, sqrtm);
+    }
+
+  for (i = 0; i < d * d; i++)
+    a[i] = p[i];
+}
+
+static inline void
+jump_mod_power (unsigned long int a[], const size_t d, const unsigned long int m,
+                const unsigned long int sqrtm, unsigned long int n,
+                const unsigned long int b[], unsigned long int k)
+{
+  /* computes a = a^n b^k, where b = a^(2^e) is the matrix of a
+     substream */
+
+  unsigned long int c[JUMP_MOD_MAX * JUMP_MOD_MAX];
+  size_t j;
+
+  for (j = 0; j < d * d; j++)
+    c[j] = b[j];
+
+  jump_mod_pow (a, d, n, m, sqrtm);
+  jump_mod_pow (c, d, k, m, sqrtm);
+  jump_mod_mul (a, c, d, m, sqrtm);
+}
+
+static inline void
+jump_mod_apply (const unsigned long int a[], const size_t d,
+                const unsigned long int m, const unsigned long int sqrtm,
+                unsigned long int v[])
+{
+  /* computes v = a v */
+
+  unsigned long int w[JUMP_MOD_MAX];
+  size_t i, l;
+
+  for (i = 0; i < d; i++)
+    {
+      unsigned long int s = 0;
+
+      for (l = 0; l < d; l++)
+        {
+          s += schrage_mult (a[i * d + l], v[l], m, sqrtm);
+
+          if (s >= m)
+            s -= m;
+        }
+
+      w[i] = s;
+    }
+
+  for (i = 0; i < d; i++)
+    v[i] = w[i];
+}
@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 /* This is a fifth-order multiple recursive generator. The sequence is,
 
@@ -46,6 +47,9 @@
 
    The period of this generator is about 2^155.
 
+   The generator jumps ahead by applying a power of its 5x5 companion
+   matrix modulo m to the state.  The substreams have length 2^100.
+
    From: P. L'Ecuyer, F. Blouin, and R. Coutre, "A search for good
    multiple recursive random number generators", ACM Transactions on
    Modeling and Computer Simulation 3, 87-98 (1993). */
@@ -53,6 +57,7 @@
 static inline unsigned long int mrg_get (void *vstate);
 static double mrg_get_double (void *vstate);
 static void mrg_set (void *state, unsigned long int s);
+static void mrg_jump (void *state, unsigned long int n, unsigned long int k);
 
 static const long int m = 2147483647;
 static const long int a1 = 107374182, q1 = 20, r1 = 7;
@@ -100,6 +105,47 @@ mrg_get_double (void *vstate)
   return mrg_get (vstate) / 2147483647.0 ;
 }
 
+#define MRG_SQRT_M 46341UL       /* ceil(sqrt(m)) */
+
+/* the companion matrix raised to the power 2^100, the length of a
+   substream */
+
+static const unsigned long int mrg_split[25] = {
+  1462009324UL, 1809511828UL, 1753778513UL, 1782840897UL, 1510831810UL,
+  897197282UL, 1561280008UL, 1809511828UL, 1753778513UL, 1782840897UL,
+  1762092347UL, 762310327UL, 1561280008UL, 1809511828UL, 1753778513UL,
+  419339277UL, 83499994UL, 762310327UL, 1561280008UL, 1809511828UL,
+  522007123UL, 279919223UL, 83499994UL, 762310327UL, 1561280008UL
+};
+
+static void
+mrg_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  mrg_state_t *state = (mrg_state_t *) vstate;
+
+  unsigned long int a[25] = { 0 };
+  unsigned long int v[5];
+
+  a[0] = a1;
+  a[4] = a5;
+  a[5] = a[11] = a[17] = a[23] = 1;
+
+  jump_mod_power (a, 5, m, MRG_SQRT_M, n, mrg_split, k);
+
+  v[0] = state->x1;
+  v[1] = state->x2;
+  v[2] = state->x3;
+  v[3] = state->x4;
+  v[4] = state->x5;
+
+  jump_mod_apply (a, 5, m, MRG_SQRT_M, v);
+
+  state->x1 = v[0];
+  state->x2 = v[1];
+  state->x3 = v[2];
+  state->x4 = v[3];
+  state->x5 = v[4];
+}
 
 static void
 mrg_set (void *vstate, unsigned long int s)
@@ -144,6 +190,9 @@ static const gsl_rng_type mrg_type =
  sizeof (mrg_state_t),
  &mrg_set,
  &mrg_get,
- &mrg_get_double};
+ &mrg_get_double,
+ 0,
+ 0,
+ &mrg_jump};
 
 const gsl_rng_type *gsl_rng_mrg = &mrg_type;
@@ -49,15 +49,25 @@
 
    The period of this generator is 2^{19937} - 1.
 
+   The jump function uses the characteristic polynomial of the
+   generator, as described in H. Haramoto, M. Matsumoto, T. Nishimura,
+   F. Panneton and P. L'Ecuyer, "Efficient jump ahead for F2-linear
+   random number generators", INFORMS Journal on Computing, 20 (2008)
+   385--390.  The substreams are 2^128 numbers long.
+
 */
 
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "mtjump.h"
 
 static inline unsigned long int mt_get (void *vstate);
 static double mt_get_double (void *vstate);
 static void mt_set (void *state, unsigned long int s);
+static void mt_fill (void *vstate, unsigned long int x[], size_t n);
+static void mt_fill_double (void *vstate, double x[], size_t n);
+static void mt_jump (void *vstate, unsigned long int n, unsigned long int k);
 
 #define N 624   /* Period parameters */
 #define M 397
@@ -75,6 +85,43 @@ typedef struct
   }
 mt_state_t;
 
+#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
+
+static void
+mt_generate (unsigned long int *const mt)
+{
+  /* generate N words at one time */
+
+  int kk;
+
+  for (kk = 0; kk < N - M; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+    }
+  for (; kk < N - 1; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+    }
+
+  {
+    unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
+  }
+}
+
+static inline unsigned long
+mt_temper (unsigned long k)
+{
+  k ^= (k >> 11);
+  k ^= (k << 7) & 0x9d2c5680UL;
+  k ^= (k << 15) & 0xefc60000UL;
+  k ^= (k >> 18);
+
+  return k;
+}
+
 static inline unsigned long
 mt_get (void *vstate)
 {
@@ -83,48 +130,257 @@ mt_get (void *vstate)
   unsigned long k ;
   unsigned long int *const mt = state->mt;
 
-#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
-
   if (state->mti >= N)
-    {   /* generate N words at one time */
-      int kk;
+    {
+      mt_generate (mt);
+      state->mti = 0;
+    }
+
+  k = mt_temper (mt[state->mti]);
 
-      for (kk = 0; kk < N - M; kk++)
+  state->mti++;
+
+  return k;
+}
+
+static double
+mt_get_double (void * vstate)
+{
+  return mt_get (vstate) / 4294967296.0 ;
+}
+
+/* The array versions temper the words of the state directly, one
+   block of N at a time, without the per-word test of mt_get. */
+
+static void
+mt_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, m;
+
+      if (state->mti >= N)
         {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+          mt_generate (mt);
+          state->mti = 0;
         }
-      for (; kk < N - 1; kk++)
+
+      m = N - state->mti;
+
+      if (m > n - i)
+        m = n - i;
+
+      for (j = 0; j < m; j++)
+        x[i + j] = mt_temper (mt[state->mti + j]);
+
+      state->mti += m;
+      i += m;
+    }
+}
+
+static void
+mt_fill_double (void *vstate, double x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, m;
+
+      if (state->mti >= N)
         {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+          mt_generate (mt);
+          state->mti = 0;
         }
 
-      {
-        unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
-      }
+      m = N - state->mti;
 
-      state->mti = 0;
+      if (m > n - i)
+        m = n - i;
+
+      for (j = 0; j < m; j++)
+        x[i + j] = mt_temper (mt[state->mti + j]) / 4294967296.0;
+
+      state->mti += m;
+      i += m;
     }
+}
 
-  /* Tempering */
-  
-  k = mt[state->mti];
-  k ^= (k >> 11);
-  k ^= (k << 7) & 0x9d2c5680UL;
-  k ^= (k << 15) & 0xefc60000UL;
-  k ^= (k >> 18);
+/* The words x_i of the sequence satisfy sum_j phi_j x_{i+j} = 0 for
+   i >= 1, where phi is the characteristic polynomial, so the window
+   W_i = (x_i, ..., x_{i+N-1}) of the state moves L steps ahead as
 
-  state->mti++;
+   W_{i+L} = sum_j q_j W_{i+1+j},  q = x^(L-1) mod phi
 
-  return k;
+   (the lower bits of x_i are not part of the state, hence the first
+   step).  The sum is accumulated while stepping a copy of the window
+   19937 times, in a few milliseconds.  A jump over fewer than
+   MT_JUMP_MIN blocks of N words is faster by generating them. */
+
+#define MT_JUMP_MIN 65536
+
+static void
+mt_jump_apply (unsigned long int *const mt, const unsigned long int q[])
+{
+  /* the window starts at w[s], and is kept twice over in w so that
+     it can be read without wrapping around */
+
+  unsigned long int w[2 * N], acc[N];
+  int i, j, s = 0;
+
+  for (i = 0; i < N; i++)
+    {
+      w[i] = w[i + N] = mt[i];
+      acc[i] = 0;
+    }
+
+  for (j = 0; j < MT_JUMP_DEGREE; j++)
+    {
+      unsigned long y = (w[s] & UPPER_MASK) | (w[s + 1] & LOWER_MASK);
+      w[s] = w[s + N] = w[s + M] ^ (y >> 1) ^ MAGIC(y);
+
+      if (++s == N)
+        s = 0;
+
+      if ((q[j / 32] >> (j % 32)) & 1)
+        {
+          const unsigned long int *const v = w + s;
+
+          for (i = 0; i < N; i++)
+            acc[i] ^= v[i];
+        }
+    }
+
+  for (i = 0; i < N; i++)
+    mt[i] = acc[i];
 }
 
-static double
-mt_get_double (void * vstate)
+static inline unsigned long int
+mt_jump_spread (unsigned long int x)
 {
-  return mt_get (vstate) / 4294967296.0 ;
+  /* moves bit i of the 16-bit x to bit 2i, squaring it as a polynomial */
+
+  x = (x | (x << 8)) & 0x00ff00ffUL;
+  x = (x | (x << 4)) & 0x0f0f0f0fUL;
+  x = (x | (x << 2)) & 0x33333333UL;
+  x = (x | (x << 1)) & 0x55555555UL;
+
+  return x;
+}
+
+static void
+mt_jump_poly (unsigned long int q[], unsigned long int e)
+{
+  /* computes q = x^e mod phi, by squaring and multiplying by x from
+     the most significant bit of e */
+
+  unsigned long int t[2 * MT_JUMP_WORDS];
+  unsigned long int b;
+  int i, j;
+
+  for (i = 0; i < MT_JUMP_WORDS; i++)
+    q[i] = (i == 0);
+
+  for (b = 1; b <= e / 2; b <<= 1)
+    ;
+
+  for (; b > 0; b >>= 1)
+    {
+      for (i = 0; i < MT_JUMP_WORDS; i++)
+        {
+          t[2 * i] = mt_jump_spread (q[i] & 0xffffUL);
+          t[2 * i + 1] = mt_jump_spread (q[i] >> 16);
+        }
+
+      /* reduces the square modulo phi, whose leading term cancels
+         each term of degree j >= MT_JUMP_DEGREE from the top down */
+
+      for (j = 2 * MT_JUMP_DEGREE - 2; j >= MT_JUMP_DEGREE; j--)
+        {
+          if ((t[j / 32] >> (j % 32)) & 1)
+            {
+              const int ws = (j - MT_JUMP_DEGREE) / 32;
+              const int bs = (j - MT_JUMP_DEGREE) % 32;
+
+              if (bs == 0)
+                {
+                  for (i = 0; i < MT_JUMP_WORDS; i++)
+                    t[ws + i] ^= mt_jump_phi[i];
+                }
+              else
+                {
+                  for (i = 0; i < MT_JUMP_WORDS; i++)
+                    t[ws + i] ^= (mt_jump_phi[i] << bs) & 0xffffffffUL;
+
+                  for (i = 0; i < MT_JUMP_WORDS; i++)
+                    t[ws + i + 1] ^= mt_jump_phi[i] >> (32 - bs);
+                }
+            }
+        }
+
+      for (i = 0; i < MT_JUMP_WORDS; i++)
+        q[i] = t[i];
+
+      if (e & b)
+        {
+          for (i = MT_JUMP_WORDS - 1; i > 0; i--)
+            q[i] = ((q[i] << 1) & 0xffffffffUL) | (q[i - 1] >> 31);
+
+          q[0] = (q[0] << 1) & 0xffffffffUL;
+
+          if ((q[MT_JUMP_DEGREE / 32] >> (MT_JUMP_DEGREE % 32)) & 1)
+            {
+              for (i = 0; i < MT_JUMP_WORDS; i++)
+                q[i] ^= mt_jump_phi[i];
+            }
+        }
+    }
+}
+
+static void
+mt_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+
+  /* the number of words left in the current block */
+
+  const unsigned long int rem = N - state->mti;
+  unsigned long int blocks;
+
+  for (; k > 0; k--)
+    mt_jump_apply (mt, mt_jump_split);
+
+  if (n <= rem)
+    {
+      state->mti += n;
+      return;
+    }
+
+  n -= rem;
+  blocks = (n - 1) / N + 1;
+
+  if (blocks >= MT_JUMP_MIN)
+    {
+      unsigned long int q[MT_JUMP_WORDS];
+
+      /* all but the last block, which is generated below */
+
+      mt_jump_poly (q, N * (blocks - 1) - 1);
+      mt_jump_apply (mt, q);
+      blocks = 1;
+    }
+
+  for (; blocks > 0; blocks--)
+    mt_generate (mt);
+
+  state->mti = n - N * ((n - 1) / N);
 }
 
 static void
@@ -211,7 +467,10 @@ static const gsl_rng_type mt_type =
  sizeof (mt_state_t),
  &mt_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_fill,
+ &mt_fill_double,
+ &mt_jump};
 
 static const gsl_rng_type mt_1999_type =
 {"mt19937_1999",                /* name */
@@ -220,7 +479,10 @@ static const gsl_rng_type mt_1999_type =
  sizeof (mt_state_t),
  &mt_1999_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_fill,
+ &mt_fill_double,
+ &mt_jump};
 
 static const gsl_rng_type mt_1998_type =
 {"mt19937_1998",                /* name */
@@ -229,7 +491,10 @@ static const gsl_rng_type mt_1998_type =
  sizeof (mt_state_t),
  &mt_1998_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_fill,
+ &mt_fill_double,
+ &mt_jump};
 
 const gsl_rng_type *gsl_rng_mt19937 = &mt_type;
 const gsl_rng_type *gsl_rng_mt19937_1999 = &mt_1999_type;
@@ -0,0 +1,285 @@
+/* rng/mtjump.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Polynomials over GF(2) for the jump function of MT19937, stored as
+   624 words of 32 bits, least significant first.
+
+   mt_jump_phi is the characteristic polynomial of the transition
+   matrix, of degree 19937, found with the Berlekamp-Massey algorithm
+   from the lowest bit of the output.
+
+   mt_jump_split is x^(2^128 - 1) mod mt_jump_phi, which moves the state
+   one substream of 2^128 words after a single step. */
+
+#define MT_JUMP_DEGREE 19937
+#define MT_JUMP_WORDS 624
+
+static const unsigned long int mt_jump_phi[MT_JUMP_WORDS] = {
+  0x00000001UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000020UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000100UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00020000UL,
+  0x00000000UL, 0x00000800UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00004000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x20000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00200000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x01000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x08000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x40000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000002UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000010UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000080UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000400UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00020000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x20000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000002UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000200UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x02000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00200000UL, 0x00000000UL,
+  0x00000020UL, 0x80000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000100UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000800UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00004000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000002UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00002000UL,
+  0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00010000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000020UL,
+  0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000100UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00200800UL, 0x00000000UL,
+  0x00008000UL, 0x00000000UL, 0x00000000UL, 0x02000000UL, 0x00000000UL,
+  0x01004000UL, 0x00000000UL, 0x00000000UL, 0x20000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x08000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000021UL, 0x00000000UL, 0x00000000UL, 0x40000000UL,
+  0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000100UL, 0x20000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00200000UL, 0x00000000UL,
+  0x00008000UL, 0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000000UL,
+  0x21000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00001000UL,
+  0x00000000UL, 0x00000002UL, 0x08000000UL, 0x00000001UL, 0x00200000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000200UL, 0x40000000UL,
+  0x00000008UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00020000UL, 0x00000000UL, 0x00000042UL, 0x08000000UL, 0x00000000UL,
+  0x00200000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000010UL,
+  0x00000000UL, 0x00000000UL, 0x21000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000080UL, 0x00000000UL, 0x00000002UL, 0x00000000UL,
+  0x00000001UL, 0x00200000UL, 0x00000000UL, 0x00000400UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00002000UL, 0x00000000UL, 0x00000080UL, 0x00000000UL, 0x00000002UL,
+  0x00000000UL, 0x00000000UL, 0x00210000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000010UL, 0x00000000UL, 0x00000000UL, 0x01080000UL,
+  0x00000000UL, 0x00002000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000002UL, 0x08400000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000200UL, 0x42000000UL, 0x00000000UL,
+  0x00080000UL, 0x00000000UL, 0x00002000UL, 0x00000000UL, 0x00000000UL,
+  0x10000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00210000UL,
+  0x00000000UL, 0x00000000UL, 0x80000000UL, 0x00000000UL, 0x02000000UL,
+  0x00000000UL, 0x01000000UL, 0x00000000UL, 0x00002000UL, 0x00000000UL,
+  0x00000004UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000020UL, 0x80000000UL, 0x00000000UL,
+  0x02000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00002100UL,
+  0x00000000UL, 0x00000000UL, 0x10000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00010800UL, 0x00000000UL, 0x00000020UL, 0x00000000UL,
+  0x00000000UL, 0x02000000UL, 0x00000000UL, 0x00084000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00420000UL, 0x00000000UL, 0x00000800UL, 0x00000000UL, 0x00000020UL,
+  0x00000000UL, 0x00000000UL, 0x00100000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000100UL, 0x00000000UL, 0x00000000UL, 0x00800000UL,
+  0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000020UL, 0x04000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x20000000UL, 0x00000000UL,
+  0x00800000UL, 0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000001UL, 0x00000000UL, 0x00000000UL, 0x00100000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000008UL, 0x20000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000040UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000008UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00001000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00008000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00040000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000002UL
+};
+
+static const unsigned long int mt_jump_split[MT_JUMP_WORDS] = {
+  0x396f1cb1UL, 0x5ab84f62UL, 0xc413cddbUL, 0xd411fc72UL, 0x936c1f2cUL,
+  0x820f912cUL, 0xf3fedd8aUL, 0x45a90bbbUL, 0xa45af3abUL, 0xdf94096aUL,
+  0x725856dcUL, 0x85a424d5UL, 0x1f4945c1UL, 0xf4b69ce7UL, 0x57b098e9UL,
+  0x04f57974UL, 0x99aa422bUL, 0xe0c0a63dUL, 0x449d3e41UL, 0xff5e83deUL,
+  0x80dec133UL, 0x28a3ee5fUL, 0x71533ef3UL, 0xcd7f7abaUL, 0x5c19a684UL,
+  0x7869ef65UL, 0xaab0feacUL, 0xec42381dUL, 0x77ae401dUL, 0xd9cdc7a1UL,
+  0x906fdbb0UL, 0xeb0e7f69UL, 0xe7af9f2dUL, 0xa3a0b0bbUL, 0xc7422174UL,
+  0x4754e7d5UL, 0xac2e8760UL, 0x306efbd6UL, 0x164dc294UL, 0x787beb07UL,
+  0xd95d9dfeUL, 0xe51f71beUL, 0xc0e4f32cUL, 0x43876cb4UL, 0xcab9d0efUL,
+  0x67292428UL, 0xbbb41dcaUL, 0x39e6d2f6UL, 0x2b5e7e5eUL, 0x7a1ccab6UL,
+  0x0fc8ef0aUL, 0xdf825e00UL, 0xca1c6240UL, 0x0ec2cc18UL, 0xe5357051UL,
+  0x4ecbd76aUL, 0xcf23210cUL, 0x73ae4a8cUL, 0x129e0a43UL, 0x66a1a2aeUL,
+  0x39dae66cUL, 0x3fc1416aUL, 0xe46566a2UL, 0x0c96efccUL, 0xeb5f42a3UL,
+  0xa9445ac4UL, 0xda793653UL, 0xcc0caabfUL, 0x1002b875UL, 0x01f39e94UL,
+  0x93256602UL, 0xbc508a64UL, 0xcaf87dbdUL, 0x2177744bUL, 0x55e64061UL,
+  0xb3f3a8f4UL, 0x89986642UL, 0x1a0743f7UL, 0x489dcd4bUL, 0xe9fc292fUL,
+  0x9f71e902UL, 0x8dd08ac7UL, 0x96266dc4UL, 0x0fb5543eUL, 0xcdaf4d1dUL,
+  0xc3c59911UL, 0x525c61f6UL, 0x52463bbcUL, 0xcba56033UL, 0x0e84782aUL,
+  0xe4504121UL, 0x6b6f4074UL, 0x50e785a0UL, 0x94c96726UL, 0x421398e3UL,
+  0xb020b457UL, 0x6e91f736UL, 0xdf67fc59UL, 0xefd63943UL, 0xd21b4ba8UL,
+  0xd945e44eUL, 0x252c206cUL, 0xd3d2c2c1UL, 0xfa9dedf6UL, 0x67dd24cbUL,
+  0xd20a4e8eUL, 0xeae337e1UL, 0xd9639482UL, 0x6734569cUL, 0xd726c74bUL,
+  0x7909d4daUL, 0xe2c479cbUL, 0x4eb08b5dUL, 0x9630c6a7UL, 0xd9a21068UL,
+  0xf5fdb0f8UL, 0x1db8176bUL, 0x65ee5379UL, 0xbe5bc0b3UL, 0x5f1419caUL,
+  0x01d121b5UL, 0x9060684bUL, 0xf0c8553fUL, 0xdfa4dc0aUL, 0xa4ebc6e1UL,
+  0x4da2dc81UL, 0x85526264UL, 0x33f5c871UL, 0xf99589f8UL, 0x3fae7518UL,
+  0xe662414aUL, 0x320f576dUL, 0x36b557dbUL, 0x405aa9acUL, 0x395aac19UL,
+  0x78fd3bcdUL, 0x9db055baUL, 0x44c9577eUL, 0x27d304f9UL, 0x941aca39UL,
+  0xb0f3d578UL, 0xa93ee0d4UL, 0xc1a74043UL, 0x5e56b49fUL, 0x64e51dfbUL,
+  0x4a8b8bcbUL, 0xcfa08b25UL, 0xdbe9b3baUL, 0xe791679dUL, 0xae3bb3bdUL,
+  0xfa3b2d80UL, 0xa3efeb4fUL, 0xec86b70aUL, 0xeb84123fUL, 0x2ff4a889UL,
+  0x56bccb14UL, 0x6313fcf9UL, 0x7e7d8671UL, 0x079220e7UL, 0x258019c0UL,
+  0xb90b0880UL, 0x287d3c05UL, 0x8fb9588dUL, 0xdb8e545bUL, 0x7fd5a17eUL,
+  0xaa3add67UL, 0x48e1459cUL, 0x9ab777bcUL, 0x8a20e4e1UL, 0xee400436UL,
+  0xcb623a48UL, 0xdae18764UL, 0xd12a7216UL, 0x54990d6eUL, 0xcb1d1b09UL,
+  0xe185f72dUL, 0xa1ae3ae3UL, 0x6f8a0991UL, 0x9c1847acUL, 0x449371c7UL,
+  0x38db4ac9UL, 0x44bbaa6cUL, 0x1e6eef2fUL, 0x2de030baUL, 0xd6a90482UL,
+  0x5f5dc053UL, 0xae61426aUL, 0x6c8eae99UL, 0xc635d3a4UL, 0x88848720UL,
+  0x19ddcc94UL, 0x23167fdeUL, 0xe2152847UL, 0x77e34302UL, 0xb0151d0aUL,
+  0x1187366cUL, 0x93637cfaUL, 0xa4dc7598UL, 0x28de9ac6UL, 0xbe24f3d2UL,
+  0xa3dac965UL, 0x8c885d9cUL, 0x1e76b52dUL, 0xd686528cUL, 0xc9a30ee5UL,
+  0x6cc653bcUL, 0xca934a47UL, 0xf662e5b2UL, 0xfe8d218dUL, 0x05eee43eUL,
+  0x2eb4a012UL, 0x3ecc1056UL, 0xfff5aa9cUL, 0xb8b60d70UL, 0x09e7fd97UL,
+  0x827c76c3UL, 0xebbbf81cUL, 0x8d9975cbUL, 0x43e0d4afUL, 0x449ed277UL,
+  0x611af8b6UL, 0x4b288c6aUL, 0x753cca5dUL, 0xfcc811f1UL, 0xddc622a2UL,
+  0x44893452UL, 0xf3e7a35aUL, 0xa68b1c30UL, 0x05962b40UL, 0xe5344607UL,
+  0x9b38172fUL, 0xdc31a35aUL, 0xaaf188ddUL, 0x3943009bUL, 0x8a17ee2eUL,
+  0xa3e88719UL, 0x11a67065UL, 0x56044618UL, 0x47ca81ffUL, 0xa6bcd174UL,
+  0xc9bb3863UL, 0x015a604aUL, 0x107c7a70UL, 0x040299e0UL, 0xc0ff4799UL,
+  0xd58e8612UL, 0x0247bbb6UL, 0xdb00dd94UL, 0x4b002523UL, 0xfc5c74b7UL,
+  0x343157bdUL, 0x254fd021UL, 0x585b7b31UL, 0x2a1c256aUL, 0xd1a86077UL,
+  0xc0b3852bUL, 0x13032ee0UL, 0x9d161410UL, 0xdabafc4cUL, 0x5cba4b33UL,
+  0x39c6fe15UL, 0x55429c1cUL, 0x00666221UL, 0x529d4952UL, 0x67d7ad1fUL,
+  0xdee467d1UL, 0x84c42132UL, 0xa94ff74eUL, 0x526bfc27UL, 0x4b36384fUL,
+  0x26405e21UL, 0xe8a132eaUL, 0xfaf5f3f9UL, 0xd91e1576UL, 0x402291f8UL,
+  0xdbea3e21UL, 0x53e58554UL, 0xb99b82b4UL, 0x036c8562UL, 0xb30ac50fUL,
+  0x4c02e3d6UL, 0x6251c4c6UL, 0x3c4856efUL, 0x3fe29b48UL, 0x42e1cd90UL,
+  0x62a13f04UL, 0xe064327cUL, 0x17dd02f6UL, 0xe1b280bdUL, 0x1085695fUL,
+  0xc7fdcaf5UL, 0x304e5001UL, 0x473627b9UL, 0x427331e2UL, 0x1e0882b1UL,
+  0xba9e0e54UL, 0x43805b91UL, 0x2432157fUL, 0x0a564a96UL, 0x6778891fUL,
+  0x76c24b9eUL, 0xf83adc5cUL, 0x067562e4UL, 0x780512adUL, 0x6fe6a43eUL,
+  0x3f3bf06dUL, 0xc5f2ba86UL, 0x0038e5cbUL, 0xab0413ffUL, 0x14620c37UL,
+  0x57a024f8UL, 0xdfb49d6bUL, 0xd488d56eUL, 0x17180368UL, 0xaf5addbaUL,
+  0x974244fcUL, 0x61b75c1eUL, 0xc213c0b2UL, 0x411815a3UL, 0x30f0735fUL,
+  0x02111307UL, 0x08dace2bUL, 0x7279064eUL, 0x4e6af655UL, 0xfc33716dUL,
+  0xcde39291UL, 0x29620b33UL, 0x40b7a99eUL, 0x23d191afUL, 0x506dffcfUL,
+  0x863153abUL, 0x754e52d1UL, 0xef03b0d3UL, 0x628933f4UL, 0x1f76956bUL,
+  0xf945c433UL, 0xb4af690fUL, 0x7ebb4b31UL, 0xc832d7a7UL, 0xde23fe6fUL,
+  0x6fe5312cUL, 0xa1271cceUL, 0x0b36160dUL, 0xdd8199afUL, 0x9539d0d0UL,
+  0x625f19eeUL, 0x7349682cUL, 0xa2ba35e1UL, 0xca4a1e03UL, 0x83e9c6bfUL,
+  0x3042e7d9UL, 0x3a5c28f2UL, 0xed9e9561UL, 0xedcefa83UL, 0x4369991dUL,
+  0x2e3632a6UL, 0x415fd611UL, 0xda6e9819UL, 0xc93f011dUL, 0xdb930d2fUL,
+  0x9a7f40bcUL, 0x2079b0dfUL, 0x324f3c2cUL, 0x738b2807UL, 0xb2c39d83UL,
+  0x1ae37705UL, 0x7d943263UL, 0x7262ea7eUL, 0x140c80e3UL, 0xe2c77142UL,
+  0xf2fe51e6UL, 0x22401c32UL, 0xfc287bfbUL, 0xfcfa0fa0UL, 0xa2f5aa9cUL,
+  0x43e5f9e4UL, 0x5f17c03aUL, 0xd702b209UL, 0x9e2e5caaUL, 0xec7f48b7UL,
+  0x576144efUL, 0xe8c665afUL, 0x0777c0dfUL, 0x2220abf9UL, 0xa3481b25UL,
+  0x6f4c50baUL, 0xe0acbf50UL, 0xe84a2d8dUL, 0x58f69f0bUL, 0xbcb3b73dUL,
+  0x72caf5e0UL, 0x5141defbUL, 0x32461ab8UL, 0x3503592eUL, 0x1cc58ac0UL,
+  0x86f589c6UL, 0x72888477UL, 0xa31e84b5UL, 0x8eed3a0bUL, 0xd7ff0095UL,
+  0x3917818bUL, 0xe5800c49UL, 0x11c3ae7bUL, 0x416baa69UL, 0x44c88a6fUL,
+  0x1048e726UL, 0xe923abdaUL, 0x454a277cUL, 0xc2ca0a2dUL, 0xf6fc7895UL,
+  0xccc7257fUL, 0x79860674UL, 0x4e7300f1UL, 0xd932bd2cUL, 0x9b5428eeUL,
+  0x4a637646UL, 0x76a35c9cUL, 0xc356d238UL, 0xa04da83eUL, 0x23638a54UL,
+  0x02e43154UL, 0x5b14021fUL, 0x2de250c4UL, 0x46bb1d46UL, 0x856e0c5bUL,
+  0xbfadd3cbUL, 0xb4839a8cUL, 0xaeda5e35UL, 0x2226ace8UL, 0x1e843f11UL,
+  0xf4e02744UL, 0x30b337a8UL, 0xaa455273UL, 0x8a8fe802UL, 0xc8aaa9c4UL,
+  0xb0482b30UL, 0xaf46ab0cUL, 0x1f1e42b0UL, 0x1ce35c0eUL, 0x12488ab6UL,
+  0x7e17fa53UL, 0x8bda6a16UL, 0xc164de3cUL, 0x15eb8267UL, 0x3d92b477UL,
+  0x82a01920UL, 0xae91346cUL, 0x3f113db5UL, 0xec35f63dUL, 0x118f8873UL,
+  0xdd00b418UL, 0xcb27c288UL, 0xd1db990fUL, 0xcc39e190UL, 0x9a01616eUL,
+  0xd2d12870UL, 0x932bd1c2UL, 0x639c6923UL, 0x0092a0e5UL, 0xe699c39eUL,
+  0x62c83f8dUL, 0x6c46e416UL, 0x2e15aa05UL, 0xab2b6652UL, 0x0fc43ee8UL,
+  0x51ecc3dcUL, 0x41f3ff24UL, 0x8351433cUL, 0x6b2b416dUL, 0xa32f96fcUL,
+  0x4da0a670UL, 0xfd647fdeUL, 0xacc78ce6UL, 0xd8956412UL, 0x7d4c918dUL,
+  0x172e10bfUL, 0x1d96c5d1UL, 0x72a87eddUL, 0xc7288003UL, 0x4225b399UL,
+  0x1f2b98caUL, 0xf7245493UL, 0x6e669b5eUL, 0x20e1ca64UL, 0x0953cb10UL,
+  0x50cdb3f9UL, 0x451fe953UL, 0xc5142e03UL, 0x1d0bdbecUL, 0x9b1b8285UL,
+  0x31efe501UL, 0x394ab23fUL, 0xbd3d9dddUL, 0xdf473b00UL, 0x753302a4UL,
+  0x1e0f288dUL, 0xe3d0c98dUL, 0x03620602UL, 0x5bcb67b8UL, 0x3e8c4332UL,
+  0xe76cfd1cUL, 0xdcfb8018UL, 0xb00f163aUL, 0x43ff4b9aUL, 0x7c66a4d8UL,
+  0xf7b22eebUL, 0x3e82d991UL, 0xa1aeb89cUL, 0x2e017a3fUL, 0x48193d13UL,
+  0xb1f669d9UL, 0xd5ea7112UL, 0x80b12192UL, 0x98160b30UL, 0x6dfdf5c9UL,
+  0x0e6fd35eUL, 0xc2328cd1UL, 0xd8acc3f6UL, 0x089d6b78UL, 0x0618f642UL,
+  0x11951ad9UL, 0xda099048UL, 0xc96861e2UL, 0xa9a8b971UL, 0x84affe65UL,
+  0x7e335054UL, 0x499601c7UL, 0x92a31d37UL, 0x6660af23UL, 0x0ddd7e3aUL,
+  0x1e79541cUL, 0xd4243318UL, 0x0823f012UL, 0xc202da57UL, 0xed1b39c6UL,
+  0x0f762639UL, 0x44598748UL, 0x27cff882UL, 0x42f753c0UL, 0x3715bed4UL,
+  0xa06cfedfUL, 0x37f5ac9eUL, 0x1e42869eUL, 0xb2b03606UL, 0x583c5118UL,
+  0xb818450aUL, 0x33ad7cdeUL, 0x36cd3e5fUL, 0xf6b9f719UL, 0xb1b3028cUL,
+  0x8b80eec6UL, 0x87314aafUL, 0x8c06d874UL, 0x5e5b3509UL, 0x69e1669fUL,
+  0x3c3dc455UL, 0x42fedf24UL, 0x5143ce29UL, 0xcabcfc7cUL, 0xc817fea0UL,
+  0xa5be353dUL, 0x8faf0245UL, 0xc71316c4UL, 0x3836924aUL, 0x75d5ec3cUL,
+  0xc0b6bfa1UL, 0x4466fdf8UL, 0x9f3662c5UL, 0xbaa53251UL, 0x453efd7eUL,
+  0xf4c68501UL, 0x5b1e697bUL, 0x9c64642eUL, 0x3962dabfUL, 0x5cbf9585UL,
+  0xf23ced3aUL, 0x2a9f19fbUL, 0x3e431195UL, 0xd9ae647cUL, 0x76e31336UL,
+  0x6533f3ffUL, 0x8a5bfb44UL, 0x8396cdbdUL, 0x59e9eb37UL, 0xa9463525UL,
+  0x090802dcUL, 0x86f95b11UL, 0x43e98f9cUL, 0x89672feaUL, 0x76d7659bUL,
+  0xa4ef617aUL, 0x4729ff92UL, 0x73cf21adUL, 0x3b2020d5UL, 0x14d1f738UL,
+  0xd9acdeafUL, 0x2d511823UL, 0x981d6682UL, 0x5c151683UL, 0x8b2bcae1UL,
+  0xd3255b99UL, 0xca87d560UL, 0xefd1430fUL, 0xff8eaf01UL, 0x466b7432UL,
+  0xaf59b076UL, 0xb1ce5831UL, 0x0cf0d3a6UL, 0x3f609294UL, 0xbbae106bUL,
+  0xd22626efUL, 0x043916bfUL, 0x58649699UL, 0x41e8a2deUL, 0x1d9103f4UL,
+  0xb9ed3072UL, 0xd09e8494UL, 0xcb1409dcUL, 0x39c7a105UL, 0x75b2b96bUL,
+  0x8a8d2965UL, 0xc0525077UL, 0x11f7722bUL, 0x00000001UL
+};
@@ -0,0 +1,206 @@
+/* rng/philox.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the counter-based generator Philox4x32-10 of Salmon et al.
+   A 128-bit counter (x0,x1,x2,x3) is passed through ten rounds of
+
+   (x0,x1,x2,x3) -> (hi(M1 x2) ^ x1 ^ k0, lo(M1 x2),
+                     hi(M0 x0) ^ x3 ^ k1, lo(M0 x0))
+
+   where hi and lo are the upper and lower 32 bits of the 64-bit
+   products, M0 = 0xD2511F53 and M1 = 0xCD9E8D57.  The 64-bit key
+   (k0,k1) is incremented by the Weyl constants (0x9E3779B9,0xBB67AE85)
+   between rounds.  Each counter value gives four 32-bit outputs.  The
+   period is 2^130 for each of the 2^64 keys.
+
+   The seed is used as the key, with the counter starting at zero.  The
+   function gsl_rng_counter_set selects any key and counter.  A jump
+   adds to the counter; the substreams are 2^64 blocks long.
+
+   The results agree with the known-answer tests of the reference
+   implementation.
+
+   J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, "Parallel
+   random numbers: as easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing, Networking,
+   Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include "counter.h"
+
+static inline unsigned long int philox4x32_get (void *vstate);
+static double philox4x32_get_double (void *vstate);
+static void philox4x32_set (void *state, unsigned long int s);
+static void philox4x32_fill (void *vstate, unsigned long int x[], size_t n);
+static void philox4x32_fill_double (void *vstate, double x[], size_t n);
+static void philox4x32_jump (void *vstate, unsigned long int n, unsigned long int k);
+
+#define PHILOX_M0 0xD2511F53UL
+#define PHILOX_M1 0xCD9E8D57UL
+#define PHILOX_W0 0x9E3779B9UL
+#define PHILOX_W1 0xBB67AE85UL
+
+/* upper and lower 32 bits of the product of 32-bit a and b */
+
+#if ULONG_MAX > 0xffffffffUL
+#define PHILOX_MULHILO(a,b,hi,lo) \
+  do { \
+    const unsigned long int p = (a) * (b); \
+    hi = p >> 32; \
+    lo = p & COUNTER_MASK; \
+  } while (0)
+#else
+#define PHILOX_MULHILO(a,b,hi,lo) \
+  do { \
+    const unsigned long int a0 = (a) & 0xffffUL, a1 = (a) >> 16; \
+    const unsigned long int b0 = (b) & 0xffffUL, b1 = (b) >> 16; \
+    const unsigned long int p00 = a0 * b0, p01 = a0 * b1; \
+    const unsigned long int p10 = a1 * b0, p11 = a1 * b1; \
+    const unsigned long int mid = (p00 >> 16) + (p01 & 0xffffUL) + (p10 & 0xffffUL); \
+    lo = (p00 & 0xffffUL) | ((mid & 0xffffUL) << 16); \
+    hi = p11 + (p01 >> 16) + (p10 >> 16) + (mid >> 16); \
+  } while (0)
+#endif
+
+#define PHILOX_ROUND(x0,x1,x2,x3,k0,k1) \
+  do { \
+    unsigned long int hi0, lo0, hi1, lo1; \
+    PHILOX_MULHILO (PHILOX_M0, x0, hi0, lo0); \
+    PHILOX_MULHILO (PHILOX_M1, x2, hi1, lo1); \
+    x0 = hi1 ^ x1 ^ k0; \
+    x1 = lo1; \
+    x2 = hi0 ^ x3 ^ k1; \
+    x3 = lo0; \
+  } while (0)
+
+static void
+philox4x32_block (const unsigned long int ctr[4],
+                  const unsigned long int key[4], unsigned long int out[4])
+{
+  unsigned long int x0 = ctr[0], x1 = ctr[1], x2 = ctr[2], x3 = ctr[3];
+  unsigned long int k0 = key[0], k1 = key[1];
+  int r;
+
+  for (r = 0; r < 10; r++)
+    {
+      if (r > 0)
+        {
+          k0 = (k0 + PHILOX_W0) & COUNTER_MASK;
+          k1 = (k1 + PHILOX_W1) & COUNTER_MASK;
+        }
+
+      PHILOX_ROUND (x0, x1, x2, x3, k0, k1);
+    }
+
+  out[0] = x0;
+  out[1] = x1;
+  out[2] = x2;
+  out[3] = x3;
+}
+
+static void
+philox4x32_lanes (const unsigned long int ctr[4],
+                  const unsigned long int key[4], unsigned long int out[])
+{
+  unsigned int x0[COUNTER_LANES], x1[COUNTER_LANES];
+  unsigned int x2[COUNTER_LANES], x3[COUNTER_LANES];
+  unsigned long int k0 = key[0], k1 = key[1];
+  int l, r;
+
+  for (l = 0; l < COUNTER_LANES; l++)
+    {
+      x0[l] = ctr[0] + l;
+      x1[l] = ctr[1];
+      x2[l] = ctr[2];
+      x3[l] = ctr[3];
+    }
+
+  for (r = 0; r < 10; r++)
+    {
+      if (r > 0)
+        {
+          k0 = (k0 + PHILOX_W0) & COUNTER_MASK;
+          k1 = (k1 + PHILOX_W1) & COUNTER_MASK;
+        }
+
+      for (l = 0; l < COUNTER_LANES; l++)
+        PHILOX_ROUND (x0[l], x1[l], x2[l], x3[l], k0, k1);
+    }
+
+  for (l = 0; l < COUNTER_LANES; l++)
+    {
+      out[4 * l] = x0[l];
+      out[4 * l + 1] = x1[l];
+      out[4 * l + 2] = x2[l];
+      out[4 * l + 3] = x3[l];
+    }
+}
+
+static inline unsigned long int
+philox4x32_get (void *vstate)
+{
+  return counter_get ((counter_state_t *) vstate, &philox4x32_block);
+}
+
+static double
+philox4x32_get_double (void *vstate)
+{
+  return philox4x32_get (vstate) / 4294967296.0;
+}
+
+static void
+philox4x32_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  counter_fill ((counter_state_t *) vstate, x, n,
+                &philox4x32_block, &philox4x32_lanes);
+}
+
+static void
+philox4x32_fill_double (void *vstate, double x[], size_t n)
+{
+  counter_fill_double (&philox4x32_fill, vstate, x, n);
+}
+
+static void
+philox4x32_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  counter_jump ((counter_state_t *) vstate, n, k, &philox4x32_block);
+}
+
+static void
+philox4x32_set (void *vstate, unsigned long int s)
+{
+  counter_seed ((counter_state_t *) vstate, s);
+}
+
+static const gsl_rng_type philox4x32_type = {
+  "philox4x32",                 /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (counter_state_t),
+  &philox4x32_set,
+  &philox4x32_get,
+  &philox4x32_get_double,
+  &philox4x32_fill,
+  &philox4x32_fill_double,
+  &philox4x32_jump
+};
+
+const gsl_rng_type *gsl_rng_philox4x32 = &philox4x32_type;
@@ -95,6 +95,9 @@ static const gsl_rng_type ran0_type =
  sizeof (ran0_state_t),
  &ran0_set,
  &ran0_get,
- &ran0_get_double};
+ &ran0_get_double,
+ 0,
+ 0,
+ 0};
 
 const gsl_rng_type *gsl_rng_ran0 = &ran0_type;
@@ -34,6 +34,9 @@ static double ranlxd_get_double (void *vstate);
 static void ranlxd_set_lux (void *state, unsigned long int s, unsigned int luxury);
 static void ranlxd1_set (void *state, unsigned long int s);
 static void ranlxd2_set (void *state, unsigned long int s);
+static void ranlxd_fill (void *vstate, unsigned long int x[], size_t n);
+static void ranlxd_fill_double (void *vstate, double x[], size_t n);
+static void ranlxd_jump (void *vstate, unsigned long int n, unsigned long int k);
 
 static const int next[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0};
 
@@ -167,6 +170,461 @@ ranlxd_get_double (void *vstate)
   return state->xdbl[state->ir];
 }
 
+/* The array versions step through the 12 numbers of the state held in
+   a local index, updating the state only when it is exhausted. */
+
+static void
+ranlxd_fill_double (void *vstate, double x[], size_t n)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+  unsigned int ir = state->ir;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      ir = next[ir];
+
+      if (ir == state->ir_old)
+        {
+          state->ir = ir;
+          increment_state (state);
+          ir = state->ir;
+        }
+
+      x[i] = state->xdbl[ir];
+    }
+
+  state->ir = ir;
+}
+
+static void
+ranlxd_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+  unsigned int ir = state->ir;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      ir = next[ir];
+
+      if (ir == state->ir_old)
+        {
+          state->ir = ir;
+          increment_state (state);
+          ir = state->ir;
+        }
+
+      x[i] = state->xdbl[ir] * 4294967296.0;    /* 2^32 */
+    }
+
+  state->ir = ir;
+}
+
+/* The jump function uses the equivalence of the subtract-with-borrow
+   recurrence x_n = x_{n-5} - x_{n-12} - c_{n-1} (mod b = 2^48) to a
+   linear congruential generator with the 576-bit prime modulus
+
+   m = b^12 - b^5 + 1
+
+   and multiplier 1/b mod m (Tezuka, L'Ecuyer and Couture, 1993).  The
+   state (x_{n-12}, ..., x_{n-1}, c_{n-1}) corresponds to
+
+   X_n = sum_j x_{n-12+j} b^j - sum_j x_{n-5+j} b^j + c_{n-1}  (mod m)
+
+   with the sums over j = 0..11 and j = 0..4, and X_{n+1} = X_n / b.
+   Going back the other way, x_{n-1} = floor(b X_n / m), and the
+   remainder b X_n mod m is X_{n-1}.  Each block of 12 numbers costs
+   pr steps of the recurrence, so the state jumps N blocks ahead by
+   multiplying X by (1/b)^(pr N) mod m.  The numbers are held in 36
+   limbs of 16 bits.  The substreams have length 2^192 blocks.
+
+   M. Luescher, "A portable high-quality random number generator for
+   lattice field theory simulations", Computer Physics Communications,
+   79 (1994) 100--110.
+
+   S. Tezuka, P. L'Ecuyer and R. Couture, "On the lattice structure of
+   the add-with-carry and subtract-with-borrow random number
+   generators", ACM Transactions on Modeling and Computer Simulation,
+   3 (1993) 315--331. */
+
+#define RANLXD_LIMBS 36
+
+/* the multipliers (1/b)^(pr 2^192) of a substream for pr = 202 and
+   pr = 397 */
+
+static const unsigned long int ranlxd1_split[RANLXD_LIMBS] = {
+  0x48d7UL, 0xd821UL, 0x0cadUL, 0xa409UL, 0x737cUL, 0x0504UL,
+  0x8e71UL, 0x2631UL, 0x7851UL, 0x238aUL, 0xe66cUL, 0x3a6bUL,
+  0xe570UL, 0x50a7UL, 0x9fedUL, 0x88f4UL, 0x6ae8UL, 0xd9abUL,
+  0x7855UL, 0xdbccUL, 0x7b73UL, 0xb9fcUL, 0xf4b1UL, 0xf403UL,
+  0x22bfUL, 0x3137UL, 0x1fdeUL, 0xd95bUL, 0x029eUL, 0x98feUL,
+  0x9ed8UL, 0xdf34UL, 0xb25cUL, 0x9241UL, 0x7442UL, 0xb493UL
+};
+
+static const unsigned long int ranlxd2_split[RANLXD_LIMBS] = {
+  0x26e4UL, 0x4d92UL, 0x0bd5UL, 0x0998UL, 0x50e6UL, 0x5582UL,
+  0xba90UL, 0xdd11UL, 0x542aUL, 0xa9c2UL, 0x80d5UL, 0x3750UL,
+  0xf6cdUL, 0xc69bUL, 0x498cUL, 0xd53eUL, 0xd222UL, 0x228bUL,
+  0xa41bUL, 0xc383UL, 0x6a50UL, 0x845cUL, 0x4d91UL, 0xd4ecUL,
+  0x056cUL, 0x9f36UL, 0xfdddUL, 0xed79UL, 0xf916UL, 0x9f49UL,
+  0xcf1eUL, 0xfb07UL, 0xe876UL, 0xb9dbUL, 0xb1e1UL, 0x705dUL
+};
+
+/* the number of blocks below which the state is incremented directly */
+
+#define RANLXD_JUMP_MIN 64
+
+static void
+ranlxd_big_modulus (unsigned long int m[])
+{
+  /* m = 2^576 - 2^240 + 1 */
+
+  size_t i;
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    m[i] = (i >= 15) ? 0xffffUL : 0;
+
+  m[0] = 1;
+}
+
+static int
+ranlxd_big_compare (const long int t[], const unsigned long int m[])
+{
+  int i;
+
+  for (i = RANLXD_LIMBS - 1; i >= 0; i--)
+    {
+      if ((unsigned long int) t[i] != m[i])
+        return ((unsigned long int) t[i] > m[i]) ? 1 : -1;
+    }
+
+  return 0;
+}
+
+static size_t
+ranlxd_big_normalize (long int t[], size_t len)
+{
+  /* propagates the carries so that each limb is in [0, 2^16), for a
+     non-negative total, and returns the length without leading zeros
+     above the first RANLXD_LIMBS limbs */
+
+  size_t i;
+
+  for (i = 0; i + 1 < len; i++)
+    {
+      const long int c = (t[i] >= 0) ? t[i] / 65536 : -((65535 - t[i]) / 65536);
+
+      t[i] -= c * 65536;
+      t[i + 1] += c;
+    }
+
+  while (len > RANLXD_LIMBS && t[len - 1] == 0)
+    len--;
+
+  return len;
+}
+
+static void
+ranlxd_big_reduce (long int t[], size_t len, unsigned long int r[])
+{
+  /* reduces the normalized number t of len limbs modulo m, using
+     2^576 = 2^240 - 1 (mod m).  The array t must have space for
+     len + 16 limbs. */
+
+  unsigned long int m[RANLXD_LIMBS];
+  size_t i;
+
+  while (len > RANLXD_LIMBS)
+    {
+      const size_t nh = len - RANLXD_LIMBS;
+      const size_t top = (nh + 15 > RANLXD_LIMBS) ? nh + 15 : RANLXD_LIMBS;
+
+      for (i = len; i <= top; i++)
+        t[i] = 0;
+
+      for (i = 0; i < nh; i++)
+        {
+          const long int h = t[RANLXD_LIMBS + i];
+
+          t[RANLXD_LIMBS + i] = 0;
+          t[i] -= h;
+          t[i + 15] += h;
+        }
+
+      len = ranlxd_big_normalize (t, top + 1);
+    }
+
+  ranlxd_big_modulus (m);
+
+  if (ranlxd_big_compare (t, m) >= 0)
+    {
+      for (i = 0; i < RANLXD_LIMBS; i++)
+        t[i] -= m[i];
+
+      ranlxd_big_normalize (t, RANLXD_LIMBS);
+    }
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    r[i] = t[i];
+}
+
+static void
+ranlxd_big_mul (const unsigned long int a[], const unsigned long int b[],
+                unsigned long int r[])
+{
+  /* computes r = a b mod m, r may be the same as a or b */
+
+  unsigned long int u[2 * RANLXD_LIMBS];
+  long int t[2 * RANLXD_LIMBS + 16];
+  size_t i, j;
+
+  for (i = 0; i < 2 * RANLXD_LIMBS; i++)
+    u[i] = 0;
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    {
+      unsigned long int c = 0;
+
+      for (j = 0; j < RANLXD_LIMBS; j++)
+        {
+          const unsigned long int s = u[i + j] + a[i] * b[j] + c;
+
+          u[i + j] = s & 0xffffUL;
+          c = s >> 16;
+        }
+
+      u[i + RANLXD_LIMBS] = c;
+    }
+
+  for (i = 0; i < 2 * RANLXD_LIMBS; i++)
+    t[i] = u[i];
+
+  ranlxd_big_reduce (t, ranlxd_big_normalize (t, 2 * RANLXD_LIMBS), r);
+}
+
+static void
+ranlxd_big_pow (unsigned long int a[], unsigned long int n)
+{
+  /* computes a = a^n mod m */
+
+  unsigned long int p[RANLXD_LIMBS];
+  size_t i;
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    p[i] = (i == 0);
+
+  for (; n; n >>= 1)
+    {
+      if (n & 1)
+        ranlxd_big_mul (p, a, p);
+
+      if (n > 1)
+        ranlxd_big_mul (a, a, a);
+    }
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    a[i] = p[i];
+}
+
+static void
+ranlxd_digit_to_limbs (double x, unsigned long int l[])
+{
+  /* splits the 48-bit fraction x into three limbs, exactly */
+
+  unsigned long int d;
+  int i;
+
+  for (i = 2; i >= 0; i--)
+    {
+      x *= 65536.0;
+      d = (unsigned long int) x;
+      x -= d;
+      l[i] = d;
+    }
+}
+
+static double
+ranlxd_limbs_to_digit (const unsigned long int l[])
+{
+  return ((l[2] * 65536.0 + l[1]) * 65536.0 + l[0]) * one_bit;
+}
+
+static void
+ranlxd_to_big (const ranlxd_state_t * state, int with_carry,
+               unsigned long int x[])
+{
+  /* computes X for the state with its oldest number at ir_old */
+
+  const unsigned int p = state->ir_old;
+  unsigned long int l[3], m[RANLXD_LIMBS];
+  long int t[RANLXD_LIMBS + 17];
+  size_t i, j;
+
+  ranlxd_big_modulus (m);
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    t[i] = m[i];                /* m is added to keep the sum positive */
+
+  for (i = RANLXD_LIMBS; i < RANLXD_LIMBS + 17; i++)
+    t[i] = 0;
+
+  for (j = 0; j < 12; j++)
+    {
+      ranlxd_digit_to_limbs (state->xdbl[(p + j) % 12], l);
+
+      for (i = 0; i < 3; i++)
+        t[3 * j + i] += l[i];
+    }
+
+  for (j = 0; j < 5; j++)
+    {
+      ranlxd_digit_to_limbs (state->xdbl[(p + 7 + j) % 12], l);
+
+      for (i = 0; i < 3; i++)
+        t[3 * j + i] -= l[i];
+    }
+
+  if (with_carry && state->carry > 0)
+    t[0] += 1;
+
+  ranlxd_big_reduce (t, ranlxd_big_normalize (t, RANLXD_LIMBS + 1), x);
+}
+
+static void
+ranlxd_from_big (ranlxd_state_t * state, const unsigned long int x[])
+{
+  /* sets the numbers and the carry of the state from X, keeping the
+     position ir_old of the oldest number */
+
+  const unsigned int p = state->ir_old;
+  unsigned long int y[RANLXD_LIMBS], z[RANLXD_LIMBS], m[RANLXD_LIMBS];
+  long int t[RANLXD_LIMBS + 17];
+  size_t i, k;
+
+  ranlxd_big_modulus (m);
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    y[i] = x[i];
+
+  for (k = 0; k < 12; k++)
+    {
+      /* b y = q m + r with q = x_{n-1-k}, r = X_{n-1-k}; writing
+         b y = H 2^576 + L gives r = L + H (2^240 - 1) - (q - H) m */
+
+      unsigned long int q[3];
+
+      for (i = 0; i < 3; i++)
+        {
+          t[i] = 0;
+          q[i] = y[RANLXD_LIMBS - 3 + i];
+        }
+
+      for (i = 3; i < RANLXD_LIMBS; i++)
+        t[i] = y[i - 3];
+
+      for (i = RANLXD_LIMBS; i < RANLXD_LIMBS + 17; i++)
+        t[i] = 0;
+
+      for (i = 0; i < 3; i++)
+        {
+          t[i] -= q[i];
+          t[i + 15] += q[i];
+        }
+
+      ranlxd_big_normalize (t, RANLXD_LIMBS + 1);
+
+      if (t[RANLXD_LIMBS] > 0 || ranlxd_big_compare (t, m) >= 0)
+        {
+          for (i = 0; i < RANLXD_LIMBS; i++)
+            t[i] -= m[i];
+
+          ranlxd_big_normalize (t, RANLXD_LIMBS + 1);
+
+          /* q + 1 < 2^48 */
+
+          for (i = 0; i < 3 && ++q[i] == 0x10000UL; i++)
+            q[i] = 0;
+        }
+
+      state->xdbl[(p + 11 - k) % 12] = ranlxd_limbs_to_digit (q);
+
+      for (i = 0; i < RANLXD_LIMBS; i++)
+        y[i] = t[i];
+    }
+
+  /* the carry is the difference between X and the value of the
+     numbers without it */
+
+  ranlxd_to_big (state, 0, z);
+
+  state->carry = 0;
+
+  for (i = 0; i < RANLXD_LIMBS; i++)
+    {
+      if (z[i] != x[i])
+        state->carry = one_bit;
+    }
+}
+
+static void
+ranlxd_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+
+  /* the number of values left in the current block */
+
+  const unsigned long int rem = (state->ir_old + 11 - state->ir) % 12;
+  unsigned long int blocks = 0, t = 0;
+
+  if (n > rem)
+    {
+      n -= rem;
+      blocks = (n - 1) / 12 + 1;
+      t = n - 12 * (blocks - 1);        /* values taken from the last block */
+    }
+
+  if (k == 0 && blocks < RANLXD_JUMP_MIN)
+    {
+      for (; blocks > 0; blocks--)
+        {
+          state->ir = state->ir_old;
+          increment_state (state);
+        }
+    }
+  else
+    {
+      const unsigned long int *split =
+        (state->pr == 397) ? ranlxd2_split : ranlxd1_split;
+      unsigned long int x[RANLXD_LIMBS], a[RANLXD_LIMBS], s[RANLXD_LIMBS];
+      unsigned int i;
+
+      /* a = (1/b)^pr, where 1/b = m - 2^528 + 2^192 */
+
+      ranlxd_big_modulus (a);
+      a[33] = 0xfffeUL;
+      a[12] = 1;
+
+      ranlxd_big_pow (a, state->pr);
+
+      for (i = 0; i < RANLXD_LIMBS; i++)
+        s[i] = split[i];
+
+      ranlxd_big_pow (a, blocks);
+      ranlxd_big_pow (s, k);
+
+      ranlxd_to_big (state, 1, x);
+      ranlxd_big_mul (x, a, x);
+      ranlxd_big_mul (x, s, x);
+      ranlxd_from_big (state, x);
+    }
+
+  if (t > 0)
+    state->ir = (state->ir_old + t - 1) % 12;
+  else
+    state->ir = (state->ir + n) % 12;
+}
+
 static void
 ranlxd_set_lux (void *vstate, unsigned long int s, unsigned int luxury)
 {
@@ -234,7 +692,10 @@ static const gsl_rng_type ranlxd1_type =
  sizeof (ranlxd_state_t),
  &ranlxd1_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ &ranlxd_fill,
+ &ranlxd_fill_double,
+ &ranlxd_jump};
 
 static const gsl_rng_type ranlxd2_type =
 {"ranlxd2",                     /* name */
@@ -243,7 +704,10 @@ static const gsl_rng_type ranlxd2_type =
  sizeof (ranlxd_state_t),
  &ranlxd2_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ &ranlxd_fill,
+ &ranlxd_fill_double,
+ &ranlxd_jump};
 
 const gsl_rng_type *gsl_rng_ranlxd1 = &ranlxd1_type;
 const gsl_rng_type *gsl_rng_ranlxd2 = &ranlxd2_type;
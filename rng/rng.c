@@ -100,6 +100,103 @@ gsl_rng_set (const gsl_rng * r, unsigned long int seed)
   (r->type->set) (r->state, seed);
 }
 
+/* The array functions use the fill and fill_double methods of the
+   generator when it has them, and otherwise call get and get_double
+   for each element.  Either way the numbers are the same as those
+   returned by successive calls of the scalar functions. */
+
+void
+gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], size_t n)
+{
+  if (r->type->fill)
+    {
+      (r->type->fill) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        x[i] = (r->type->get) (r->state);
+    }
+}
+
+void
+gsl_rng_uniform_array (const gsl_rng * r, double x[], size_t n)
+{
+  if (r->type->fill_double)
+    {
+      (r->type->fill_double) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        x[i] = (r->type->get_double) (r->state);
+    }
+}
+
+void
+gsl_rng_uniform_pos_array (const gsl_rng * r, double x[], size_t n)
+{
+  /* zeros are removed and the remaining elements refilled, which
+     skips them in the same way as gsl_rng_uniform_pos */
+
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, k = i;
+
+      gsl_rng_uniform_array (r, x + i, n - i);
+
+      for (j = i; j < n; j++)
+        {
+          if (x[j] != 0)
+            x[k++] = x[j];
+        }
+
+      i = k;
+    }
+}
+
+/* The jump method advances the state by n numbers and k substreams
+   in one step, using the algebraic structure of the generator.  The
+   length of a substream is fixed for each type of generator.
+   gsl_rng_jump never fails: a generator without a jump method is
+   stepped n times with get instead, which takes O(n) time.  Only
+   gsl_rng_split returns GSL_EUNIMPL for such generators. */
+
+int
+gsl_rng_jump (const gsl_rng * r, unsigned long int n)
+{
+  if (r->type->jump)
+    {
+      (r->type->jump) (r->state, n, 0);
+    }
+  else
+    {
+      for (; n > 0; n--)
+        (r->type->get) (r->state);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_rng_split (const gsl_rng * r, unsigned long int k)
+{
+  if (r->type->jump == 0)
+    {
+      GSL_ERROR ("generator does not support substreams", GSL_EUNIMPL);
+    }
+
+  (r->type->jump) (r->state, 0, k);
+
+  return GSL_SUCCESS;
+}
+
 unsigned long int
 gsl_rng_max (const gsl_rng * r)
 {
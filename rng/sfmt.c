@@ -0,0 +1,268 @@
+/* rng/sfmt.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the SIMD-oriented Fast Mersenne Twister SFMT19937 of Saito
+   and Matsumoto.  The state is 156 blocks of 128 bits, each updated
+   from three earlier blocks by
+
+   w_i = w_{i-N} ^ (w_{i-N} << 8) ^ ((w_{i-N+POS1} >> 11) & MSK)
+         ^ (w_{i-2} >> 8) ^ (w_{i-1} << 18)
+
+   where the shifts by 8 bits act on the whole 128-bit block and the
+   other shifts and the mask MSK act on its four 32-bit words.  There
+   is no tempering, the 32-bit words of the state are the output.
+
+   The words are held in unsigned int, four to a block, and the
+   recursion is written on the 32-bit words with the two previous
+   blocks kept in local variables, which is portable and lets the
+   compiler schedule the four independent words of a block together.
+   The period is a multiple of 2^19937 - 1, and the output is
+   equidistributed in 32-bit accuracy in up to 624 dimensions less the
+   defect of the parameter set.
+
+   The seeding follows the init_gen_rand function of the reference
+   implementation, with the default seed 1234 of its test output.  The
+   results agree with the reference implementation for that seed.
+
+   M. Saito and M. Matsumoto, "SIMD-oriented Fast Mersenne Twister: a
+   128-bit pseudorandom number generator", Monte Carlo and Quasi-Monte
+   Carlo Methods 2006, Springer (2008) 607--622. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+
+static inline unsigned long int sfmt_get (void *vstate);
+static double sfmt_get_double (void *vstate);
+static void sfmt_set (void *state, unsigned long int s);
+static void sfmt_fill (void *vstate, unsigned long int x[], size_t n);
+static void sfmt_fill_double (void *vstate, double x[], size_t n);
+
+#define SFMT_N 156              /* blocks of 128 bits */
+#define SFMT_N32 (4 * SFMT_N)   /* words of 32 bits */
+#define SFMT_POS1 122
+#define SFMT_SL1 18
+#define SFMT_SR1 11
+
+#define MASK32 0xffffffffU
+
+static const unsigned int sfmt_msk[4] =
+  { 0xdfffffefU, 0xddfecb7fU, 0xbffaffffU, 0xbffffff6U };
+
+static const unsigned int sfmt_parity[4] =
+  { 0x00000001U, 0x00000000U, 0x00000000U, 0x13c9e684U };
+
+typedef struct
+  {
+    unsigned int w[SFMT_N32];
+    int i;
+  }
+sfmt_state_t;
+
+/* computes the block r from itself, the block b and the two previous
+   blocks c and d, held in c0..c3 and d0..d3, which are moved along */
+
+#define SFMT_RECURSION(r,b,c0,c1,c2,c3,d0,d1,d2,d3) \
+  do { \
+    const unsigned int y0 = (c0 >> 8) ^ (c1 << 24); \
+    const unsigned int y1 = (c1 >> 8) ^ (c2 << 24); \
+    const unsigned int y2 = (c2 >> 8) ^ (c3 << 24); \
+    const unsigned int y3 = c3 >> 8; \
+    c0 = (r)[0] ^ ((r)[0] << 8) ^ ((b)[0] >> SFMT_SR1 & sfmt_msk[0]) ^ y0 ^ (d0 << SFMT_SL1); \
+    c1 = (r)[1] ^ ((r)[1] << 8) ^ ((r)[0] >> 24) ^ ((b)[1] >> SFMT_SR1 & sfmt_msk[1]) ^ y1 ^ (d1 << SFMT_SL1); \
+    c2 = (r)[2] ^ ((r)[2] << 8) ^ ((r)[1] >> 24) ^ ((b)[2] >> SFMT_SR1 & sfmt_msk[2]) ^ y2 ^ (d2 << SFMT_SL1); \
+    c3 = (r)[3] ^ ((r)[3] << 8) ^ ((r)[2] >> 24) ^ ((b)[3] >> SFMT_SR1 & sfmt_msk[3]) ^ y3 ^ (d3 << SFMT_SL1); \
+    (r)[0] = c0 = c0 & MASK32; \
+    (r)[1] = c1 = c1 & MASK32; \
+    (r)[2] = c2 = c2 & MASK32; \
+    (r)[3] = c3 = c3 & MASK32; \
+  } while (0)
+
+static void
+sfmt_generate (unsigned int *const w)
+{
+  /* generate SFMT_N blocks at one time, with the two previous blocks
+     alternating between (a0,a1,a2,a3) and (b0,b1,b2,b3) */
+
+  unsigned int a0 = w[4 * SFMT_N - 8], a1 = w[4 * SFMT_N - 7];
+  unsigned int a2 = w[4 * SFMT_N - 6], a3 = w[4 * SFMT_N - 5];
+  unsigned int b0 = w[4 * SFMT_N - 4], b1 = w[4 * SFMT_N - 3];
+  unsigned int b2 = w[4 * SFMT_N - 2], b3 = w[4 * SFMT_N - 1];
+  int i;
+
+  for (i = 0; i < SFMT_N - SFMT_POS1; i += 2)
+    {
+      SFMT_RECURSION (w + 4 * i, w + 4 * (i + SFMT_POS1),
+                      a0, a1, a2, a3, b0, b1, b2, b3);
+      SFMT_RECURSION (w + 4 * (i + 1), w + 4 * (i + 1 + SFMT_POS1),
+                      b0, b1, b2, b3, a0, a1, a2, a3);
+    }
+
+  for (; i < SFMT_N; i += 2)
+    {
+      SFMT_RECURSION (w + 4 * i, w + 4 * (i + SFMT_POS1 - SFMT_N),
+                      a0, a1, a2, a3, b0, b1, b2, b3);
+      SFMT_RECURSION (w + 4 * (i + 1), w + 4 * (i + 1 + SFMT_POS1 - SFMT_N),
+                      b0, b1, b2, b3, a0, a1, a2, a3);
+    }
+}
+
+static inline unsigned long int
+sfmt_get (void *vstate)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+
+  if (state->i >= SFMT_N32)
+    {
+      sfmt_generate (state->w);
+      state->i = 0;
+    }
+
+  return state->w[state->i++];
+}
+
+static double
+sfmt_get_double (void *vstate)
+{
+  return sfmt_get (vstate) / 4294967296.0;
+}
+
+/* The array versions copy the words of the state directly, one
+   block of SFMT_N32 at a time. */
+
+static void
+sfmt_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+  const unsigned int *const w = state->w;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, m;
+
+      if (state->i >= SFMT_N32)
+        {
+          sfmt_generate (state->w);
+          state->i = 0;
+        }
+
+      m = SFMT_N32 - state->i;
+
+      if (m > n - i)
+        m = n - i;
+
+      for (j = 0; j < m; j++)
+        x[i + j] = w[state->i + j];
+
+      state->i += m;
+      i += m;
+    }
+}
+
+static void
+sfmt_fill_double (void *vstate, double x[], size_t n)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+  const unsigned int *const w = state->w;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j, m;
+
+      if (state->i >= SFMT_N32)
+        {
+          sfmt_generate (state->w);
+          state->i = 0;
+        }
+
+      m = SFMT_N32 - state->i;
+
+      if (m > n - i)
+        m = n - i;
+
+      for (j = 0; j < m; j++)
+        x[i + j] = w[state->i + j] / 4294967296.0;
+
+      state->i += m;
+      i += m;
+    }
+}
+
+static void
+sfmt_set (void *vstate, unsigned long int s)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+  unsigned int *const w = state->w;
+  unsigned int inner = 0;
+  int i, j;
+
+  if (s == 0)
+    s = 1234;   /* the default seed is 1234 */
+
+  w[0] = s & MASK32;
+
+  for (i = 1; i < SFMT_N32; i++)
+    {
+      w[i] = (1812433253U * (w[i - 1] ^ (w[i - 1] >> 30)) + i) & MASK32;
+    }
+
+  state->i = SFMT_N32;
+
+  /* The period is certified by the parity of the first four words
+     against the parity vector, which is corrected by flipping one bit
+     if necessary. */
+
+  for (i = 0; i < 4; i++)
+    inner ^= w[i] & sfmt_parity[i];
+
+  for (i = 16; i > 0; i >>= 1)
+    inner ^= inner >> i;
+
+  if (inner & 1)
+    return;
+
+  for (i = 0; i < 4; i++)
+    {
+      for (j = 0; j < 32; j++)
+        {
+          const unsigned int bit = 1U << j;
+
+          if (bit & sfmt_parity[i])
+            {
+              w[i] ^= bit;
+              return;
+            }
+        }
+    }
+}
+
+static const gsl_rng_type sfmt_type = {
+  "sfmt19937",                  /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (sfmt_state_t),
+  &sfmt_set,
+  &sfmt_get,
+  &sfmt_get_double,
+  &sfmt_fill,
+  &sfmt_fill_double,
+  0
+};
+
+const gsl_rng_type *gsl_rng_sfmt19937 = &sfmt_type;
@@ -200,6 +200,9 @@ static const gsl_rng_type slatec_type =
  sizeof (slatec_state_t),
  &slatec_set,
  &slatec_get,
- &slatec_get_double};
+ &slatec_get_double,
+ 0,
+ 0,
+ 0};
 
 const gsl_rng_type *gsl_rng_slatec = &slatec_type;
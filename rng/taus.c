@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 /* This is a maximally equidistributed combined Tausworthe
    generator. The sequence is,
@@ -78,11 +79,16 @@
    It affected the following seeds 254679140 1264751179 1519430319
    2274823218 2529502358 3284895257 3539574397 (s2 < 8).
 
+   Each component is a linear map on 32-bit vectors over GF(2), so the
+   generator jumps ahead by applying a power of its 32x32 matrix to
+   each component.  The substreams have length 2^64.
+
 */
 
 static inline unsigned long int taus_get (void *vstate);
 static double taus_get_double (void *vstate);
 static void taus_set (void *state, unsigned long int s);
+static void taus_jump (void *state, unsigned long int n, unsigned long int k);
 
 typedef struct
   {
@@ -111,6 +117,69 @@ taus_get_double (void *vstate)
   return taus_get (vstate) / 4294967296.0 ;
 }
 
+/* the matrices of the components raised to the power 2^64, the
+   length of a substream */
+
+static const unsigned long int taus_split1[32] = {
+  0x00000000UL, 0x80042000UL, 0x00084000UL, 0x00108000UL,
+  0x00210000UL, 0x00420000UL, 0x00840001UL, 0x01080002UL,
+  0x02100004UL, 0x04200008UL, 0x08400010UL, 0x10800020UL,
+  0x21000040UL, 0x42000080UL, 0x84000101UL, 0x08000202UL,
+  0x10000404UL, 0x20000808UL, 0x40001010UL, 0x00040021UL,
+  0x00080042UL, 0x00100084UL, 0x00200108UL, 0x00400210UL,
+  0x00800420UL, 0x01000840UL, 0x02001080UL, 0x04002100UL,
+  0x08004200UL, 0x10008400UL, 0x20010800UL, 0x40021000UL
+};
+
+static const unsigned long int taus_split2[32] = {
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x08014001UL,
+  0x10028002UL, 0x20050005UL, 0x400a000aUL, 0x80140014UL,
+  0x00280028UL, 0x00500050UL, 0x00a000a0UL, 0x01400140UL,
+  0x02800280UL, 0x05000500UL, 0x0a000a01UL, 0x14001402UL,
+  0x28002804UL, 0x50005008UL, 0xa000a011UL, 0x40014022UL,
+  0x80028044UL, 0x00050088UL, 0x000a0110UL, 0x00140220UL,
+  0x00280440UL, 0x00500880UL, 0x00a01100UL, 0x01402200UL,
+  0x02804400UL, 0x05008800UL, 0x02005000UL, 0x0400a000UL
+};
+
+static const unsigned long int taus_split3[32] = {
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x938110d0UL, 0x270221a1UL, 0x4e044343UL, 0x9c088687UL,
+  0x38110d0fUL, 0x70221a1fUL, 0xe044343eUL, 0xc088687cUL,
+  0x8110d0f8UL, 0x0221a1f1UL, 0x044343e2UL, 0x088687c4UL,
+  0x110d0f89UL, 0x221a1f13UL, 0x44343e26UL, 0x88687c4cUL,
+  0x10d0f899UL, 0x21a1f132UL, 0x4343e265UL, 0x8687c4cbUL,
+  0x0d0f8996UL, 0x1a1f132cUL, 0x343e2659UL, 0x687c4cb2UL,
+  0xd0f89965UL, 0x3270221aUL, 0x64e04434UL, 0xc9c08868UL
+};
+
+static void
+taus_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  taus_state_t *state = (taus_state_t *) vstate;
+  unsigned long int a1[32], a2[32], a3[32];
+  int j;
+
+  /* the columns of the matrices are the images of the unit vectors */
+
+  for (j = 0; j < 32; j++)
+    {
+      const unsigned long int e = 1UL << j;
+
+      a1[j] = TAUSWORTHE (e, 13, 19, 4294967294UL, 12);
+      a2[j] = TAUSWORTHE (e, 2, 25, 4294967288UL, 4);
+      a3[j] = TAUSWORTHE (e, 3, 11, 4294967280UL, 17);
+    }
+
+  jump_gf2_power (a1, n, taus_split1, k);
+  jump_gf2_power (a2, n, taus_split2, k);
+  jump_gf2_power (a3, n, taus_split3, k);
+
+  state->s1 = jump_gf2_apply (a1, state->s1);
+  state->s2 = jump_gf2_apply (a2, state->s2);
+  state->s3 = jump_gf2_apply (a3, state->s3);
+}
+
 static void
 taus_set (void *vstate, unsigned long int s)
 {
@@ -168,7 +237,10 @@ static const gsl_rng_type taus_type =
  sizeof (taus_state_t),
  &taus_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ 0,
+ 0,
+ &taus_jump};
 
 const gsl_rng_type *gsl_rng_taus = &taus_type;
 
@@ -179,6 +251,9 @@ static const gsl_rng_type taus2_type =
  sizeof (taus_state_t),
  &taus2_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ 0,
+ 0,
+ &taus_jump};
 
 const gsl_rng_type *gsl_rng_taus2 = &taus2_type;
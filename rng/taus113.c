@@ -53,11 +53,15 @@
    Mathematics of Computation, 65, 213 (1996), 203--213.
      http://www.iro.umontreal.ca/~lecuyer/myftp/papers/tausme.ps
    the online version of the latter contains corrections to the print version.
+
+   The generator jumps ahead by applying powers of the 32x32 matrices
+   over GF(2) of the four components.  The substreams have length 2^64.
 */
 
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 #define LCG(n) ((69069UL * n) & 0xffffffffUL)
 #define MASK 0xffffffffUL
@@ -65,6 +69,9 @@
 static inline unsigned long int taus113_get (void *vstate);
 static double taus113_get_double (void *vstate);
 static void taus113_set (void *state, unsigned long int s);
+static void taus113_fill (void *vstate, unsigned long int x[], size_t n);
+static void taus113_fill_double (void *vstate, double x[], size_t n);
+static void taus113_jump (void *vstate, unsigned long int n, unsigned long int k);
 
 typedef struct
 {
@@ -100,6 +107,139 @@ taus113_get_double (void *vstate)
   return taus113_get (vstate) / 4294967296.0;
 }
 
+/* The array versions keep the four components in local variables for
+   the whole loop, storing them back to the state at the end. */
+
+#define TAUS113_STEP(z1,z2,z3,z4) \
+  do { \
+    unsigned long b1, b2, b3, b4; \
+    b1 = ((((z1 << 6UL) & MASK) ^ z1) >> 13UL); \
+    z1 = ((((z1 & 4294967294UL) << 18UL) & MASK) ^ b1); \
+    b2 = ((((z2 << 2UL) & MASK) ^ z2) >> 27UL); \
+    z2 = ((((z2 & 4294967288UL) << 2UL) & MASK) ^ b2); \
+    b3 = ((((z3 << 13UL) & MASK) ^ z3) >> 21UL); \
+    z3 = ((((z3 & 4294967280UL) << 7UL) & MASK) ^ b3); \
+    b4 = ((((z4 << 3UL) & MASK) ^ z4) >> 12UL); \
+    z4 = ((((z4 & 4294967168UL) << 13UL) & MASK) ^ b4); \
+  } while (0)
+
+static void
+taus113_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = z1 ^ z2 ^ z3 ^ z4;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
+static void
+taus113_fill_double (void *vstate, double x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = (z1 ^ z2 ^ z3 ^ z4) / 4294967296.0;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
+/* the matrices of the components raised to the power 2^64, the
+   length of a substream */
+
+static const unsigned long int taus113_split1[32] = {
+  0x00000000UL, 0x00800800UL, 0x01001000UL, 0x02002001UL,
+  0x04004002UL, 0x08008004UL, 0x10010008UL, 0x20020010UL,
+  0x40040020UL, 0x80080041UL, 0x00100082UL, 0x00200104UL,
+  0x00400208UL, 0x00800410UL, 0x01000820UL, 0x02001041UL,
+  0x04002082UL, 0x08004104UL, 0x10008208UL, 0x20010410UL,
+  0x40020820UL, 0x80041041UL, 0x00082082UL, 0x00104104UL,
+  0x00208208UL, 0x00410410UL, 0x00020020UL, 0x00040040UL,
+  0x00080080UL, 0x00100100UL, 0x00200200UL, 0x00400400UL
+};
+
+static const unsigned long int taus113_split2[32] = {
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00808000UL,
+  0x01010000UL, 0x02020000UL, 0x04040000UL, 0x08080001UL,
+  0x10100002UL, 0x20200005UL, 0x4040000aUL, 0x80800014UL,
+  0x01000028UL, 0x02000050UL, 0x040000a0UL, 0x08000141UL,
+  0x10000282UL, 0x20000505UL, 0x40000a0aUL, 0x80001414UL,
+  0x00002828UL, 0x00005050UL, 0x0000a0a0UL, 0x00014140UL,
+  0x00028280UL, 0x00050500UL, 0x000a0a00UL, 0x00141400UL,
+  0x00282800UL, 0x00505000UL, 0x00202000UL, 0x00404000UL
+};
+
+static const unsigned long int taus113_split3[32] = {
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x1d4148a3UL, 0x3a829146UL, 0x7505228dUL, 0xea0a451aUL,
+  0xd4148a34UL, 0xa8291468UL, 0x505228d1UL, 0xa0a451a2UL,
+  0x4148a345UL, 0x8291468aUL, 0x05228d15UL, 0x0a451a2aUL,
+  0x148a3455UL, 0x291468aaUL, 0x5228d154UL, 0xb910ea0aUL,
+  0x7221d414UL, 0xe443a829UL, 0xc8875052UL, 0x910ea0a4UL,
+  0x221d4148UL, 0x443a8291UL, 0x88750522UL, 0x10ea0a45UL,
+  0x21d4148aUL, 0x43a82914UL, 0x87505228UL, 0x0ea0a451UL
+};
+
+static const unsigned long int taus113_split4[32] = {
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x8319b24dUL,
+  0x0633649bUL, 0x0c66c937UL, 0x18cd926fUL, 0x319b24deUL,
+  0x633649bdUL, 0xc66c937aUL, 0x8cd926f5UL, 0x19b24deaUL,
+  0x33649bd4UL, 0x66c937a8UL, 0xcd926f50UL, 0x9b24dea1UL,
+  0x3649bd42UL, 0x6c937a84UL, 0xd926f508UL, 0xb24dea10UL,
+  0x649bd420UL, 0xc937a840UL, 0x926f5080UL, 0x24dea101UL,
+  0x49bd4202UL, 0x10633649UL, 0x20c66c93UL, 0x418cd926UL
+};
+
+static void
+taus113_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long int a1[32], a2[32], a3[32], a4[32];
+  int j;
+
+  /* the columns of the matrices are the images of the unit vectors */
+
+  for (j = 0; j < 32; j++)
+    {
+      unsigned long int z1 = 1UL << j, z2 = z1, z3 = z1, z4 = z1;
+
+      TAUS113_STEP (z1, z2, z3, z4);
+
+      a1[j] = z1;
+      a2[j] = z2;
+      a3[j] = z3;
+      a4[j] = z4;
+    }
+
+  jump_gf2_power (a1, n, taus113_split1, k);
+  jump_gf2_power (a2, n, taus113_split2, k);
+  jump_gf2_power (a3, n, taus113_split3, k);
+  jump_gf2_power (a4, n, taus113_split4, k);
+
+  state->z1 = jump_gf2_apply (a1, state->z1);
+  state->z2 = jump_gf2_apply (a2, state->z2);
+  state->z3 = jump_gf2_apply (a3, state->z3);
+  state->z4 = jump_gf2_apply (a4, state->z4);
+}
+
 static void
 taus113_set (void *vstate, unsigned long int s)
 {
@@ -143,7 +283,10 @@ static const gsl_rng_type taus113_type = {
   sizeof (taus113_state_t),
   &taus113_set,
   &taus113_get,
-  &taus113_get_double
+  &taus113_get_double,
+  &taus113_fill,
+  &taus113_fill_double,
+  &taus113_jump
 };
 
 const gsl_rng_type *gsl_rng_taus113 = &taus113_type;
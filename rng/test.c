@@ -30,6 +30,11 @@ void rng_test (const gsl_rng_type * T, unsigned long int seed, unsigned int n,
 void rng_float_test (const gsl_rng_type * T);
 void generic_rng_test (const gsl_rng_type * T);
 void rng_state_test (const gsl_rng_type * T);
+void rng_array_test (const gsl_rng_type * T);
+void rng_jump_test (const gsl_rng_type * T);
+void rng_counter_test (const gsl_rng_type * T, const unsigned long int key[],
+                       const unsigned long int ctr[],
+                       const unsigned long int expected[]);
 void rng_parallel_state_test (const gsl_rng_type * T);
 void rng_read_write_test (const gsl_rng_type * T);
 int rng_max_test (gsl_rng * r, unsigned long int *kmax, unsigned long int ran_max) ;
@@ -147,6 +152,19 @@ main (void)
   rng_test (gsl_rng_mt19937_1998, 4357, 1000, 1309179303);
   rng_test (gsl_rng_tt800, 0, 10000, 2856609219UL);
 
+  /* SFMT19937 against the test output of the reference implementation
+     for its seed 1234, and dSFMT19937 from running this code */
+
+  rng_test (gsl_rng_sfmt19937, 1234, 10, 2987036003UL);
+  rng_test (gsl_rng_sfmt19937, 1, 10000, 1779530869UL);
+  rng_test (gsl_rng_dsfmt19937, 1, 10000, 706684752UL);
+
+  /* The counter-based generators, whose known answers are checked
+     below, with the seed 1 used as the key */
+
+  rng_test (gsl_rng_philox4x32, 1, 10000, 4025433304UL);
+  rng_test (gsl_rng_threefry4x32, 1, 10000, 1030920371UL);
+
   rng_test (gsl_rng_ran0, 0, 10000, 1115320064);
   rng_test (gsl_rng_ran1, 0, 10000, 1491066076);
   rng_test (gsl_rng_ran2, 0, 10000, 1701364455);
@@ -181,6 +199,37 @@ main (void)
   rng_test (gsl_rng_ranf, 0, 10000, 2152890433UL);
   rng_test (gsl_rng_ranf, 2, 10000, 339327233);
 
+  /* The counter-based generators are checked against the known-answer
+     tests of the reference implementation (Random123) */
+
+  {
+    static const unsigned long int zero[4] = { 0, 0, 0, 0 };
+    static const unsigned long int ones[4] =
+      { 0xffffffffUL, 0xffffffffUL, 0xffffffffUL, 0xffffffffUL };
+    static const unsigned long int pi[8] =
+      { 0x243f6a88UL, 0x85a308d3UL, 0x13198a2eUL, 0x03707344UL,
+        0xa4093822UL, 0x299f31d0UL, 0x082efa98UL, 0xec4e6c89UL };
+    static const unsigned long int philox_zero[4] =
+      { 0x6627e8d5UL, 0xe169c58dUL, 0xbc57ac4cUL, 0x9b00dbd8UL };
+    static const unsigned long int philox_ones[4] =
+      { 0x408f276dUL, 0x41c83b0eUL, 0xa20bc7c6UL, 0x6d5451fdUL };
+    static const unsigned long int philox_pi[4] =
+      { 0xd16cfe09UL, 0x94fdccebUL, 0x5001e420UL, 0x24126ea1UL };
+    static const unsigned long int threefry_zero[4] =
+      { 0x9c6ca96aUL, 0xe17eae66UL, 0xfc10ecd4UL, 0x5256a7d8UL };
+    static const unsigned long int threefry_ones[4] =
+      { 0x2a881696UL, 0x57012287UL, 0xf6c7446eUL, 0xa16a6732UL };
+    static const unsigned long int threefry_pi[4] =
+      { 0x59cd1dbbUL, 0xb8879579UL, 0x86b5d00cUL, 0xac8b6d84UL };
+
+    rng_counter_test (gsl_rng_philox4x32, zero, zero, philox_zero);
+    rng_counter_test (gsl_rng_philox4x32, ones, ones, philox_ones);
+    rng_counter_test (gsl_rng_philox4x32, pi + 4, pi, philox_pi);
+    rng_counter_test (gsl_rng_threefry4x32, zero, zero, threefry_zero);
+    rng_counter_test (gsl_rng_threefry4x32, ones, ones, threefry_ones);
+    rng_counter_test (gsl_rng_threefry4x32, pi + 4, pi, threefry_pi);
+  }
+
   /* Test constant relationship between int and double functions */
 
   for (r = rngs ; *r != 0; r++)
@@ -194,6 +243,16 @@ main (void)
   for (r = rngs ; *r != 0; r++)
     rng_parallel_state_test (*r);
 
+  /* Test array functions against the scalar ones */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_array_test (*r);
+
+  /* Test jumps against the sequence and substreams against jumps */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_jump_test (*r);
+
   for (r = rngs ; *r != 0; r++)
     rng_read_write_test (*r);
 
@@ -335,6 +394,197 @@ rng_state_test (const gsl_rng_type * T)
 }
 
 
+void
+rng_array_test (const gsl_rng_type * T)
+{
+  /* the arrays are filled in pieces of different lengths, crossing
+     the block boundaries of the generators which have them, and must
+     match the scalar functions exactly */
+
+  static const size_t pieces[] = { 1, 700, 5, 1300, 3 };
+  unsigned long int k[N];
+  double u[N];
+
+  gsl_rng *ra = gsl_rng_alloc (T);
+  gsl_rng *rs = gsl_rng_alloc (T);
+
+  size_t i, j, p;
+  int status_get = 0, status_uniform = 0, status_pos = 0;
+
+  for (p = 0, i = 0; i < N; p++)
+    {
+      const size_t m = (pieces[p % 5] < N - i) ? pieces[p % 5] : N - i;
+
+      gsl_rng_get_array (ra, k + i, m);
+      gsl_rng_uniform_array (ra, u + i, m);
+
+      for (j = i; j < i + m; j++)
+        status_get |= (k[j] != gsl_rng_get (rs));
+
+      for (j = i; j < i + m; j++)
+        status_uniform |= (u[j] != gsl_rng_uniform (rs));
+
+      gsl_rng_uniform_pos_array (ra, u + i, m);
+
+      for (j = i; j < i + m; j++)
+        status_pos |= (u[j] != gsl_rng_uniform_pos (rs) || u[j] == 0);
+
+      i += m;
+    }
+
+  gsl_test (status_get, "%s, gsl_rng_get_array matches gsl_rng_get",
+            gsl_rng_name (ra));
+  gsl_test (status_uniform, "%s, gsl_rng_uniform_array matches gsl_rng_uniform",
+            gsl_rng_name (ra));
+  gsl_test (status_pos, "%s, gsl_rng_uniform_pos_array matches gsl_rng_uniform_pos",
+            gsl_rng_name (ra));
+
+  gsl_rng_free (ra);
+  gsl_rng_free (rs);
+}
+
+void
+rng_jump_test (const gsl_rng_type * T)
+{
+  /* jumps of different lengths from varying positions, crossing the
+     blocks of the generators which have them, must agree with calling
+     gsl_rng_get, and substreams must compose like the jumps */
+
+  static const unsigned long int jumps[] = { 0, 1, 3, 11, 12, 13, 100, 1000,
+                                             624, 5000, 2, 20000 };
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *s = gsl_rng_alloc (T);
+  size_t i, j;
+  int status_jump = 0, status_sum = 0, status_split = 0;
+
+  for (i = 0; i < sizeof (jumps) / sizeof (jumps[0]); i++)
+    {
+      gsl_rng_jump (r, jumps[i]);
+
+      for (j = 0; j < jumps[i]; j++)
+        gsl_rng_get (s);
+
+      for (j = 0; j <= i; j++)
+        status_jump |= (gsl_rng_get (r) != gsl_rng_get (s));
+    }
+
+  gsl_test (status_jump, "%s, gsl_rng_jump matches gsl_rng_get",
+            gsl_rng_name (r));
+
+  if (T == gsl_rng_mt19937)
+    {
+      /* a jump long enough to use the characteristic polynomial */
+
+      const unsigned long int n = 65536UL * 624 + 1234;
+      unsigned long int x[1000];
+      int status_long = 0;
+
+      gsl_rng_jump (r, n);
+
+      for (i = 0; i < n / 1000; i++)
+        gsl_rng_get_array (s, x, 1000);
+
+      for (j = 0; j < n % 1000; j++)
+        gsl_rng_get (s);
+
+      for (j = 0; j < 1000; j++)
+        status_long |= (gsl_rng_get (r) != gsl_rng_get (s));
+
+      gsl_test (status_long, "%s, long gsl_rng_jump matches gsl_rng_get",
+                gsl_rng_name (r));
+    }
+
+  if (T->jump)
+    {
+      gsl_rng_memcpy (s, r);
+
+      gsl_rng_jump (r, 123456789UL);
+      gsl_rng_jump (r, 987654321UL);
+      gsl_rng_jump (s, 1111111110UL);
+
+      for (j = 0; j < 100; j++)
+        status_sum |= (gsl_rng_get (r) != gsl_rng_get (s));
+
+      gsl_rng_split (r, 1);
+      gsl_rng_jump (r, 17);
+      gsl_rng_split (r, 2);
+      gsl_rng_jump (s, 17);
+      gsl_rng_split (s, 3);
+
+      for (j = 0; j < 100; j++)
+        status_split |= (gsl_rng_get (r) != gsl_rng_get (s));
+
+      gsl_test (status_sum, "%s, gsl_rng_jump composes",
+                gsl_rng_name (r));
+      gsl_test (status_split, "%s, gsl_rng_split composes with gsl_rng_jump",
+                gsl_rng_name (r));
+    }
+
+  gsl_rng_free (r);
+  gsl_rng_free (s);
+}
+
+void
+rng_counter_test (const gsl_rng_type * T, const unsigned long int key[],
+                  const unsigned long int ctr[],
+                  const unsigned long int expected[])
+{
+  /* the block for counter ctr, then the same words by random access
+     from a generator positioned elsewhere in the stream, and a third
+     generator placed at the position reported after them */
+
+  unsigned long int k[4], c[4], x[4 * N];
+  unsigned int index;
+  int status = 0, status_seek = 0, status_pos = 0, status_fill = 0;
+  size_t i;
+
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *s = gsl_rng_alloc (T);
+  gsl_rng *t = gsl_rng_alloc (T);
+
+  gsl_rng_counter_set (r, key, ctr, 0);
+
+  for (i = 0; i < 4; i++)
+    status |= (gsl_rng_get (r) != expected[i]);
+
+  gsl_test (status, "%s, known answer for key %#lx, counter %#lx",
+            gsl_rng_name (r), key[0], ctr[0]);
+
+  for (i = 0; i < 4; i++)
+    {
+      gsl_rng_get (s);
+      gsl_rng_counter_set (s, key, ctr, i);
+      status_seek |= (gsl_rng_get (s) != expected[i]);
+
+      gsl_rng_counter_get (s, k, c, &index);
+      gsl_rng_counter_set (t, k, c, index);
+      status_pos |= (gsl_rng_get (t) != gsl_rng_get (s));
+    }
+
+  gsl_test (status_seek, "%s, random access to the known answer",
+            gsl_rng_name (r));
+  gsl_test (status_pos, "%s, gsl_rng_counter_get gives the position",
+            gsl_rng_name (r));
+
+  /* the blocks of the array functions, whose counters carry between
+     the words near the end of the 32-bit range, match the scalar
+     function */
+
+  gsl_rng_counter_set (r, key, ctr, 1);
+  gsl_rng_counter_set (s, key, ctr, 1);
+  gsl_rng_get_array (r, x, 4 * N);
+
+  for (i = 0; i < 4 * N; i++)
+    status_fill |= (x[i] != gsl_rng_get (s));
+
+  gsl_test (status_fill, "%s, gsl_rng_get_array across the counter carry",
+            gsl_rng_name (r));
+
+  gsl_rng_free (r);
+  gsl_rng_free (s);
+  gsl_rng_free (t);
+}
+
 void
 rng_parallel_state_test (const gsl_rng_type * T)
 {
@@ -0,0 +1,220 @@
+/* rng/threefry.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the counter-based generator Threefry4x32-20 of Salmon et
+   al., based on the Threefish block cipher with the key schedule
+   simplified.  A 128-bit counter (x0,x1,x2,x3) is passed through
+   twenty rounds of the mix functions
+
+   x0 += x1, x1 = rotl(x1, R0) ^ x0, x2 += x3, x3 = rotl(x3, R1) ^ x2
+
+   with the words permuted between rounds and the 128-bit key added
+   every four rounds.  Each counter value gives four 32-bit outputs.
+   The period is 2^130 for each of the 2^128 keys.
+
+   The seed is used as the key, with the counter starting at zero.  The
+   function gsl_rng_counter_set selects any key and counter.  A jump
+   adds to the counter; the substreams are 2^64 blocks long.
+
+   The results agree with the known-answer tests of the reference
+   implementation.
+
+   J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, "Parallel
+   random numbers: as easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing, Networking,
+   Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include "counter.h"
+
+static inline unsigned long int threefry4x32_get (void *vstate);
+static double threefry4x32_get_double (void *vstate);
+static void threefry4x32_set (void *state, unsigned long int s);
+static void threefry4x32_fill (void *vstate, unsigned long int x[], size_t n);
+static void threefry4x32_fill_double (void *vstate, double x[], size_t n);
+static void threefry4x32_jump (void *vstate, unsigned long int n, unsigned long int k);
+
+#define THREEFRY_PARITY 0x1BD11BDAUL
+
+/* rotation constants of the eight rounds between two key injections */
+
+static const int threefry_rot[8][2] = {
+  {10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}
+};
+
+#define ROTL(x,r) ((((x) << (r)) & COUNTER_MASK) | ((x) >> (32 - (r))))
+
+/* rounds 0 and 2 of each four mix the pairs (x0,x1) and (x2,x3),
+   rounds 1 and 3 the pairs (x0,x3) and (x2,x1) */
+
+#define THREEFRY_MIX(a,b,c,d,r) \
+  do { \
+    a = (a + b) & COUNTER_MASK; \
+    b = ROTL (b, threefry_rot[r][0]) ^ a; \
+    c = (c + d) & COUNTER_MASK; \
+    d = ROTL (d, threefry_rot[r][1]) ^ c; \
+  } while (0)
+
+#define THREEFRY_ROUNDS(x0,x1,x2,x3,r) \
+  do { \
+    THREEFRY_MIX (x0, x1, x2, x3, r); \
+    THREEFRY_MIX (x0, x3, x2, x1, r + 1); \
+    THREEFRY_MIX (x0, x1, x2, x3, r + 2); \
+    THREEFRY_MIX (x0, x3, x2, x1, r + 3); \
+  } while (0)
+
+/* adds key s of the schedule ks[0..4] */
+
+#define THREEFRY_INJECT(x0,x1,x2,x3,ks,s) \
+  do { \
+    x0 = (x0 + ks[(s) % 5]) & COUNTER_MASK; \
+    x1 = (x1 + ks[((s) + 1) % 5]) & COUNTER_MASK; \
+    x2 = (x2 + ks[((s) + 2) % 5]) & COUNTER_MASK; \
+    x3 = (x3 + ks[((s) + 3) % 5] + (s)) & COUNTER_MASK; \
+  } while (0)
+
+static void
+threefry4x32_schedule (const unsigned long int key[4], unsigned long int ks[5])
+{
+  ks[0] = key[0];
+  ks[1] = key[1];
+  ks[2] = key[2];
+  ks[3] = key[3];
+  ks[4] = THREEFRY_PARITY ^ key[0] ^ key[1] ^ key[2] ^ key[3];
+}
+
+static void
+threefry4x32_block (const unsigned long int ctr[4],
+                    const unsigned long int key[4], unsigned long int out[4])
+{
+  unsigned long int x0, x1, x2, x3, ks[5];
+  int s;
+
+  threefry4x32_schedule (key, ks);
+
+  x0 = ctr[0];
+  x1 = ctr[1];
+  x2 = ctr[2];
+  x3 = ctr[3];
+
+  THREEFRY_INJECT (x0, x1, x2, x3, ks, 0);
+
+  for (s = 1; s <= 5; s++)
+    {
+      THREEFRY_ROUNDS (x0, x1, x2, x3, 4 * ((s - 1) % 2));
+      THREEFRY_INJECT (x0, x1, x2, x3, ks, s);
+    }
+
+  out[0] = x0;
+  out[1] = x1;
+  out[2] = x2;
+  out[3] = x3;
+}
+
+static void
+threefry4x32_lanes (const unsigned long int ctr[4],
+                    const unsigned long int key[4], unsigned long int out[])
+{
+  unsigned int x0[COUNTER_LANES], x1[COUNTER_LANES];
+  unsigned int x2[COUNTER_LANES], x3[COUNTER_LANES];
+  unsigned long int ks[5];
+  int l, s;
+
+  threefry4x32_schedule (key, ks);
+
+  for (l = 0; l < COUNTER_LANES; l++)
+    {
+      x0[l] = ctr[0] + l;
+      x1[l] = ctr[1];
+      x2[l] = ctr[2];
+      x3[l] = ctr[3];
+      THREEFRY_INJECT (x0[l], x1[l], x2[l], x3[l], ks, 0);
+    }
+
+  for (s = 1; s <= 5; s++)
+    {
+      const int r = 4 * ((s - 1) % 2);
+
+      for (l = 0; l < COUNTER_LANES; l++)
+        {
+          THREEFRY_ROUNDS (x0[l], x1[l], x2[l], x3[l], r);
+          THREEFRY_INJECT (x0[l], x1[l], x2[l], x3[l], ks, s);
+        }
+    }
+
+  for (l = 0; l < COUNTER_LANES; l++)
+    {
+      out[4 * l] = x0[l];
+      out[4 * l + 1] = x1[l];
+      out[4 * l + 2] = x2[l];
+      out[4 * l + 3] = x3[l];
+    }
+}
+
+static inline unsigned long int
+threefry4x32_get (void *vstate)
+{
+  return counter_get ((counter_state_t *) vstate, &threefry4x32_block);
+}
+
+static double
+threefry4x32_get_double (void *vstate)
+{
+  return threefry4x32_get (vstate) / 4294967296.0;
+}
+
+static void
+threefry4x32_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  counter_fill ((counter_state_t *) vstate, x, n,
+                &threefry4x32_block, &threefry4x32_lanes);
+}
+
+static void
+threefry4x32_fill_double (void *vstate, double x[], size_t n)
+{
+  counter_fill_double (&threefry4x32_fill, vstate, x, n);
+}
+
+static void
+threefry4x32_jump (void *vstate, unsigned long int n, unsigned long int k)
+{
+  counter_jump ((counter_state_t *) vstate, n, k, &threefry4x32_block);
+}
+
+static void
+threefry4x32_set (void *vstate, unsigned long int s)
+{
+  counter_seed ((counter_state_t *) vstate, s);
+}
+
+static const gsl_rng_type threefry4x32_type = {
+  "threefry4x32",               /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (counter_state_t),
+  &threefry4x32_set,
+  &threefry4x32_get,
+  &threefry4x32_get_double,
+  &threefry4x32_fill,
+  &threefry4x32_fill_double,
+  &threefry4x32_jump
+};
+
+const gsl_rng_type *gsl_rng_threefry4x32 = &threefry4x32_type;
@@ -49,6 +49,13 @@ int gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
                      const double beta, gsl_vector *y);
 int gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
                      const gsl_spmatrix *B, gsl_spmatrix *C);
+int gsl_spblas_dgemm_symbolic(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                              gsl_spmatrix *C);
+int gsl_spblas_dgemm_numeric(const double alpha, const gsl_spmatrix *A,
+                             const gsl_spmatrix *B, gsl_spmatrix *C);
+int gsl_spblas_dtrsv(const CBLAS_UPLO_t Uplo, const CBLAS_TRANSPOSE_t TransA,
+                     const CBLAS_DIAG_t Diag, const gsl_spmatrix *A,
+                     gsl_vector *x);
 size_t gsl_spblas_scatter(const gsl_spmatrix *A, const size_t j,
                           const double alpha, size_t *w, double *x,
                           const size_t mark, gsl_spmatrix *C, size_t nz);
@@ -24,6 +24,29 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_errno.h>
 
+static int spdgemm_check(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                         const gsl_spmatrix *C);
+static size_t spdgemm_count(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                            const size_t n, size_t *Cp, size_t *w);
+static int spdgemm_alloc(const size_t nz, gsl_spmatrix *C);
+
+/*
+ * The products are computed column by column in CCS: column j of
+ * C = A*B is the combination of the columns of A selected by column j
+ * of B, accumulated in a dense vector x with a marker array w. A
+ * product in CRS is computed in the same way as the CCS product
+ * C^T = B^T A^T, since the arrays of a CRS matrix are those of its
+ * transpose in CCS. The macros below select the operands.
+ */
+
+/* first and second factors of the product in CCS */
+#define SPDGEMM_FIRST(A, B)  (GSL_SPMATRIX_ISCCS(A) ? (A) : (B))
+#define SPDGEMM_SECOND(A, B) (GSL_SPMATRIX_ISCCS(A) ? (B) : (A))
+
+/* number of columns of C in CCS, and of rows of the first factor */
+#define SPDGEMM_NMAJOR(C)    (GSL_SPMATRIX_ISCCS(C) ? (C)->size2 : (C)->size1)
+#define SPDGEMM_NMINOR(C)    (GSL_SPMATRIX_ISCCS(C) ? (C)->size1 : (C)->size2)
+
 /*
 gsl_spblas_dgemm()
   Multiply two sparse matrices
@@ -37,91 +60,317 @@ Return: success or error
 
 Notes:
 1) based on CSparse routine cs_multiply
+
+2) If C may be too small for the product, the number of entries in
+each column of C is counted first, so that C is reallocated once with
+its exact size; the product is then computed in one pass. The
+matrices may be in CCS or CRS, all in the same format
+
+3) The indices in each column (CCS) or row (CRS) of C are not sorted
 */
 
 int
 gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
                  const gsl_spmatrix *B, gsl_spmatrix *C)
 {
-  if (A->size2 != B->size1 || A->size1 != C->size1 || B->size2 != C->size2)
-    {
-      GSL_ERROR("matrix dimensions do not match", GSL_EBADLEN);
-    }
-  else if (A->sptype != B->sptype || A->sptype != C->sptype)
-    {
-      GSL_ERROR("matrix storage formats do not match", GSL_EINVAL);
-    }
-  else if (!GSL_SPMATRIX_ISCCS(A))
+  int status = spdgemm_check(A, B, C);
+
+  if (status)
+    return status;
+  else
     {
-      GSL_ERROR("compressed column format required", GSL_EINVAL);
+      const gsl_spmatrix *F = SPDGEMM_FIRST(A, B);
+      const gsl_spmatrix *S = SPDGEMM_SECOND(A, B);
+      const size_t n = SPDGEMM_NMAJOR(C);
+      const size_t m = SPDGEMM_NMINOR(C);
+      size_t *Si = S->i;
+      size_t *Sp = S->p;
+      double *Sd = S->data;
+      size_t *w = (size_t *) F->work; /* workspace of length m */
+      double *x = (double *) C->work; /* workspace of length m */
+      size_t *Cp = C->p;
+      size_t j, p, nz = 0, flops = 0;
+
+      /* the number of scalar products bounds the number of entries */
+      for (p = 0; p < S->nz; ++p)
+        flops += F->p[Si[p] + 1] - F->p[Si[p]];
+
+      if (C->nzmax < flops)
+        {
+          nz = spdgemm_count(F, S, n, Cp, w);
+
+          status = spdgemm_alloc(nz, C);
+          if (status)
+            return status;
+        }
+
+      for (j = 0; j < m; ++j)
+        w[j] = 0;
+
+      nz = 0;
+      for (j = 0; j < n; ++j)
+        {
+          Cp[j] = nz; /* column j of C starts here */
+
+          for (p = Sp[j]; p < Sp[j + 1]; ++p)
+            nz = gsl_spblas_scatter(F, Si[p], Sd[p], w, x, j + 1, C, nz);
+
+          for (p = Cp[j]; p < nz; ++p)
+            C->data[p] = alpha * x[C->i[p]];
+        }
+
+      Cp[n] = nz;
+      C->nz = nz;
+
+      return GSL_SUCCESS;
     }
+} /* gsl_spblas_dgemm() */
+
+/*
+gsl_spblas_dgemm_symbolic()
+  Compute the sparsity pattern of the product of two sparse matrices
+
+Inputs: A - sparse matrix
+        B - sparse matrix
+        C - (output) pattern of A * B, with values set to 0
+
+Return: success or error
+
+Notes: C may then be passed to gsl_spblas_dgemm_numeric() for any
+matrices with the patterns of A and B
+*/
+
+int
+gsl_spblas_dgemm_symbolic(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                          gsl_spmatrix *C)
+{
+  int status = spdgemm_check(A, B, C);
+
+  if (status)
+    return status;
   else
     {
-      int status = GSL_SUCCESS;
-      const size_t M = A->size1;
-      const size_t N = B->size2;
-      size_t *Bi = B->i;
-      size_t *Bp = B->p;
-      double *Bd = B->data;
-      size_t *w = (size_t *) A->work; /* workspace of length M */
-      double *x = (double *) C->work; /* workspace of length M */
-      size_t *Cp, *Ci;
-      double *Cd;
-      size_t j, p;
-      size_t nz = 0;
-
-      if (C->nzmax < A->nz + B->nz)
+      const gsl_spmatrix *F = SPDGEMM_FIRST(A, B);
+      const gsl_spmatrix *S = SPDGEMM_SECOND(A, B);
+      const size_t n = SPDGEMM_NMAJOR(C);
+      const size_t m = SPDGEMM_NMINOR(C);
+      size_t *w = (size_t *) F->work; /* workspace of length m */
+      size_t *Cp = C->p;
+      size_t j, p, r, nz;
+
+      nz = spdgemm_count(F, S, n, Cp, w);
+
+      status = spdgemm_alloc(nz, C);
+      if (status)
+        return status;
+
+      for (j = 0; j < m; ++j)
+        w[j] = 0;
+
+      for (j = 0; j < n; ++j)
         {
-          status = gsl_spmatrix_realloc(A->nz + B->nz, C);
-          if (status)
+          size_t q = Cp[j];
+
+          for (p = S->p[j]; p < S->p[j + 1]; ++p)
             {
-              GSL_ERROR("unable to realloc matrix C", status);
+              const size_t k = S->i[p];
+
+              for (r = F->p[k]; r < F->p[k + 1]; ++r)
+                {
+                  const size_t i = F->i[r];
+
+                  if (w[i] < j + 1)
+                    {
+                      w[i] = j + 1;
+                      C->i[q++] = i;
+                    }
+                }
             }
         }
 
-      /* initialize workspace to 0 */
-      for (j = 0; j < M; ++j)
-        w[j] = 0;
+      for (p = 0; p < nz; ++p)
+        C->data[p] = 0.0;
 
-      Cp = C->p;
-      Ci = C->i;
-      Cd = C->data;
+      C->nz = nz;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dgemm_symbolic() */
+
+/*
+gsl_spblas_dgemm_numeric()
+  Compute the values of the product of two sparse matrices, in the
+pattern given by gsl_spblas_dgemm_symbolic()
 
-      for (j = 0; j < N; ++j)
+Inputs: alpha - scalar factor
+        A     - sparse matrix
+        B     - sparse matrix
+        C     - (input/output) on input, a pattern which contains that
+                of A * B; on output, C = alpha * A * B in that pattern
+
+Return: success or error
+
+Notes: the entries of each column of C are marked in w and zeroed in
+x, and the contributions of A and B are added to x; a contribution
+outside the pattern gives GSL_EINVAL
+*/
+
+int
+gsl_spblas_dgemm_numeric(const double alpha, const gsl_spmatrix *A,
+                         const gsl_spmatrix *B, gsl_spmatrix *C)
+{
+  int status = spdgemm_check(A, B, C);
+
+  if (status)
+    return status;
+  else
+    {
+      const gsl_spmatrix *F = SPDGEMM_FIRST(A, B);
+      const gsl_spmatrix *S = SPDGEMM_SECOND(A, B);
+      const size_t n = SPDGEMM_NMAJOR(C);
+      const size_t m = SPDGEMM_NMINOR(C);
+      const size_t *Fi = F->i;
+      const size_t *Fp = F->p;
+      const double *Fd = F->data;
+      const size_t *Ci = C->i;
+      const size_t *Cp = C->p;
+      double *Cd = C->data;
+      size_t *w = (size_t *) F->work; /* workspace of length m */
+      double *x = (double *) C->work; /* workspace of length m */
+      size_t j, p, r;
+
+      if (Cp[n] != C->nz)
+        {
+          GSL_ERROR("matrix C has no pattern", GSL_EINVAL);
+        }
+
+      for (j = 0; j < m; ++j)
+        w[j] = 0;
+
+      for (j = 0; j < n; ++j)
         {
-          if (nz + M > C->nzmax)
+          for (p = Cp[j]; p < Cp[j + 1]; ++p)
+            {
+              w[Ci[p]] = j + 1;
+              x[Ci[p]] = 0.0;
+            }
+
+          for (p = S->p[j]; p < S->p[j + 1]; ++p)
             {
-              status = gsl_spmatrix_realloc(2 * C->nzmax + M, C);
-              if (status)
+              const size_t k = S->i[p];
+              const double s = S->data[p];
+
+              for (r = Fp[k]; r < Fp[k + 1]; ++r)
                 {
-                  GSL_ERROR("unable to realloc matrix C", status);
-                }
+                  const size_t i = Fi[r];
+
+                  if (w[i] != j + 1)
+                    {
+                      GSL_ERROR("pattern of C does not contain product",
+                                GSL_EINVAL);
+                    }
 
-              /* these pointers could have changed due to reallocation */
-              Ci = C->i;
-              Cd = C->data;
+                  x[i] += Fd[r] * s;
+                }
             }
 
-          Cp[j] = nz; /* column j of C starts here */
+          for (p = Cp[j]; p < Cp[j + 1]; ++p)
+            Cd[p] = alpha * x[Ci[p]];
+        }
 
-          for (p = Bp[j]; p < Bp[j + 1]; ++p)
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dgemm_numeric() */
+
+/* check the dimensions and formats of the factors and product */
+static int
+spdgemm_check(const gsl_spmatrix *A, const gsl_spmatrix *B,
+              const gsl_spmatrix *C)
+{
+  if (A->size2 != B->size1 || A->size1 != C->size1 || B->size2 != C->size2)
+    {
+      GSL_ERROR("matrix dimensions do not match", GSL_EBADLEN);
+    }
+  else if (A->sptype != B->sptype || A->sptype != C->sptype)
+    {
+      GSL_ERROR("matrix storage formats do not match", GSL_EINVAL);
+    }
+  else if (!GSL_SPMATRIX_ISCCS(A) && !GSL_SPMATRIX_ISCRS(A))
+    {
+      GSL_ERROR("compressed format required", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+spdgemm_count()
+  Count the entries in each column of the CCS product F*S
+
+Inputs: F  - first factor in CCS
+        S  - second factor in CCS
+        n  - number of columns of S
+        Cp - (output) column pointers of F*S, length n + 1
+        w  - workspace, length of the columns of F
+
+Return: number of entries of F*S
+*/
+
+static size_t
+spdgemm_count(const gsl_spmatrix *F, const gsl_spmatrix *S,
+              const size_t n, size_t *Cp, size_t *w)
+{
+  const size_t m = GSL_SPMATRIX_ISCCS(F) ? F->size1 : F->size2;
+  size_t j, p, r;
+
+  for (j = 0; j < m; ++j)
+    w[j] = 0;
+
+  for (j = 0; j < n; ++j)
+    {
+      size_t count = 0;
+
+      for (p = S->p[j]; p < S->p[j + 1]; ++p)
+        {
+          const size_t k = S->i[p];
+
+          for (r = F->p[k]; r < F->p[k + 1]; ++r)
             {
-              nz = gsl_spblas_scatter(A, Bi[p], Bd[p], w, x, j + 1, C, nz);
-            }
+              const size_t i = F->i[r];
 
-          for (p = Cp[j]; p < nz; ++p)
-            Cd[p] = x[Ci[p]];
+              if (w[i] < j + 1)
+                {
+                  w[i] = j + 1;
+                  ++count;
+                }
+            }
         }
 
-      Cp[N] = nz;
-      C->nz = nz;
+      Cp[j] = count;
+    }
 
-      /* scale by alpha */
-      gsl_spmatrix_scale(C, alpha);
+  gsl_spmatrix_cumsum(n, Cp);
 
-      return status;
+  return Cp[n];
+}
+
+/* make room for nz entries in C, whose old entries are discarded */
+static int
+spdgemm_alloc(const size_t nz, gsl_spmatrix *C)
+{
+  C->nz = 0;
+
+  if (C->nzmax < nz)
+    {
+      int status = gsl_spmatrix_realloc(nz, C);
+      if (status)
+        {
+          GSL_ERROR("unable to realloc matrix C", status);
+        }
     }
-} /* gsl_spblas_dgemm() */
+
+  return GSL_SUCCESS;
+}
 
 /*
 gsl_spblas_scatter()
@@ -119,9 +119,12 @@ gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
 
           for (j = 0; j < lenX; ++j)
             {
-              for (p = Ap[j]; p < Ap[j + 1]; ++p)
+              const double temp = alpha * X[j * incX];
+              const size_t pend = Ap[j + 1];
+
+              for (p = Ap[j]; p < pend; ++p)
                 {
-                  Y[Ai[p] * incY] += alpha * Ad[p] * X[j * incX];
+                  Y[Ai[p] * incY] += Ad[p] * temp;
                 }
             }
         }
@@ -130,12 +133,26 @@ gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
         {
           Ai = A->i;
 
+          /*
+           * accumulate each dot product in registers, with two
+           * partial sums so consecutive multiply-adds are independent,
+           * and store y_j once
+           */
           for (j = 0; j < lenY; ++j)
             {
-              for (p = Ap[j]; p < Ap[j + 1]; ++p)
+              const size_t pend = Ap[j + 1];
+              double sum0 = 0.0, sum1 = 0.0;
+
+              for (p = Ap[j]; p + 1 < pend; p += 2)
                 {
-                  Y[j * incY] += alpha * Ad[p] * X[Ai[p] * incX];
+                  sum0 += Ad[p] * X[Ai[p] * incX];
+                  sum1 += Ad[p + 1] * X[Ai[p + 1] * incX];
                 }
+
+              if (p < pend)
+                sum0 += Ad[p] * X[Ai[p] * incX];
+
+              Y[j * incY] += alpha * (sum0 + sum1);
             }
         }
       else if (GSL_SPMATRIX_ISTRIPLET(A))
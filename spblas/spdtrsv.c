@@ -0,0 +1,161 @@
+/* spdtrsv.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_blas.h>
+
+/*
+gsl_spblas_dtrsv()
+  Solve a sparse triangular system
+
+Inputs: Uplo   - CblasLower or CblasUpper: the triangle of A to use
+        TransA - CblasNoTrans or CblasTrans
+        Diag   - CblasNonUnit, or CblasUnit if the diagonal of A is
+                 taken to be 1
+        A      - sparse square matrix in CCS or CRS format
+        x      - (input/output) on input, right hand side b; on
+                 output, solution of op(A) x = b
+
+Return: success or error
+
+Notes:
+1) As for gsl_blas_dtrsv(), only the elements of A in the triangle
+Uplo are used, so A may also hold the other triangle, as for the
+factors of an LU decomposition stored in one matrix. The indices in
+each column or row need not be sorted
+
+2) When the rows of op(A) are the columns (CCS) or rows (CRS) stored
+in A, each x_i is computed as a sparse dot product, and the diagonal
+is found in the same pass. Otherwise the columns of op(A) are stored,
+and once x_j is known its multiples are subtracted from the rest of
+x; the diagonal is then found first
+
+3) A missing or zero diagonal element with Diag = CblasNonUnit gives
+GSL_ESING
+*/
+
+int
+gsl_spblas_dtrsv(const CBLAS_UPLO_t Uplo, const CBLAS_TRANSPOSE_t TransA,
+                 const CBLAS_DIAG_t Diag, const gsl_spmatrix *A,
+                 gsl_vector *x)
+{
+  const size_t N = A->size1;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCCS(A) && !GSL_SPMATRIX_ISCRS(A))
+    {
+      GSL_ERROR("compressed format required", GSL_EINVAL);
+    }
+  else
+    {
+      const int nonunit = (Diag == CblasNonUnit);
+      const size_t *Ap = A->p;
+      const size_t *Ai = A->i;
+      const double *Ad = A->data;
+      const size_t incX = x->stride;
+      double *X = x->data;
+
+      /* op(A) is lower triangular */
+      const int lower = ((Uplo == CblasLower) == (TransA == CblasNoTrans));
+
+      /* the rows of op(A) are stored */
+      const int rows = (GSL_SPMATRIX_ISCRS(A) == (TransA == CblasNoTrans));
+      size_t k, p;
+
+      for (k = 0; k < N; ++k)
+        {
+          /* forward substitution if lower, backward if upper */
+          const size_t j = lower ? k : N - 1 - k;
+          double d = nonunit ? 0.0 : 1.0;
+
+          if (rows)
+            {
+              double sum = X[j * incX];
+
+              for (p = Ap[j]; p < Ap[j + 1]; ++p)
+                {
+                  const size_t i = Ai[p];
+
+                  if (i == j)
+                    {
+                      if (nonunit)
+                        d = Ad[p];
+                    }
+                  else if ((i < j) == lower)
+                    sum -= Ad[p] * X[i * incX];
+                }
+
+              if (d == 0.0)
+                {
+                  GSL_ERROR("matrix is singular", GSL_ESING);
+                }
+
+              X[j * incX] = nonunit ? sum / d : sum;
+            }
+          else
+            {
+              double xj;
+
+              if (nonunit)
+                {
+                  for (p = Ap[j]; p < Ap[j + 1]; ++p)
+                    {
+                      if (Ai[p] == j)
+                        d = Ad[p];
+                    }
+
+                  if (d == 0.0)
+                    {
+                      GSL_ERROR("matrix is singular", GSL_ESING);
+                    }
+
+                  X[j * incX] /= d;
+                }
+
+              xj = X[j * incX];
+
+              if (xj != 0.0)
+                {
+                  for (p = Ap[j]; p < Ap[j + 1]; ++p)
+                    {
+                      const size_t i = Ai[p];
+
+                      if (i != j && (i > j) == lower)
+                        X[i * incX] -= Ad[p] * xj;
+                    }
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dtrsv() */
@@ -178,14 +178,16 @@ test_dgemv(const size_t N, const size_t M, const double alpha,
 
 static void
 test_dgemm(const double alpha, const size_t M, const size_t N,
-           const gsl_rng *r)
+           const size_t sptype, const gsl_rng *r)
 {
   const size_t max = GSL_MAX(M, N);
+  const char *fmt = (sptype == GSL_SPMATRIX_CCS) ? "CCS" : "CRS";
   size_t i, j, k;
   gsl_matrix *A_dense = gsl_matrix_alloc(M, max);
   gsl_matrix *B_dense = gsl_matrix_alloc(max, N);
   gsl_matrix *C_dense = gsl_matrix_alloc(M, N);
-  gsl_spmatrix *C = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_CCS);
+  gsl_spmatrix *C = gsl_spmatrix_alloc_nzmax(M, N, 1, sptype);
+  gsl_spmatrix *C2 = gsl_spmatrix_alloc_nzmax(M, N, 1, sptype);
 
   for (k = 1; k <= max; ++k)
     {
@@ -193,12 +195,26 @@ test_dgemm(const double alpha, const size_t M, const size_t N,
       gsl_matrix_view Bd = gsl_matrix_submatrix(B_dense, 0, 0, k, N);
       gsl_spmatrix *TA = create_random_sparse(M, k, 0.2, r);
       gsl_spmatrix *TB = create_random_sparse(k, N, 0.2, r);
-      gsl_spmatrix *A = gsl_spmatrix_ccs(TA);
-      gsl_spmatrix *B = gsl_spmatrix_ccs(TB);
+      gsl_spmatrix *A, *B;
+
+      if (sptype == GSL_SPMATRIX_CCS)
+        {
+          A = gsl_spmatrix_ccs(TA);
+          B = gsl_spmatrix_ccs(TB);
+        }
+      else
+        {
+          A = gsl_spmatrix_crs(TA);
+          B = gsl_spmatrix_crs(TB);
+        }
 
       gsl_spmatrix_set_zero(C);
       gsl_spblas_dgemm(alpha, A, B, C);
 
+      /* the same product from the symbolic and numeric phases */
+      gsl_spblas_dgemm_symbolic(A, B, C2);
+      gsl_spblas_dgemm_numeric(alpha, A, B, C2);
+
       /* make dense matrices and use standard dgemm to multiply them */
       gsl_spmatrix_sp2d(&Ad.matrix, TA);
       gsl_spmatrix_sp2d(&Bd.matrix, TB);
@@ -211,9 +227,27 @@ test_dgemm(const double alpha, const size_t M, const size_t N,
           for (j = 0; j < N; ++j)
             {
               double Cij = gsl_spmatrix_get(C, i, j);
+              double C2ij = gsl_spmatrix_get(C2, i, j);
               double Dij = gsl_matrix_get(C_dense, i, j);
 
-              gsl_test_rel(Cij, Dij, 1.0e-12, "test_dgemm: _dgemm");
+              gsl_test_rel(Cij, Dij, 1.0e-12, "test_dgemm: _dgemm %s", fmt);
+              gsl_test_rel(C2ij, Dij, 1.0e-12, "test_dgemm: _dgemm_numeric %s", fmt);
+            }
+        }
+
+      /* new values in the same pattern reuse the symbolic phase */
+      gsl_spmatrix_scale(A, -3.0);
+      gsl_spblas_dgemm_numeric(alpha, A, B, C2);
+
+      for (i = 0; i < M; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            {
+              double C2ij = gsl_spmatrix_get(C2, i, j);
+              double Dij = gsl_matrix_get(C_dense, i, j);
+
+              gsl_test_rel(C2ij, -3.0 * Dij, 1.0e-12,
+                           "test_dgemm: _dgemm_numeric %s reuse", fmt);
             }
         }
 
@@ -224,11 +258,70 @@ test_dgemm(const double alpha, const size_t M, const size_t N,
     }
 
   gsl_spmatrix_free(C);
+  gsl_spmatrix_free(C2);
   gsl_matrix_free(A_dense);
   gsl_matrix_free(B_dense);
   gsl_matrix_free(C_dense);
 } /* test_dgemm() */
 
+static void
+test_dtrsv(const size_t N, const CBLAS_UPLO_t Uplo,
+           const CBLAS_TRANSPOSE_t TransA, const CBLAS_DIAG_t Diag,
+           const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_random_sparse(N, N, 0.2, r);
+  gsl_matrix *A_dense = gsl_matrix_alloc(N, N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x_gsl = gsl_vector_alloc(N);
+  gsl_vector *x_sp = gsl_vector_alloc(2 * N);
+  gsl_vector_view xv = gsl_vector_subvector_with_stride(x_sp, 1, 2, N);
+  int sptype;
+  size_t i;
+
+  /* a dominant diagonal keeps the triangles well conditioned */
+  for (i = 0; i < N; ++i)
+    gsl_spmatrix_set(T, i, i, 1.0 + N * 0.2 + gsl_rng_uniform(r));
+
+  gsl_spmatrix_sp2d(A_dense, T);
+  create_random_vector(b, r);
+
+  /* only the triangle Uplo of A_dense is used */
+  gsl_vector_memcpy(x_gsl, b);
+  gsl_blas_dtrsv(Uplo, TransA, Diag, A_dense, x_gsl);
+
+  for (sptype = GSL_SPMATRIX_CCS; sptype <= GSL_SPMATRIX_CRS; ++sptype)
+    {
+      gsl_spmatrix *A = (sptype == GSL_SPMATRIX_CCS) ?
+                        gsl_spmatrix_ccs(T) : gsl_spmatrix_crs(T);
+      int status;
+
+      gsl_vector_memcpy(&xv.vector, b);
+      status = gsl_spblas_dtrsv(Uplo, TransA, Diag, A, &xv.vector);
+      gsl_test(status, "test_dtrsv: status N=%zu", N);
+
+      for (i = 0; i < N; ++i)
+        {
+          double xi = gsl_vector_get(&xv.vector, i);
+          double yi = gsl_vector_get(x_gsl, i);
+
+          gsl_test_rel(xi, yi, 1.0e-10,
+                       "test_dtrsv: N=%zu %s %s %s %s i=%zu",
+                       N, (sptype == GSL_SPMATRIX_CCS) ? "CCS" : "CRS",
+                       (Uplo == CblasLower) ? "Lower" : "Upper",
+                       (TransA == CblasNoTrans) ? "NoTrans" : "Trans",
+                       (Diag == CblasUnit) ? "Unit" : "NonUnit", i);
+        }
+
+      gsl_spmatrix_free(A);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_matrix_free(A_dense);
+  gsl_vector_free(b);
+  gsl_vector_free(x_gsl);
+  gsl_vector_free(x_sp);
+} /* test_dtrsv() */
+
 int
 main()
 {
@@ -251,10 +344,27 @@ main()
         }
     }
 
-  test_dgemm(1.0, 10, 10, r);
-  test_dgemm(2.3, 20, 15, r);
-  test_dgemm(1.8, 12, 30, r);
-  test_dgemm(0.4, 45, 35, r);
+  test_dgemm(1.0, 10, 10, GSL_SPMATRIX_CCS, r);
+  test_dgemm(2.3, 20, 15, GSL_SPMATRIX_CCS, r);
+  test_dgemm(1.8, 12, 30, GSL_SPMATRIX_CCS, r);
+  test_dgemm(0.4, 45, 35, GSL_SPMATRIX_CCS, r);
+
+  test_dgemm(1.0, 10, 10, GSL_SPMATRIX_CRS, r);
+  test_dgemm(2.3, 20, 15, GSL_SPMATRIX_CRS, r);
+  test_dgemm(1.8, 12, 30, GSL_SPMATRIX_CRS, r);
+  test_dgemm(0.4, 45, 35, GSL_SPMATRIX_CRS, r);
+
+  for (n = 1; n <= N_max; ++n)
+    {
+      test_dtrsv(n, CblasLower, CblasNoTrans, CblasNonUnit, r);
+      test_dtrsv(n, CblasLower, CblasTrans, CblasNonUnit, r);
+      test_dtrsv(n, CblasUpper, CblasNoTrans, CblasNonUnit, r);
+      test_dtrsv(n, CblasUpper, CblasTrans, CblasNonUnit, r);
+      test_dtrsv(n, CblasLower, CblasNoTrans, CblasUnit, r);
+      test_dtrsv(n, CblasLower, CblasTrans, CblasUnit, r);
+      test_dtrsv(n, CblasUpper, CblasNoTrans, CblasUnit, r);
+      test_dtrsv(n, CblasUpper, CblasTrans, CblasUnit, r);
+    }
 
   gsl_rng_free(r);
 
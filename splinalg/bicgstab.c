@@ -0,0 +1,342 @@
+/* bicgstab.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * The code in this module is based on the BiCGSTAB method
+ * described in
+ *
+ * [1] H. A. van der Vorst, Bi-CGSTAB: A fast and smoothly converging
+ *     variant of Bi-CG for the solution of nonsymmetric linear
+ *     systems, SIAM J. Sci. Stat. Comput. 13(2), 1992.
+ *
+ * [2] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t maxit;    /* maximum iterations per call */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *rt;  /* shadow residual r~_0 */
+  gsl_vector *p;   /* search direction */
+  gsl_vector *v;   /* v = A*p */
+  gsl_vector *t;   /* t = A*s */
+  gsl_vector *ph;  /* preconditioned search direction M^{-1} p */
+  gsl_vector *sh;  /* preconditioned s, M^{-1} s */
+
+  double normr;    /* residual norm ||r|| */
+} bicgstab_state_t;
+
+static void bicgstab_free(void *vstate);
+static int bicgstab_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                            const double tol, const gsl_splinalg_precon *P,
+                            gsl_vector *x, void *vstate);
+
+/*
+bicgstab_alloc()
+  Allocate a BiCGSTAB workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations in each call to
+            bicgstab_iterate(); if this parameter is 0, the value n
+            is used
+
+Return: pointer to workspace
+*/
+
+static void *
+bicgstab_alloc(const size_t n, const size_t m)
+{
+  bicgstab_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(bicgstab_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate bicgstab state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->maxit = (m == 0) ? n : m;
+
+  state->r = gsl_vector_alloc(n);
+  state->rt = gsl_vector_alloc(n);
+  state->p = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->t = gsl_vector_alloc(n);
+  state->ph = gsl_vector_alloc(n);
+  state->sh = gsl_vector_alloc(n);
+  if (!state->r || !state->rt || !state->p || !state->v || !state->t ||
+      !state->ph || !state->sh)
+    {
+      bicgstab_free(state);
+      GSL_ERROR_NULL("failed to allocate bicgstab vectors", GSL_ENOMEM);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* bicgstab_alloc() */
+
+static void
+bicgstab_free(void *vstate)
+{
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->rt)
+    gsl_vector_free(state->rt);
+
+  if (state->p)
+    gsl_vector_free(state->p);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->t)
+    gsl_vector_free(state->t);
+
+  if (state->ph)
+    gsl_vector_free(state->ph);
+
+  if (state->sh)
+    gsl_vector_free(state->sh);
+
+  free(state);
+} /* bicgstab_free() */
+
+/*
+bicgstab_iterate()
+  Solve A*x = b using the BiCGSTAB method
+
+Inputs: A    - sparse square matrix
+        b    - right hand side vector
+        tol  - stopping tolerance (see below)
+        P    - preconditioner, or NULL
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if converged to solution (solution stored in x). In
+this case the following will be true:
+
+||b - A*x|| <= tol * ||b||
+
+GSL_CONTINUE if not yet converged; in this case x contains the
+most recent solution vector and calling this function more times
+with the input x restarts the method from x, with a new shadow
+residual, which is also the remedy for a breakdown
+
+Notes:
+1) Based on algorithm 7.7 of (Saad, 2003 [2]), with r~_0 = r_0.
+The vector s = r - alpha v is stored in r, and the vector updates
+are fused with the inner products which follow them, so each
+iteration makes two matrix-vector products and six passes over
+the vectors
+
+2) A preconditioner M is applied on the right, as in algorithm 9.5
+of (Saad, 2003 [2]): the products are A M^{-1} p and A M^{-1} s, and
+x is updated with M^{-1} p and M^{-1} s, so r remains the residual
+of the original system
+
+3) The iteration stops on the recursively updated residual, and the
+true residual b - A*x is computed at the end
+
+4) On output, work->normr contains ||b - A*x||
+*/
+
+static int
+bicgstab_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                 const double tol, const gsl_splinalg_precon *P,
+                 gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      const size_t incx = x->stride;
+      double *xd = x->data;
+      double *r = state->r->data;
+      double *p = state->p->data;
+      double *v = state->v->data;
+      double *t = state->t->data;
+      gsl_vector *ph = (P != NULL) ? state->ph : state->p;
+      gsl_vector *sh = (P != NULL) ? state->sh : state->r;
+      const double *phd = ph->data;
+      const double *shd = sh->data;
+      double rho = 1.0, alpha = 1.0, omega = 1.0;
+      double normr;
+      size_t i, k;
+      int status;
+
+      /* r = b - A*x_0, r~_0 = r, p = v = 0 */
+      gsl_vector_memcpy(state->r, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, state->r);
+      gsl_vector_memcpy(state->rt, state->r);
+      gsl_vector_set_zero(state->p);
+      gsl_vector_set_zero(state->v);
+
+      normr = gsl_blas_dnrm2(state->r);
+
+      for (k = 0; k < state->maxit && normr > reltol; ++k)
+        {
+          double rho_new, rtv, beta;
+          double norms2 = 0.0, ts = 0.0, tt = 0.0, normr2 = 0.0;
+
+          gsl_blas_ddot(state->rt, state->r, &rho_new);
+          if (rho_new == 0.0)
+            break; /* breakdown */
+
+          beta = (rho_new / rho) * (alpha / omega);
+
+          /* p <- r + beta (p - omega v) */
+          for (i = 0; i < N; ++i)
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+          /* v = A*M^{-1}*p */
+          if (P != NULL)
+            {
+              status = gsl_splinalg_precon_apply(state->p, ph, P);
+              if (status)
+                return status;
+            }
+
+          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, ph, 0.0, state->v);
+          gsl_blas_ddot(state->rt, state->v, &rtv);
+          if (rtv == 0.0)
+            break; /* breakdown */
+
+          alpha = rho_new / rtv;
+
+          /* s = r - alpha v, stored in r, and ||s||^2 */
+          for (i = 0; i < N; ++i)
+            {
+              r[i] -= alpha * v[i];
+              norms2 += r[i] * r[i];
+            }
+
+          if (sqrt(norms2) <= reltol)
+            {
+              /* x <- x + alpha M^{-1} p */
+              gsl_blas_daxpy(alpha, ph, x);
+
+              break;
+            }
+
+          /* t = A*M^{-1}*s, omega = (t.s) / (t.t) */
+          if (P != NULL)
+            {
+              status = gsl_splinalg_precon_apply(state->r, sh, P);
+              if (status)
+                return status;
+            }
+
+          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, sh, 0.0, state->t);
+          for (i = 0; i < N; ++i)
+            {
+              ts += t[i] * r[i];
+              tt += t[i] * t[i];
+            }
+
+          omega = (tt > 0.0) ? ts / tt : 0.0;
+
+          /* x <- x + M^{-1} (alpha p + omega s), r <- s - omega t, ||r||^2 */
+          for (i = 0; i < N; ++i)
+            {
+              xd[i * incx] += alpha * phd[i] + omega * shd[i];
+              r[i] -= omega * t[i];
+              normr2 += r[i] * r[i];
+            }
+
+          normr = sqrt(normr2);
+
+          if (omega == 0.0)
+            break; /* stagnation */
+
+          rho = rho_new;
+        }
+
+      /* compute true residual r = b - A*x */
+      gsl_vector_memcpy(state->r, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, state->r);
+      normr = gsl_blas_dnrm2(state->r);
+
+      /* store residual norm */
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;  /* converged */
+      else
+        return GSL_CONTINUE; /* not yet converged */
+    }
+} /* bicgstab_iterate() */
+
+static double
+bicgstab_normr(const void *vstate)
+{
+  const bicgstab_state_t *state = (const bicgstab_state_t *) vstate;
+  return state->normr;
+} /* bicgstab_normr() */
+
+static const gsl_splinalg_itersolve_type bicgstab_type =
+{
+  "bicgstab",
+  &bicgstab_alloc,
+  &bicgstab_iterate,
+  &bicgstab_normr,
+  &bicgstab_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_bicgstab =
+  &bicgstab_type;
@@ -0,0 +1,295 @@
+/* cg.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * The code in this module is based on the conjugate gradient
+ * method described in
+ *
+ * [1] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t maxit;    /* maximum iterations per call */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *p;   /* search direction */
+  gsl_vector *q;   /* q = A*p */
+  gsl_vector *z;   /* preconditioned residual z = M^{-1} r */
+
+  double normr;    /* residual norm ||r|| */
+} cg_state_t;
+
+static void cg_free(void *vstate);
+static int cg_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                      const double tol, const gsl_splinalg_precon *P,
+                      gsl_vector *x, void *vstate);
+
+/*
+cg_alloc()
+  Allocate a CG workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations in each call to
+            cg_iterate(); if this parameter is 0, the value n
+            is used
+
+Return: pointer to workspace
+*/
+
+static void *
+cg_alloc(const size_t n, const size_t m)
+{
+  cg_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(cg_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate cg state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->maxit = (m == 0) ? n : m;
+
+  state->r = gsl_vector_alloc(n);
+  state->p = gsl_vector_alloc(n);
+  state->q = gsl_vector_alloc(n);
+  state->z = gsl_vector_alloc(n);
+  if (!state->r || !state->p || !state->q || !state->z)
+    {
+      cg_free(state);
+      GSL_ERROR_NULL("failed to allocate cg vectors", GSL_ENOMEM);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* cg_alloc() */
+
+static void
+cg_free(void *vstate)
+{
+  cg_state_t *state = (cg_state_t *) vstate;
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->p)
+    gsl_vector_free(state->p);
+
+  if (state->q)
+    gsl_vector_free(state->q);
+
+  if (state->z)
+    gsl_vector_free(state->z);
+
+  free(state);
+} /* cg_free() */
+
+/*
+cg_iterate()
+  Solve A*x = b using the conjugate gradient method
+
+Inputs: A    - sparse symmetric positive (or negative) definite matrix
+        b    - right hand side vector
+        tol  - stopping tolerance (see below)
+        P    - symmetric positive definite preconditioner, or NULL
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if converged to solution (solution stored in x). In
+this case the following will be true:
+
+||b - A*x|| <= tol * ||b||
+
+GSL_CONTINUE if not yet converged; in this case x contains the
+most recent solution vector and calling this function more times
+with the input x restarts the method from x
+
+Notes:
+1) Based on algorithm 6.18 of (Saad, 2003 [1]). The updates of x
+and r and the new ||r||^2 are computed in one pass over the vectors,
+so each iteration makes one matrix-vector product and three passes
+over the vectors (p.q, the fused update, and the update of p)
+
+2) With a preconditioner M this is algorithm 9.1 of (Saad, 2003 [1]),
+with z = M^{-1} r in place of r in the search directions and
+rho = r.z; the stopping test is still on ||r||
+
+3) The iteration stops on the recursively updated residual, and the
+true residual b - A*x is computed at the end, so that rounding
+errors in the recursion cannot give a false convergence
+
+4) On output, work->normr contains ||b - A*x||
+*/
+
+static int
+cg_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+           const double tol, const gsl_splinalg_precon *P,
+           gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  cg_state_t *state = (cg_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      const size_t incx = x->stride;
+      double *xd = x->data;
+      double *r = state->r->data;
+      double *p = state->p->data;
+      double *q = state->q->data;
+      double *z = (P != NULL) ? state->z->data : r;
+      double rho, normr;
+      size_t i, k;
+      int status;
+
+      /* r = b - A*x_0, p = z = M^{-1} r */
+      gsl_vector_memcpy(state->r, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, state->r);
+      normr = gsl_blas_dnrm2(state->r);
+
+      if (P != NULL)
+        {
+          status = gsl_splinalg_precon_apply(state->r, state->z, P);
+          if (status)
+            return status;
+
+          gsl_vector_memcpy(state->p, state->z);
+          gsl_blas_ddot(state->r, state->z, &rho);
+        }
+      else
+        {
+          gsl_vector_memcpy(state->p, state->r);
+          rho = normr * normr;
+        }
+
+      for (k = 0; k < state->maxit && normr > reltol; ++k)
+        {
+          double pq, alpha, beta, normr2 = 0.0, rho_new;
+
+          /* q = A*p */
+          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, state->p, 0.0, state->q);
+          gsl_blas_ddot(state->p, state->q, &pq);
+
+          if (pq == 0.0)
+            break; /* breakdown */
+
+          alpha = rho / pq;
+
+          /* x <- x + alpha p, r <- r - alpha q, ||r||^2 */
+          for (i = 0; i < N; ++i)
+            {
+              xd[i * incx] += alpha * p[i];
+              r[i] -= alpha * q[i];
+              normr2 += r[i] * r[i];
+            }
+
+          normr = sqrt(normr2);
+          if (normr <= reltol)
+            break;
+
+          /* z = M^{-1} r, rho_new = r.z */
+          if (P != NULL)
+            {
+              status = gsl_splinalg_precon_apply(state->r, state->z, P);
+              if (status)
+                return status;
+
+              gsl_blas_ddot(state->r, state->z, &rho_new);
+            }
+          else
+            {
+              rho_new = normr2;
+            }
+
+          /* p <- z + beta p */
+          beta = rho_new / rho;
+          for (i = 0; i < N; ++i)
+            p[i] = z[i] + beta * p[i];
+
+          rho = rho_new;
+        }
+
+      /* compute true residual r = b - A*x */
+      gsl_vector_memcpy(state->r, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, state->r);
+      normr = gsl_blas_dnrm2(state->r);
+
+      /* store residual norm */
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;  /* converged */
+      else
+        return GSL_CONTINUE; /* not yet converged */
+    }
+} /* cg_iterate() */
+
+static double
+cg_normr(const void *vstate)
+{
+  const cg_state_t *state = (const cg_state_t *) vstate;
+  return state->normr;
+} /* cg_normr() */
+
+static const gsl_splinalg_itersolve_type cg_type =
+{
+  "cg",
+  &cg_alloc,
+  &cg_iterate,
+  &cg_normr,
+  &cg_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_cg =
+  &cg_type;
@@ -0,0 +1,1083 @@
+/* eigen.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_complex_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * This module computes a few eigenpairs of a large sparse matrix, or
+ * of an operator given as a function, with a restarted Krylov method.
+ * It is based on
+ *
+ * [1] K. Wu and H. Simon, Thick-restart Lanczos method for large
+ *     symmetric eigenvalue problems, SIAM J. Matrix Anal. Appl.
+ *     22(2), 2000.
+ *
+ * [2] G. W. Stewart, A Krylov-Schur algorithm for large
+ *     eigenproblems, SIAM J. Matrix Anal. Appl. 23(3), 2001.
+ *
+ * [3] R. B. Lehoucq, D. C. Sorensen and C. Yang, ARPACK Users' Guide,
+ *     SIAM, 1998.
+ *
+ * The method keeps a Krylov decomposition
+ *
+ *   A V_m = V_m H_m + v_{m+1} h^T
+ *
+ * with orthonormal V, built by Arnoldi steps with full
+ * reorthogonalization. The eigenpairs of the small matrix H_m give
+ * the Ritz pairs; at a restart, the basis is contracted to the
+ * subspace spanned by the wanted Ritz vectors, which keeps the form
+ * of the decomposition, with a full row h^T (the "thick" restart of
+ * [1], and the Krylov-Schur restart of [2]). For a symmetric operator
+ * H_m is symmetric and the method is the thick-restart Lanczos method
+ * of [1]
+ */
+
+/* number of columns of V updated at once in a restart */
+#define SPEIGEN_BLOCK 128
+
+typedef int (*speigen_func) (const gsl_vector * x, void * params,
+                             gsl_vector * y);
+
+static int speigen_run(speigen_func f, void *params, const int symmetric,
+                       const gsl_splinalg_eigen_target_t target,
+                       gsl_splinalg_eigen_workspace *w);
+static int speigen_step(speigen_func f, void *params, const size_t j,
+                        gsl_splinalg_eigen_workspace *w);
+static void speigen_random(const size_t j, gsl_splinalg_eigen_workspace *w);
+static size_t speigen_ritz(const int symmetric,
+                           const gsl_splinalg_eigen_target_t target,
+                           gsl_splinalg_eigen_workspace *w);
+static size_t speigen_restart(const int symmetric,
+                              gsl_splinalg_eigen_workspace *w);
+static int speigen_spmv(const gsl_vector *x, void *params, gsl_vector *y);
+static int speigen_lusolve(const gsl_vector *x, void *params, gsl_vector *y);
+static gsl_splinalg_lu_workspace *speigen_shift(const gsl_spmatrix *A,
+                                                const double sigma);
+
+/*
+gsl_splinalg_eigen_alloc()
+  Allocate a workspace for computing a few eigenpairs of an n-by-n
+operator
+
+Inputs: n   - size of operator
+        nev - number of eigenvalues wanted
+        ncv - dimension of the Krylov subspace, nev < ncv <= n; if this
+              parameter is 0, the value min(n, max(2*nev+1, 20)) is used
+
+Return: pointer to workspace
+*/
+
+gsl_splinalg_eigen_workspace *
+gsl_splinalg_eigen_alloc(const size_t n, const size_t nev, const size_t ncv)
+{
+  gsl_splinalg_eigen_workspace *w;
+  size_t m = ncv;
+
+  if (m == 0)
+    m = GSL_MIN(n, GSL_MAX(2 * nev + 1, 20));
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+  else if (nev == 0)
+    {
+      GSL_ERROR_NULL("nev must be a positive integer", GSL_EINVAL);
+    }
+  else if (m <= nev || m > n)
+    {
+      GSL_ERROR_NULL("ncv must satisfy nev < ncv <= n", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_eigen_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for eigen workspace",
+                     GSL_ENOMEM);
+    }
+
+  w->n = n;
+  w->nev = nev;
+  w->ncv = m;
+  w->tol = 1.0e-10;
+  w->maxiter = 1000;
+
+  w->V = gsl_matrix_alloc(m + 1, n);
+  w->H = gsl_matrix_alloc(m + 1, m);
+  w->S = gsl_matrix_alloc(m, m);
+  w->Y = gsl_matrix_alloc(m, m);
+  w->T = gsl_matrix_alloc(m, m);
+  w->h = gsl_vector_alloc(m + 1);
+  w->theta = gsl_vector_alloc(m);
+  w->theta_c = gsl_vector_complex_alloc(m);
+  w->Y_c = gsl_matrix_complex_alloc(m, m);
+  w->resid = gsl_vector_alloc(m);
+  w->score = gsl_vector_alloc(m);
+  w->order = malloc(m * sizeof(size_t));
+  w->work = gsl_matrix_alloc(m, GSL_MIN(n, SPEIGEN_BLOCK));
+  w->symm_p = gsl_eigen_symmv_alloc(m);
+  w->nonsymm_p = gsl_eigen_nonsymmv_alloc(m);
+  w->r = gsl_rng_alloc(gsl_rng_mt19937);
+
+  if (!w->V || !w->H || !w->S || !w->Y || !w->T || !w->h || !w->theta ||
+      !w->theta_c || !w->Y_c || !w->resid || !w->score || !w->order ||
+      !w->work || !w->symm_p || !w->nonsymm_p || !w->r)
+    {
+      gsl_splinalg_eigen_free(w);
+      GSL_ERROR_NULL("failed to allocate space for eigen workspace",
+                     GSL_ENOMEM);
+    }
+
+  return w;
+} /* gsl_splinalg_eigen_alloc() */
+
+void
+gsl_splinalg_eigen_free(gsl_splinalg_eigen_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->V)
+    gsl_matrix_free(w->V);
+
+  if (w->H)
+    gsl_matrix_free(w->H);
+
+  if (w->S)
+    gsl_matrix_free(w->S);
+
+  if (w->Y)
+    gsl_matrix_free(w->Y);
+
+  if (w->T)
+    gsl_matrix_free(w->T);
+
+  if (w->h)
+    gsl_vector_free(w->h);
+
+  if (w->theta)
+    gsl_vector_free(w->theta);
+
+  if (w->theta_c)
+    gsl_vector_complex_free(w->theta_c);
+
+  if (w->Y_c)
+    gsl_matrix_complex_free(w->Y_c);
+
+  if (w->resid)
+    gsl_vector_free(w->resid);
+
+  if (w->score)
+    gsl_vector_free(w->score);
+
+  if (w->order)
+    free(w->order);
+
+  if (w->work)
+    gsl_matrix_free(w->work);
+
+  if (w->symm_p)
+    gsl_eigen_symmv_free(w->symm_p);
+
+  if (w->nonsymm_p)
+    gsl_eigen_nonsymmv_free(w->nonsymm_p);
+
+  if (w->r)
+    gsl_rng_free(w->r);
+
+  free(w);
+} /* gsl_splinalg_eigen_free() */
+
+/*
+gsl_splinalg_eigen_params()
+  Set the stopping parameters of the eigensolver
+
+Inputs: tol     - relative tolerance: a Ritz pair (theta, y) is accepted
+                  when ||A y - theta y|| <= tol * max(|theta|, eps^{2/3})
+        maxiter - maximum number of restarts
+        w       - workspace
+
+Return: success or error
+*/
+
+int
+gsl_splinalg_eigen_params(const double tol, const size_t maxiter,
+                          gsl_splinalg_eigen_workspace *w)
+{
+  if (tol <= 0.0)
+    {
+      GSL_ERROR("tolerance must be positive", GSL_EINVAL);
+    }
+  else if (maxiter == 0)
+    {
+      GSL_ERROR("maxiter must be a positive integer", GSL_EINVAL);
+    }
+  else
+    {
+      w->tol = tol;
+      w->maxiter = maxiter;
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_eigen_params() */
+
+/*
+gsl_splinalg_eigen_symm_f()
+  Compute nev eigenpairs of a symmetric operator
+
+Inputs: F      - operator; F->f(x, F->params, y) computes y = A x, or
+                 y = (A - sigma I)^{-1} x for the target
+                 GSL_SPLINALG_EIGEN_SHIFT_INVERT
+        target - which eigenvalues are wanted
+        sigma  - shift, used only for GSL_SPLINALG_EIGEN_SHIFT_INVERT
+        eval   - (output) eigenvalues, length nev
+        evec   - (output) orthonormal eigenvectors, n-by-nev
+        w      - workspace
+
+Return: GSL_SUCCESS if all nev eigenpairs converged, GSL_EMAXITER if
+not; in that case w->nconv of them did, and eval and evec contain the
+current estimates
+
+Notes:
+1) The eigenvalues are sorted in decreasing order for
+GSL_SPLINALG_EIGEN_LARGEST, in increasing order for
+GSL_SPLINALG_EIGEN_SMALLEST, by decreasing magnitude for
+GSL_SPLINALG_EIGEN_LARGEST_ABS, and by increasing distance from sigma
+for GSL_SPLINALG_EIGEN_SHIFT_INVERT
+*/
+
+int
+gsl_splinalg_eigen_symm_f(gsl_splinalg_eigen_function *F,
+                          const gsl_splinalg_eigen_target_t target,
+                          const double sigma, gsl_vector *eval,
+                          gsl_matrix *evec, gsl_splinalg_eigen_workspace *w)
+{
+  if (F->n != w->n)
+    {
+      GSL_ERROR("operator does not match workspace", GSL_EBADLEN);
+    }
+  else if (eval->size != w->nev)
+    {
+      GSL_ERROR("eval vector must have length nev", GSL_EBADLEN);
+    }
+  else if (evec->size1 != w->n || evec->size2 != w->nev)
+    {
+      GSL_ERROR("evec matrix must be n-by-nev", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t m = w->ncv;
+      gsl_matrix_const_view Vm = gsl_matrix_const_submatrix(w->V, 0, 0, m, w->n);
+      int status;
+      size_t k;
+
+      status = speigen_run(F->f, F->params, 1, target, w);
+      if (status != GSL_SUCCESS && status != GSL_EMAXITER)
+        return status;
+
+      for (k = 0; k < w->nev; ++k)
+        {
+          const size_t idx = w->order[k];
+          const double theta = gsl_vector_get(w->theta, idx);
+          gsl_vector_const_view y = gsl_matrix_const_column(w->Y, idx);
+          gsl_vector_view v = gsl_matrix_column(evec, k);
+
+          if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+            gsl_vector_set(eval, k, sigma + 1.0 / theta);
+          else
+            gsl_vector_set(eval, k, theta);
+
+          /* eigenvector V_m y */
+          gsl_blas_dgemv(CblasTrans, 1.0, &Vm.matrix, &y.vector, 0.0,
+                         &v.vector);
+        }
+
+      return status;
+    }
+} /* gsl_splinalg_eigen_symm_f() */
+
+/*
+gsl_splinalg_eigen_nonsymm_f()
+  Compute nev eigenpairs of a nonsymmetric operator
+
+Inputs: F      - operator; F->f(x, F->params, y) computes y = A x, or
+                 y = (A - sigma I)^{-1} x for the target
+                 GSL_SPLINALG_EIGEN_SHIFT_INVERT
+        target - which eigenvalues are wanted
+        sigma  - real shift, used only for GSL_SPLINALG_EIGEN_SHIFT_INVERT
+        eval   - (output) eigenvalues, length nev
+        evec   - (output) eigenvectors of unit norm, n-by-nev
+        w      - workspace, with ncv >= nev + 2
+
+Return: GSL_SUCCESS if all nev eigenpairs converged, GSL_EMAXITER if
+not; in that case w->nconv of them did, and eval and evec contain the
+current estimates
+
+Notes:
+1) The eigenvalues are sorted as in gsl_splinalg_eigen_symm_f(), by
+their real parts for GSL_SPLINALG_EIGEN_LARGEST and
+GSL_SPLINALG_EIGEN_SMALLEST. Complex conjugate pairs are adjacent,
+unless the pair is split by the end of eval
+*/
+
+int
+gsl_splinalg_eigen_nonsymm_f(gsl_splinalg_eigen_function *F,
+                             const gsl_splinalg_eigen_target_t target,
+                             const double sigma, gsl_vector_complex *eval,
+                             gsl_matrix_complex *evec,
+                             gsl_splinalg_eigen_workspace *w)
+{
+  if (F->n != w->n)
+    {
+      GSL_ERROR("operator does not match workspace", GSL_EBADLEN);
+    }
+  else if (eval->size != w->nev)
+    {
+      GSL_ERROR("eval vector must have length nev", GSL_EBADLEN);
+    }
+  else if (evec->size1 != w->n || evec->size2 != w->nev)
+    {
+      GSL_ERROR("evec matrix must be n-by-nev", GSL_EBADLEN);
+    }
+  else if (w->ncv < w->nev + 2 && w->ncv < w->n)
+    {
+      GSL_ERROR("ncv must be at least nev + 2", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t n = w->n;
+      const size_t m = w->ncv;
+      gsl_matrix_const_view Vm = gsl_matrix_const_submatrix(w->V, 0, 0, m, n);
+      gsl_vector_view yr = gsl_matrix_column(w->S, 0);
+      gsl_vector_view yi = gsl_matrix_column(w->S, 1);
+      int status;
+      size_t k;
+
+      status = speigen_run(F->f, F->params, 0, target, w);
+      if (status != GSL_SUCCESS && status != GSL_EMAXITER)
+        return status;
+
+      for (k = 0; k < w->nev; ++k)
+        {
+          const size_t idx = w->order[k];
+          gsl_complex theta = gsl_vector_complex_get(w->theta_c, idx);
+          gsl_vector_complex_const_view y =
+            gsl_matrix_complex_const_column(w->Y_c, idx);
+          gsl_vector_const_view yre = gsl_vector_complex_const_real(&y.vector);
+          gsl_vector_const_view yim = gsl_vector_complex_const_imag(&y.vector);
+          gsl_vector_complex_view v = gsl_matrix_complex_column(evec, k);
+          gsl_vector_view vre = gsl_vector_complex_real(&v.vector);
+          gsl_vector_view vim = gsl_vector_complex_imag(&v.vector);
+
+          if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+            theta = gsl_complex_add_real(gsl_complex_inverse(theta), sigma);
+
+          gsl_vector_complex_set(eval, k, theta);
+
+          /* eigenvector V_m y, real and imaginary parts */
+          gsl_vector_memcpy(&yr.vector, &yre.vector);
+          gsl_blas_dgemv(CblasTrans, 1.0, &Vm.matrix, &yr.vector, 0.0,
+                         &vre.vector);
+
+          if (GSL_IMAG(gsl_vector_complex_get(w->theta_c, idx)) != 0.0)
+            {
+              gsl_vector_memcpy(&yi.vector, &yim.vector);
+              gsl_blas_dgemv(CblasTrans, 1.0, &Vm.matrix, &yi.vector, 0.0,
+                             &vim.vector);
+            }
+          else
+            {
+              gsl_vector_set_zero(&vim.vector);
+            }
+        }
+
+      return status;
+    }
+} /* gsl_splinalg_eigen_nonsymm_f() */
+
+/*
+gsl_splinalg_eigen_symm()
+  Compute nev eigenpairs of a symmetric sparse matrix
+
+Inputs: A      - symmetric sparse matrix, in any format, with both
+                 triangles stored
+        target - which eigenvalues are wanted
+        sigma  - shift, used only for GSL_SPLINALG_EIGEN_SHIFT_INVERT
+        eval   - (output) eigenvalues, length nev
+        evec   - (output) orthonormal eigenvectors, n-by-nev
+        w      - workspace
+
+Return: as for gsl_splinalg_eigen_symm_f()
+
+Notes:
+1) For GSL_SPLINALG_EIGEN_SHIFT_INVERT, A - sigma I is factored with
+gsl_splinalg_lu_decomp(), and each step solves a linear system with
+the factors
+*/
+
+int
+gsl_splinalg_eigen_symm(const gsl_spmatrix *A,
+                        const gsl_splinalg_eigen_target_t target,
+                        const double sigma, gsl_vector *eval,
+                        gsl_matrix *evec, gsl_splinalg_eigen_workspace *w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_splinalg_eigen_function F;
+      int status;
+
+      F.n = w->n;
+
+      if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+        {
+          gsl_splinalg_lu_workspace *lu = speigen_shift(A, sigma);
+
+          if (lu == NULL)
+            {
+              GSL_ERROR("unable to factor A - sigma I", GSL_EFAILED);
+            }
+
+          F.f = speigen_lusolve;
+          F.params = lu;
+          status = gsl_splinalg_eigen_symm_f(&F, target, sigma, eval, evec, w);
+          gsl_splinalg_lu_free(lu);
+        }
+      else
+        {
+          F.f = speigen_spmv;
+          F.params = (void *) A;
+          status = gsl_splinalg_eigen_symm_f(&F, target, sigma, eval, evec, w);
+        }
+
+      return status;
+    }
+} /* gsl_splinalg_eigen_symm() */
+
+/*
+gsl_splinalg_eigen_nonsymm()
+  Compute nev eigenpairs of a nonsymmetric sparse matrix
+
+Inputs: A      - sparse matrix, in any format
+        target - which eigenvalues are wanted
+        sigma  - real shift, used only for GSL_SPLINALG_EIGEN_SHIFT_INVERT
+        eval   - (output) eigenvalues, length nev
+        evec   - (output) eigenvectors of unit norm, n-by-nev
+        w      - workspace, with ncv >= nev + 2
+
+Return: as for gsl_splinalg_eigen_nonsymm_f()
+*/
+
+int
+gsl_splinalg_eigen_nonsymm(const gsl_spmatrix *A,
+                           const gsl_splinalg_eigen_target_t target,
+                           const double sigma, gsl_vector_complex *eval,
+                           gsl_matrix_complex *evec,
+                           gsl_splinalg_eigen_workspace *w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_splinalg_eigen_function F;
+      int status;
+
+      F.n = w->n;
+
+      if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+        {
+          gsl_splinalg_lu_workspace *lu = speigen_shift(A, sigma);
+
+          if (lu == NULL)
+            {
+              GSL_ERROR("unable to factor A - sigma I", GSL_EFAILED);
+            }
+
+          F.f = speigen_lusolve;
+          F.params = lu;
+          status = gsl_splinalg_eigen_nonsymm_f(&F, target, sigma, eval,
+                                                evec, w);
+          gsl_splinalg_lu_free(lu);
+        }
+      else
+        {
+          F.f = speigen_spmv;
+          F.params = (void *) A;
+          status = gsl_splinalg_eigen_nonsymm_f(&F, target, sigma, eval,
+                                                evec, w);
+        }
+
+      return status;
+    }
+} /* gsl_splinalg_eigen_nonsymm() */
+
+/*
+speigen_run()
+  Restarted Krylov iteration
+
+Inputs: f         - operator
+        params    - parameters of operator
+        symmetric - 1 if the operator is symmetric
+        target    - which eigenvalues are wanted
+        w         - workspace
+
+Return: GSL_SUCCESS, GSL_EMAXITER, or an error from f
+
+Notes:
+1) On output, the Ritz pairs of the last projected matrix are in
+w->theta and w->Y (symmetric) or w->theta_c and w->Y_c, and w->order
+lists them from the most wanted
+*/
+
+static int
+speigen_run(speigen_func f, void *params, const int symmetric,
+            const gsl_splinalg_eigen_target_t target,
+            gsl_splinalg_eigen_workspace *w)
+{
+  const size_t m = w->ncv;
+  gsl_vector_view v0 = gsl_matrix_row(w->V, 0);
+  size_t j0 = 0;
+  size_t iter;
+  int status;
+
+  w->niter = 0;
+  w->nconv = 0;
+  w->nop = 0;
+
+  /* starting vector */
+  gsl_rng_set(w->r, 0);
+  gsl_matrix_set_zero(w->H);
+  speigen_random(0, w);
+  if (gsl_blas_dnrm2(&v0.vector) == 0.0)
+    gsl_vector_set_basis(&v0.vector, 0);
+
+  for (iter = 0; iter < w->maxiter; ++iter)
+    {
+      size_t j;
+
+      /* extend the decomposition to m vectors */
+      for (j = j0; j < m; ++j)
+        {
+          status = speigen_step(f, params, j, w);
+          if (status)
+            return status;
+        }
+
+      w->niter = iter + 1;
+      w->nconv = speigen_ritz(symmetric, target, w);
+
+      if (w->nconv >= w->nev)
+        return GSL_SUCCESS;
+
+      if (iter + 1 < w->maxiter)
+        j0 = speigen_restart(symmetric, w);
+    }
+
+  return GSL_EMAXITER;
+} /* speigen_run() */
+
+/*
+speigen_step()
+  Arnoldi step: compute v_{j+1} and column j of H from A v_j
+
+Inputs: f      - operator
+        params - parameters of operator
+        j      - index of last basis vector
+        w      - workspace
+
+Return: success or error from f
+
+Notes:
+1) v_{j+1} is orthogonalized against v_0, ..., v_j by classical
+Gram-Schmidt applied twice, which is enough for orthogonality to
+working precision, with matrix-vector products on the rows of V
+
+2) If A v_j lies in the span of the basis, the subspace is invariant;
+then H(j+1,j) = 0 and the iteration continues with a random vector
+orthogonal to the basis
+*/
+
+static int
+speigen_step(speigen_func f, void *params, const size_t j,
+             gsl_splinalg_eigen_workspace *w)
+{
+  const size_t n = w->n;
+  gsl_vector_view vj = gsl_matrix_row(w->V, j);
+  gsl_vector_view v = gsl_matrix_row(w->V, j + 1);
+  gsl_matrix_view Vj = gsl_matrix_submatrix(w->V, 0, 0, j + 1, n);
+  gsl_vector_view h = gsl_vector_subvector(w->h, 0, j + 1);
+  double norm0, beta;
+  size_t i, pass;
+  int status;
+
+  status = f(&vj.vector, params, &v.vector);
+  ++(w->nop);
+  if (status)
+    return status;
+
+  norm0 = gsl_blas_dnrm2(&v.vector);
+
+  for (i = 0; i <= j; ++i)
+    gsl_matrix_set(w->H, i, j, 0.0);
+
+  for (pass = 0; pass < 2; ++pass)
+    {
+      gsl_blas_dgemv(CblasNoTrans, 1.0, &Vj.matrix, &v.vector, 0.0, &h.vector);
+      gsl_blas_dgemv(CblasTrans, -1.0, &Vj.matrix, &h.vector, 1.0, &v.vector);
+
+      for (i = 0; i <= j; ++i)
+        {
+          double *Hij = gsl_matrix_ptr(w->H, i, j);
+          *Hij += gsl_vector_get(&h.vector, i);
+        }
+    }
+
+  beta = gsl_blas_dnrm2(&v.vector);
+
+  if (beta > 10.0 * GSL_DBL_EPSILON * norm0 && beta > 0.0)
+    {
+      gsl_matrix_set(w->H, j + 1, j, beta);
+      gsl_blas_dscal(1.0 / beta, &v.vector);
+    }
+  else
+    {
+      /* invariant subspace */
+      gsl_matrix_set(w->H, j + 1, j, 0.0);
+      speigen_random(j + 1, w);
+    }
+
+  return GSL_SUCCESS;
+} /* speigen_step() */
+
+/*
+speigen_random()
+  Set row j of V to a random unit vector orthogonal to rows 0..j-1,
+or to zero if they span the whole space
+*/
+
+static void
+speigen_random(const size_t j, gsl_splinalg_eigen_workspace *w)
+{
+  const size_t n = w->n;
+  gsl_vector_view v = gsl_matrix_row(w->V, j);
+  double norm;
+  size_t i, pass;
+
+  for (i = 0; i < n; ++i)
+    gsl_vector_set(&v.vector, i, gsl_rng_uniform(w->r) - 0.5);
+
+  if (j > 0)
+    {
+      gsl_matrix_view Vj = gsl_matrix_submatrix(w->V, 0, 0, j, n);
+      gsl_vector_view h = gsl_vector_subvector(w->h, 0, j);
+      double norm0 = gsl_blas_dnrm2(&v.vector);
+
+      for (pass = 0; pass < 2; ++pass)
+        {
+          gsl_blas_dgemv(CblasNoTrans, 1.0, &Vj.matrix, &v.vector, 0.0,
+                         &h.vector);
+          gsl_blas_dgemv(CblasTrans, -1.0, &Vj.matrix, &h.vector, 1.0,
+                         &v.vector);
+        }
+
+      if (gsl_blas_dnrm2(&v.vector) <= 10.0 * GSL_DBL_EPSILON * norm0)
+        {
+          gsl_vector_set_zero(&v.vector);
+          return;
+        }
+    }
+
+  norm = gsl_blas_dnrm2(&v.vector);
+  if (norm > 0.0)
+    gsl_blas_dscal(1.0 / norm, &v.vector);
+} /* speigen_random() */
+
+/*
+speigen_ritz()
+  Compute the Ritz pairs of H_m, sort them and estimate their residuals
+
+Inputs: symmetric - 1 if the operator is symmetric
+        target    - which eigenvalues are wanted
+        w         - workspace
+
+Return: number of converged Ritz pairs among the first nev in w->order
+
+Notes:
+1) For a Ritz pair (theta, V_m y) with ||y|| = 1, the residual is
+A V_m y - theta V_m y = v_{m+1} h^T y, with h^T = H(m,:), whose only
+nonzero element after the Arnoldi steps is H(m,m-1)
+
+2) w->order is sorted by decreasing score, and then by index, so the
+two members of a complex conjugate pair, which have the same score and
+consecutive indices, remain adjacent
+*/
+
+static size_t
+speigen_ritz(const int symmetric, const gsl_splinalg_eigen_target_t target,
+             gsl_splinalg_eigen_workspace *w)
+{
+  const size_t m = w->ncv;
+  const double beta = fabs(gsl_matrix_get(w->H, m, m - 1));
+  const double eps23 = pow(GSL_DBL_EPSILON, 2.0 / 3.0);
+  gsl_matrix_const_view Hm = gsl_matrix_const_submatrix(w->H, 0, 0, m, m);
+  size_t *order = w->order;
+  size_t i, k, nconv;
+
+  gsl_matrix_memcpy(w->S, &Hm.matrix);
+
+  if (symmetric)
+    {
+      /* symmetrize against rounding errors */
+      for (i = 0; i < m; ++i)
+        {
+          for (k = 0; k < i; ++k)
+            {
+              double a = 0.5 * (gsl_matrix_get(w->S, i, k) +
+                                gsl_matrix_get(w->S, k, i));
+              gsl_matrix_set(w->S, i, k, a);
+              gsl_matrix_set(w->S, k, i, a);
+            }
+        }
+
+      gsl_eigen_symmv(w->S, w->theta, w->Y, w->symm_p);
+    }
+  else
+    {
+      gsl_eigen_nonsymmv(w->S, w->theta_c, w->Y_c, w->nonsymm_p);
+    }
+
+  for (i = 0; i < m; ++i)
+    {
+      double re, mag, r;
+
+      if (symmetric)
+        {
+          re = gsl_vector_get(w->theta, i);
+          mag = fabs(re);
+          r = beta * fabs(gsl_matrix_get(w->Y, m - 1, i));
+        }
+      else
+        {
+          gsl_complex z = gsl_vector_complex_get(w->theta_c, i);
+          re = GSL_REAL(z);
+          mag = gsl_complex_abs(z);
+          r = beta * gsl_complex_abs(gsl_matrix_complex_get(w->Y_c, m - 1, i));
+        }
+
+      gsl_vector_set(w->resid, i, r / GSL_MAX(mag, eps23));
+
+      switch (target)
+        {
+          case GSL_SPLINALG_EIGEN_LARGEST:
+            gsl_vector_set(w->score, i, re);
+            break;
+
+          case GSL_SPLINALG_EIGEN_SMALLEST:
+            gsl_vector_set(w->score, i, -re);
+            break;
+
+          default:
+            gsl_vector_set(w->score, i, mag);
+            break;
+        }
+
+      order[i] = i;
+    }
+
+  /* insertion sort; m is small */
+  for (i = 1; i < m; ++i)
+    {
+      const size_t idx = order[i];
+      const double s = gsl_vector_get(w->score, idx);
+
+      k = i;
+      while (k > 0)
+        {
+          const double sk = gsl_vector_get(w->score, order[k - 1]);
+
+          if (sk > s || (sk == s && order[k - 1] < idx))
+            break;
+
+          order[k] = order[k - 1];
+          --k;
+        }
+
+      order[k] = idx;
+    }
+
+  nconv = 0;
+  for (k = 0; k < w->nev; ++k)
+    {
+      if (gsl_vector_get(w->resid, order[k]) <= w->tol)
+        ++nconv;
+    }
+
+  return nconv;
+} /* speigen_ritz() */
+
+/*
+speigen_restart()
+  Contract the decomposition to the wanted Ritz vectors
+
+Inputs: symmetric - 1 if the operator is symmetric
+        w         - workspace, after speigen_ritz()
+
+Return: dimension k of the contracted decomposition
+
+Notes:
+1) The nev + (ncv - nev)/2 most wanted Ritz vectors are kept, as
+suggested in [1]; a complex conjugate pair is kept or dropped as a
+whole, and at most ncv - 1 vectors are kept
+
+2) With Q an orthonormal m-by-k basis of the kept Ritz vectors of H_m,
+which spans an invariant subspace of H_m, the decomposition becomes
+
+  A (V_m Q) = (V_m Q) (Q^T H_m Q) + v_{m+1} h^T Q
+
+In the symmetric case Q is formed by the Ritz vectors themselves, and
+in the nonsymmetric case by the real and imaginary parts of the
+complex ones, orthonormalized by modified Gram-Schmidt; this takes
+the place of the reordered Schur form of [2]
+
+3) V_m Q is computed in blocks of columns of V, in place
+*/
+
+static size_t
+speigen_restart(const int symmetric, gsl_splinalg_eigen_workspace *w)
+{
+  const size_t n = w->n;
+  const size_t m = w->ncv;
+  const size_t keep = GSL_MIN(w->nev + (m - w->nev) / 2, m - 1);
+  const double beta = gsl_matrix_get(w->H, m, m - 1);
+  gsl_matrix *Q = w->S;
+  size_t i, k = 0, c;
+
+  /* Q = basis of wanted Ritz vectors */
+  i = 0;
+  while (i < m && k < keep)
+    {
+      const size_t idx = w->order[i];
+
+      if (symmetric)
+        {
+          gsl_vector_view q = gsl_matrix_column(Q, k);
+          gsl_vector_view y = gsl_matrix_column(w->Y, idx);
+
+          gsl_vector_memcpy(&q.vector, &y.vector);
+          ++k;
+          ++i;
+        }
+      else
+        {
+          gsl_vector_complex_view y = gsl_matrix_complex_column(w->Y_c, idx);
+          gsl_vector_view yre = gsl_vector_complex_real(&y.vector);
+          gsl_vector_view yim = gsl_vector_complex_imag(&y.vector);
+          const int pair =
+            (GSL_IMAG(gsl_vector_complex_get(w->theta_c, idx)) != 0.0);
+          size_t s, ncol = pair ? 2 : 1;
+
+          if (k + ncol > m - 1)
+            break;
+
+          for (s = 0; s < ncol; ++s)
+            {
+              gsl_vector_view q = gsl_matrix_column(Q, k);
+              double norm0, norm;
+              size_t pass, l;
+
+              gsl_vector_memcpy(&q.vector, s == 0 ? &yre.vector : &yim.vector);
+              norm0 = gsl_blas_dnrm2(&q.vector);
+
+              for (pass = 0; pass < 2; ++pass)
+                {
+                  for (l = 0; l < k; ++l)
+                    {
+                      gsl_vector_view ql = gsl_matrix_column(Q, l);
+                      double dot;
+
+                      gsl_blas_ddot(&ql.vector, &q.vector, &dot);
+                      gsl_blas_daxpy(-dot, &ql.vector, &q.vector);
+                    }
+                }
+
+              norm = gsl_blas_dnrm2(&q.vector);
+              if (norm > 1.0e3 * GSL_DBL_EPSILON * norm0)
+                {
+                  gsl_blas_dscal(1.0 / norm, &q.vector);
+                  ++k;
+                }
+            }
+
+          i += ncol;
+        }
+    }
+
+  {
+    gsl_matrix_view Qk = gsl_matrix_submatrix(Q, 0, 0, m, k);
+    gsl_matrix_view Hm = gsl_matrix_submatrix(w->H, 0, 0, m, m);
+    gsl_matrix_view HQ = gsl_matrix_submatrix(w->T, 0, 0, m, k);
+    gsl_matrix_view Tk = gsl_matrix_submatrix(w->Y, 0, 0, k, k);
+    gsl_matrix_view Hk = gsl_matrix_submatrix(w->H, 0, 0, k, k);
+    gsl_vector_view vm = gsl_matrix_row(w->V, m);
+    gsl_vector_view vk = gsl_matrix_row(w->V, k);
+
+    /* T_k = Q^T H_m Q */
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &Hm.matrix, &Qk.matrix,
+                   0.0, &HQ.matrix);
+    gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &Qk.matrix, &HQ.matrix,
+                   0.0, &Tk.matrix);
+
+    /* V_k = V_m Q; rows of V are the basis vectors, so V_k^T = Q^T V_m^T */
+    for (c = 0; c < n; c += SPEIGEN_BLOCK)
+      {
+        const size_t nb = GSL_MIN(SPEIGEN_BLOCK, n - c);
+        gsl_matrix_view Vb = gsl_matrix_submatrix(w->V, 0, c, m, nb);
+        gsl_matrix_view Wb = gsl_matrix_submatrix(w->work, 0, 0, k, nb);
+        gsl_matrix_view Vkb = gsl_matrix_submatrix(w->V, 0, c, k, nb);
+
+        gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &Qk.matrix, &Vb.matrix,
+                       0.0, &Wb.matrix);
+        gsl_matrix_memcpy(&Vkb.matrix, &Wb.matrix);
+      }
+
+    /* v_{k+1} = v_{m+1} */
+    gsl_vector_memcpy(&vk.vector, &vm.vector);
+
+    /* H = [ T_k ; h^T Q ] */
+    gsl_matrix_set_zero(w->H);
+    gsl_matrix_memcpy(&Hk.matrix, &Tk.matrix);
+
+    for (i = 0; i < k; ++i)
+      gsl_matrix_set(w->H, k, i, beta * gsl_matrix_get(Q, m - 1, i));
+  }
+
+  return k;
+} /* speigen_restart() */
+
+/* y = A x for a sparse matrix A */
+static int
+speigen_spmv(const gsl_vector *x, void *params, gsl_vector *y)
+{
+  const gsl_spmatrix *A = (const gsl_spmatrix *) params;
+  return gsl_spblas_dgemv(CblasNoTrans, 1.0, A, x, 0.0, y);
+}
+
+/* y = (A - sigma I)^{-1} x from the LU factors of A - sigma I */
+static int
+speigen_lusolve(const gsl_vector *x, void *params, gsl_vector *y)
+{
+  gsl_splinalg_lu_workspace *lu = (gsl_splinalg_lu_workspace *) params;
+  return gsl_splinalg_lu_solve(x, y, lu);
+}
+
+/*
+speigen_shift()
+  Factor A - sigma I
+
+Return: LU workspace holding the factors, or NULL on error
+*/
+
+static gsl_splinalg_lu_workspace *
+speigen_shift(const gsl_spmatrix *A, const double sigma)
+{
+  const size_t n = A->size1;
+  gsl_spmatrix *T, *C;
+  gsl_splinalg_lu_workspace *lu;
+  size_t i, j, p;
+  int status;
+
+  /* duplicates are summed when T is compressed */
+  T = gsl_spmatrix_alloc_nzmax(n, n, A->nz + n,
+                               GSL_SPMATRIX_TRIPLET | GSL_SPMATRIX_NOTREE);
+  if (T == NULL)
+    return NULL;
+
+  if (GSL_SPMATRIX_ISTRIPLET(A))
+    {
+      for (p = 0; p < A->nz; ++p)
+        gsl_spmatrix_set(T, A->i[p], A->p[p], A->data[p]);
+    }
+  else
+    {
+      for (j = 0; j < A->size2; ++j)
+        {
+          for (p = A->p[j]; p < A->p[j + 1]; ++p)
+            {
+              if (GSL_SPMATRIX_ISCCS(A))
+                gsl_spmatrix_set(T, A->i[p], j, A->data[p]);
+              else
+                gsl_spmatrix_set(T, j, A->i[p], A->data[p]);
+            }
+        }
+    }
+
+  for (i = 0; i < n; ++i)
+    gsl_spmatrix_set(T, i, i, -sigma);
+
+  C = gsl_spmatrix_ccs(T);
+  gsl_spmatrix_free(T);
+  if (C == NULL)
+    return NULL;
+
+  lu = gsl_splinalg_lu_alloc(n);
+  if (lu == NULL)
+    {
+      gsl_spmatrix_free(C);
+      return NULL;
+    }
+
+  status = gsl_splinalg_lu_symbolic(C, lu);
+  if (!status)
+    status = gsl_splinalg_lu_decomp(C, lu);
+
+  gsl_spmatrix_free(C);
+
+  if (status)
+    {
+      gsl_splinalg_lu_free(lu);
+      return NULL;
+    }
+
+  return lu;
+} /* speigen_shift() */
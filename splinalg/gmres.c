@@ -45,6 +45,7 @@ typedef struct
   size_t n;        /* size of linear system */
   size_t m;        /* dimension of Krylov subspace K_m */
   gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *z;   /* preconditioned vector M^{-1} v */
   gsl_matrix *H;   /* Hessenberg matrix n-by-(m+1) */
   gsl_vector *tau; /* householder scalars */
   gsl_vector *y;   /* least squares rhs and solution vector */
@@ -57,7 +58,8 @@ typedef struct
 
 static void gmres_free(void *vstate);
 static int gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
-                         const double tol, gsl_vector *x, void *vstate);
+                         const double tol, const gsl_splinalg_precon *P,
+                         gsl_vector *x, void *vstate);
 
 /*
 gmres_alloc()
@@ -103,6 +105,13 @@ gmres_alloc(const size_t n, const size_t m)
       GSL_ERROR_NULL("failed to allocate r vector", GSL_ENOMEM);
     }
 
+  state->z = gsl_vector_alloc(n);
+  if (!state->z)
+    {
+      gmres_free(state);
+      GSL_ERROR_NULL("failed to allocate z vector", GSL_ENOMEM);
+    }
+
   state->H = gsl_matrix_alloc(n, state->m + 1);
   if (!state->H)
     {
@@ -145,6 +154,9 @@ gmres_free(void *vstate)
   if (state->r)
     gsl_vector_free(state->r);
 
+  if (state->z)
+    gsl_vector_free(state->z);
+
   if (state->H)
     gsl_matrix_free(state->H);
 
@@ -170,6 +182,7 @@ gmres_iterate()
 Inputs: A    - sparse square matrix
         b    - right hand side vector
         tol  - stopping tolerance (see below)
+        P    - preconditioner, or NULL
         x    - (input/output) on input, initial estimate x_0;
                on output, solution vector
         work - workspace
@@ -188,13 +201,18 @@ Notes:
 1) Based on algorithm 2.2 of (Walker, 1998 [1]) and algorithm 6.10 of
 (Saad, 2003 [2])
 
-2) On output, work->normr contains ||b - A*x||
+2) A preconditioner M is applied on the right (Saad, 2003 [2],
+algorithm 9.5): the Krylov subspace is built for A M^{-1}, and the
+update of x is M^{-1} V_m y_m, so the residual being minimized is
+that of the original system
+
+3) On output, work->normr contains ||b - A*x||
 */
 
 static int
 gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
-              const double tol, gsl_vector *x,
-              void *vstate)
+              const double tol, const gsl_splinalg_precon *P,
+              gsl_vector *x, void *vstate)
 {
   const size_t N = A->size1;
   gmres_state_t *state = (gmres_state_t *) vstate;
@@ -292,8 +310,20 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
               gsl_linalg_householder_hv(tau, &uk.vector, &vk.vector);
             }
 
-          /* Step 2a: v_m <- A*v_m */
-          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vm.vector, 0.0, r);
+          /* Step 2a: v_m <- A*M^{-1}*v_m */
+          if (P != NULL)
+            {
+              status = gsl_splinalg_precon_apply(&vm.vector, state->z, P);
+              if (status)
+                return status;
+
+              gsl_spblas_dgemv(CblasNoTrans, 1.0, A, state->z, 0.0, r);
+            }
+          else
+            {
+              gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vm.vector, 0.0, r);
+            }
+
           gsl_vector_memcpy(&vm.vector, r);
 
           /* Step 2a: v_m <- P_m ... P_1 v_m */
@@ -395,8 +425,19 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
           gsl_linalg_householder_hv(tau, &uk.vector, &rk.vector);
         }
 
-      /* x <- x + V_m y_m */
-      gsl_vector_add(x, r);
+      /* x <- x + M^{-1} V_m y_m */
+      if (P != NULL)
+        {
+          status = gsl_splinalg_precon_apply(r, state->z, P);
+          if (status)
+            return status;
+
+          gsl_vector_add(x, state->z);
+        }
+      else
+        {
+          gsl_vector_add(x, r);
+        }
 
       /* compute new residual r = b - A*x */
       gsl_vector_memcpy(r, b);
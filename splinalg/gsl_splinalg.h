@@ -23,8 +23,11 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_types.h>
 
 #undef __BEGIN_DECLS
@@ -39,13 +42,37 @@
 
 __BEGIN_DECLS
 
+/* preconditioner type */
+typedef struct
+{
+  const char *name;
+  void * (*alloc) (const size_t n);
+  int (*init) (const gsl_spmatrix *A, void *);
+  int (*apply) (const gsl_vector *r, gsl_vector *z, void *);
+  void (*free) (void *);
+} gsl_splinalg_precon_type;
+
+typedef struct
+{
+  const gsl_splinalg_precon_type * type;
+  size_t n;
+  void * state;
+} gsl_splinalg_precon;
+
+/* available types */
+GSL_VAR const gsl_splinalg_precon_type * gsl_splinalg_precon_jacobi;
+GSL_VAR const gsl_splinalg_precon_type * gsl_splinalg_precon_ssor;
+GSL_VAR const gsl_splinalg_precon_type * gsl_splinalg_precon_ilu0;
+GSL_VAR const gsl_splinalg_precon_type * gsl_splinalg_precon_ic0;
+
 /* iteration solver type */
 typedef struct
 {
   const char *name;
   void * (*alloc) (const size_t n, const size_t m);
   int (*iterate) (const gsl_spmatrix *A, const gsl_vector *b,
-                  const double tol, gsl_vector *x, void *);
+                  const double tol, const gsl_splinalg_precon *P,
+                  gsl_vector *x, void *);
   double (*normr)(const void *);
   void (*free) (void *);
 } gsl_splinalg_itersolve_type;
@@ -55,14 +82,112 @@ typedef struct
   const gsl_splinalg_itersolve_type * type;
   double normr; /* current residual norm || b - A x || */
   void * state;
+  const gsl_splinalg_precon * precon; /* preconditioner, or NULL */
 } gsl_splinalg_itersolve;
 
 /* available types */
 GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_gmres;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_cg;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_bicgstab;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_minres;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_idrs;
+
+/* sparse LDL^T factorization P A P^T = L D L^T */
+typedef struct
+{
+  size_t n;
+  gsl_permutation * perm; /* fill-reducing ordering P */
+  size_t * pinv;          /* inverse of perm */
+  size_t * parent;        /* elimination tree of P A P^T */
+  size_t * Lnz;           /* number of entries in each column of L */
+  gsl_spmatrix * C;       /* upper triangle of P A P^T, CCS */
+  gsl_spmatrix * L;       /* strictly lower triangle of unit L, CCS */
+  gsl_vector * D;         /* diagonal factor */
+  size_t * flag;          /* workspace, length n */
+  size_t * pattern;       /* workspace, length n */
+  double * y;             /* workspace, length n */
+  int symbolic;           /* symbolic analysis done */
+  int factored;           /* numerical factorization done */
+} gsl_splinalg_ldlt_workspace;
+
+/* sparse LU factorization P A Q = L U */
+typedef struct
+{
+  size_t n;
+  gsl_permutation * q;    /* column ordering Q */
+  size_t * pinv;          /* row ordering: row i of A is row pinv[i] of P A */
+  gsl_spmatrix * C;       /* copy of A, CCS */
+  gsl_spmatrix * L;       /* unit lower triangular factor, CCS */
+  gsl_spmatrix * U;       /* upper triangular factor, CCS */
+  double * x;             /* workspace, length n */
+  size_t * xi;            /* workspace, length n */
+  size_t * stack;         /* workspace, length n */
+  size_t * pstack;        /* workspace, length n */
+  size_t * mark;          /* workspace, length n */
+  int symbolic;           /* symbolic analysis done */
+  int factored;           /* numerical factorization done */
+} gsl_splinalg_lu_workspace;
+
+/* linear operator y = A x for the sparse eigensolvers */
+typedef struct
+{
+  int (* f) (const gsl_vector * x, void * params, gsl_vector * y);
+  size_t n;
+  void * params;
+} gsl_splinalg_eigen_function;
+
+/* eigenvalues wanted from the sparse eigensolvers */
+typedef enum
+{
+  GSL_SPLINALG_EIGEN_LARGEST,     /* largest, or largest real part */
+  GSL_SPLINALG_EIGEN_SMALLEST,    /* smallest, or smallest real part */
+  GSL_SPLINALG_EIGEN_LARGEST_ABS, /* largest magnitude */
+  GSL_SPLINALG_EIGEN_SHIFT_INVERT /* nearest a shift sigma */
+} gsl_splinalg_eigen_target_t;
+
+/* restarted Krylov eigensolver */
+typedef struct
+{
+  size_t n;                  /* size of operator */
+  size_t nev;                /* number of wanted eigenvalues */
+  size_t ncv;                /* dimension m of the Krylov subspace */
+  double tol;                /* relative tolerance of Ritz residuals */
+  size_t maxiter;            /* maximum number of restarts */
+  size_t niter;              /* restarts in last call */
+  size_t nconv;              /* converged eigenvalues in last call */
+  size_t nop;                /* operator applications in last call */
+  gsl_matrix * V;            /* Krylov basis, one vector per row, (m+1)-by-n */
+  gsl_matrix * H;            /* projected matrix, (m+1)-by-m */
+  gsl_matrix * S;            /* workspace, m-by-m */
+  gsl_matrix * Y;            /* Ritz vectors of H, symmetric case, m-by-m */
+  gsl_matrix * T;            /* workspace, m-by-m */
+  gsl_vector * h;            /* orthogonalization coefficients, length m+1 */
+  gsl_vector * theta;        /* Ritz values, symmetric case */
+  gsl_vector_complex * theta_c; /* Ritz values, nonsymmetric case */
+  gsl_matrix_complex * Y_c;  /* Ritz vectors of H, nonsymmetric case */
+  gsl_vector * resid;        /* relative residuals of Ritz pairs */
+  gsl_vector * score;        /* preference of Ritz values */
+  size_t * order;            /* Ritz values, most wanted first */
+  gsl_matrix * work;         /* workspace for restarts */
+  gsl_eigen_symmv_workspace * symm_p;
+  gsl_eigen_nonsymmv_workspace * nonsymm_p;
+  gsl_rng * r;               /* starting vectors */
+} gsl_splinalg_eigen_workspace;
 
 /*
  * Prototypes
  */
+gsl_splinalg_precon *
+gsl_splinalg_precon_alloc(const gsl_splinalg_precon_type *T,
+                          const size_t n);
+void gsl_splinalg_precon_free(gsl_splinalg_precon *P);
+const char *gsl_splinalg_precon_name(const gsl_splinalg_precon *P);
+int gsl_splinalg_precon_init(const gsl_spmatrix *A, gsl_splinalg_precon *P);
+int gsl_splinalg_precon_apply(const gsl_vector *r, gsl_vector *z,
+                              const gsl_splinalg_precon *P);
+int gsl_splinalg_precon_ssor_set_omega(gsl_splinalg_precon *P,
+                                       const double omega);
+
 gsl_splinalg_itersolve *
 gsl_splinalg_itersolve_alloc(const gsl_splinalg_itersolve_type *T,
                              const size_t n, const size_t m);
@@ -73,6 +198,59 @@ int gsl_splinalg_itersolve_iterate(const gsl_spmatrix *A,
                                    const double tol, gsl_vector *x,
                                    gsl_splinalg_itersolve *w);
 double gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w);
+int gsl_splinalg_itersolve_set_precon(gsl_splinalg_itersolve *w,
+                                      const gsl_splinalg_precon *P);
+
+/* fill-reducing ordering */
+int gsl_splinalg_mindeg(const gsl_spmatrix *A, gsl_permutation *perm);
+
+/* sparse direct solvers */
+gsl_splinalg_ldlt_workspace *gsl_splinalg_ldlt_alloc(const size_t n);
+void gsl_splinalg_ldlt_free(gsl_splinalg_ldlt_workspace *w);
+int gsl_splinalg_ldlt_symbolic(const gsl_spmatrix *A,
+                               gsl_splinalg_ldlt_workspace *w);
+int gsl_splinalg_ldlt_decomp(const gsl_spmatrix *A,
+                             gsl_splinalg_ldlt_workspace *w);
+int gsl_splinalg_ldlt_solve(const gsl_vector *b, gsl_vector *x,
+                            gsl_splinalg_ldlt_workspace *w);
+
+gsl_splinalg_lu_workspace *gsl_splinalg_lu_alloc(const size_t n);
+void gsl_splinalg_lu_free(gsl_splinalg_lu_workspace *w);
+int gsl_splinalg_lu_symbolic(const gsl_spmatrix *A,
+                             gsl_splinalg_lu_workspace *w);
+int gsl_splinalg_lu_decomp(const gsl_spmatrix *A,
+                           gsl_splinalg_lu_workspace *w);
+int gsl_splinalg_lu_solve(const gsl_vector *b, gsl_vector *x,
+                          gsl_splinalg_lu_workspace *w);
+
+/* sparse eigensolvers */
+gsl_splinalg_eigen_workspace *gsl_splinalg_eigen_alloc(const size_t n,
+                                                       const size_t nev,
+                                                       const size_t ncv);
+void gsl_splinalg_eigen_free(gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_params(const double tol, const size_t maxiter,
+                              gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_symm(const gsl_spmatrix *A,
+                            const gsl_splinalg_eigen_target_t target,
+                            const double sigma, gsl_vector *eval,
+                            gsl_matrix *evec,
+                            gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_symm_f(gsl_splinalg_eigen_function *F,
+                              const gsl_splinalg_eigen_target_t target,
+                              const double sigma, gsl_vector *eval,
+                              gsl_matrix *evec,
+                              gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_nonsymm(const gsl_spmatrix *A,
+                               const gsl_splinalg_eigen_target_t target,
+                               const double sigma, gsl_vector_complex *eval,
+                               gsl_matrix_complex *evec,
+                               gsl_splinalg_eigen_workspace *w);
+int gsl_splinalg_eigen_nonsymm_f(gsl_splinalg_eigen_function *F,
+                                 const gsl_splinalg_eigen_target_t target,
+                                 const double sigma,
+                                 gsl_vector_complex *eval,
+                                 gsl_matrix_complex *evec,
+                                 gsl_splinalg_eigen_workspace *w);
 
 __END_DECLS
 
@@ -0,0 +1,272 @@
+/* ic0.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "pccommon.c"
+
+/*
+ * Incomplete Cholesky preconditioner with no fill-in, M = L L^T,
+ * where L has the sparsity pattern of the lower triangle of the
+ * symmetric positive definite matrix A; see section 10.3 of
+ *
+ * [1] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of matrix */
+  gsl_spmatrix *R; /* factor L in CRS format */
+  double *dinv;    /* inverse diagonal 1 / L_{ii} */
+  size_t *w;       /* w[j] = index of L_{ij} in row i plus 1, or 0 */
+} ic0_state_t;
+
+static void ic0_free(void *vstate);
+
+static void *
+ic0_alloc(const size_t n)
+{
+  ic0_state_t *state;
+
+  state = calloc(1, sizeof(ic0_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ic0 state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->w = calloc(n, sizeof(size_t));
+  state->dinv = malloc(n * sizeof(double));
+  if (!state->w || !state->dinv)
+    {
+      ic0_free(state);
+      GSL_ERROR_NULL("failed to allocate ic0 workspace", GSL_ENOMEM);
+    }
+
+  return state;
+} /* ic0_alloc() */
+
+static void
+ic0_free(void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+
+  if (state->R)
+    gsl_spmatrix_free(state->R);
+
+  if (state->w)
+    free(state->w);
+
+  if (state->dinv)
+    free(state->dinv);
+
+  free(state);
+} /* ic0_free() */
+
+/*
+ic0_init()
+  Compute the incomplete Cholesky factorization of A
+
+Notes:
+1) Only the lower triangle of A is used. It is copied to CRS with
+sorted column indices, so the diagonal is the last entry of each row,
+and factored in place row by row:
+
+L_{ik} = (A_{ik} - sum_{j<k} L_{ij} L_{kj}) / L_{kk}
+L_{ii} = sqrt(A_{ii} - sum_{j<i} L_{ij}^2)
+
+where the sums run over the pattern; the positions of row i are
+scattered into w to find the common entries of rows i and k
+
+2) Returns GSL_EDOM if a pivot is not positive
+*/
+
+static int
+ic0_init(const gsl_spmatrix *A, void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+  const size_t n = state->n;
+  size_t *w = state->w;
+  size_t *Rp, *Ri;
+  double *Rd;
+  size_t i, p, q, nz = 0;
+  int status;
+
+  if (state->R)
+    gsl_spmatrix_free(state->R);
+
+  state->R = precon_crs(A);
+  if (state->R == NULL)
+    return GSL_ENOMEM;
+
+  Rp = state->R->p;
+  Ri = state->R->i;
+  Rd = state->R->data;
+
+  /* w holds the positions of the diagonal until the rows are compacted */
+  status = precon_diag(state->R, w);
+  if (status)
+    {
+      for (i = 0; i < n; ++i)
+        w[i] = 0;
+
+      gsl_spmatrix_free(state->R);
+      state->R = NULL;
+      return status;
+    }
+
+  /* keep the lower triangle, compacting the rows in place */
+  for (i = 0; i < n; ++i)
+    {
+      const size_t start = nz;
+
+      for (p = Rp[i]; p <= w[i]; ++p)
+        {
+          Ri[nz] = Ri[p];
+          Rd[nz] = Rd[p];
+          ++nz;
+        }
+
+      Rp[i] = start;
+      w[i] = 0;
+    }
+
+  Rp[n] = nz;
+  state->R->nz = nz;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (q = Rp[i]; q < Rp[i + 1]; ++q)
+        w[Ri[q]] = q + 1;
+
+      for (p = Rp[i]; p < Rp[i + 1]; ++p)
+        {
+          const size_t k = Ri[p];
+          double s = Rd[p];
+
+          /* entries j < k of row k */
+          for (q = Rp[k]; q < Rp[k + 1] - 1; ++q)
+            {
+              const size_t t = w[Ri[q]];
+
+              if (t)
+                s -= Rd[t - 1] * Rd[q];
+            }
+
+          if (k < i)
+            {
+              Rd[p] = s * state->dinv[k];
+            }
+          else if (s > 0.0)
+            {
+              Rd[p] = sqrt(s);
+              state->dinv[i] = 1.0 / Rd[p];
+            }
+          else
+            {
+              for (q = Rp[i]; q < Rp[i + 1]; ++q)
+                w[Ri[q]] = 0;
+
+              gsl_spmatrix_free(state->R);
+              state->R = NULL;
+              GSL_ERROR("matrix is not positive definite", GSL_EDOM);
+            }
+        }
+
+      for (q = Rp[i]; q < Rp[i + 1]; ++q)
+        w[Ri[q]] = 0;
+    }
+
+  return GSL_SUCCESS;
+} /* ic0_init() */
+
+/*
+ic0_apply()
+  Solve L y = r, then L^T z = y; the rows of L are the columns of
+L^T, so the second solve subtracts each z_i from the earlier entries
+as soon as it is known
+*/
+
+static int
+ic0_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  const ic0_state_t *state = (const ic0_state_t *) vstate;
+  const size_t n = state->n;
+  const double *dinv = state->dinv;
+  const size_t incr = r->stride;
+  const size_t incz = z->stride;
+  const double *rd = r->data;
+  double *zd = z->data;
+  const size_t *Rp, *Ri;
+  const double *Rd;
+  size_t i, p;
+
+  if (state->R == NULL)
+    {
+      GSL_ERROR("preconditioner has not been initialized", GSL_EINVAL);
+    }
+
+  Rp = state->R->p;
+  Ri = state->R->i;
+  Rd = state->R->data;
+
+  /* L y = r */
+  for (i = 0; i < n; ++i)
+    {
+      const size_t last = Rp[i + 1] - 1;
+      double s = rd[i * incr];
+
+      for (p = Rp[i]; p < last; ++p)
+        s -= Rd[p] * zd[Ri[p] * incz];
+
+      zd[i * incz] = s * dinv[i];
+    }
+
+  /* L^T z = y */
+  for (i = n; i-- > 0; )
+    {
+      const size_t last = Rp[i + 1] - 1;
+      const double zi = zd[i * incz] * dinv[i];
+
+      zd[i * incz] = zi;
+
+      for (p = Rp[i]; p < last; ++p)
+        zd[Ri[p] * incz] -= Rd[p] * zi;
+    }
+
+  return GSL_SUCCESS;
+} /* ic0_apply() */
+
+static const gsl_splinalg_precon_type ic0_type =
+{
+  "ic0",
+  &ic0_alloc,
+  &ic0_init,
+  &ic0_apply,
+  &ic0_free
+};
+
+const gsl_splinalg_precon_type * gsl_splinalg_precon_ic0 =
+  &ic0_type;
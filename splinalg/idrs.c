@@ -0,0 +1,512 @@
+/* idrs.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * The code in this module is based on the IDR(s) method
+ * described in
+ *
+ * [1] M. B. van Gijzen and P. Sonneveld, Algorithm 913: An elegant
+ *     IDR(s) variant that efficiently exploits biorthogonality
+ *     properties, ACM Trans. Math. Softw. 38(1), 2011.
+ */
+
+/* angle bound used in the choice of omega, from [1] */
+#define IDRS_ANGLE 0.7
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t s;        /* dimension of the shadow space */
+  size_t maxit;    /* maximum iterations per call */
+  gsl_matrix *P;   /* s-by-n, orthonormal shadow vectors p_i as rows */
+  gsl_matrix *G;   /* s-by-n, vectors g_k = A u_k as rows */
+  gsl_matrix *U;   /* s-by-n, vectors u_k as rows */
+  gsl_matrix *M;   /* s-by-s, M = P^T G, lower triangular */
+  gsl_vector *f;   /* f = P^T r */
+  gsl_vector *c;   /* coefficients of the new u_k and g_k */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *v;   /* work vectors */
+  gsl_vector *t;
+
+  double normr;    /* residual norm ||r|| */
+} idrs_state_t;
+
+static void idrs_free(void *vstate);
+static int idrs_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                        const double tol, const gsl_splinalg_precon *precon,
+                        gsl_vector *x, void *vstate);
+
+/*
+idrs_alloc()
+  Allocate an IDR(s) workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - dimension s of the shadow space; if this parameter is 0,
+            the value GSL_MIN(n,4) is used
+
+Return: pointer to workspace
+
+Notes: the shadow vectors are fixed pseudo-random vectors, made
+orthonormal with modified Gram-Schmidt, so that the results are
+reproducible
+*/
+
+static void *
+idrs_alloc(const size_t n, const size_t m)
+{
+  idrs_state_t *state;
+  unsigned long int seed = 1;
+  size_t i, j, k;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(idrs_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate idrs state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->s = (m == 0) ? GSL_MIN(n, 4) : GSL_MIN(n, m);
+
+  /* IDR(s) terminates after at most n + n/s matrix-vector products */
+  state->maxit = n + n / state->s;
+
+  state->P = gsl_matrix_alloc(state->s, n);
+  state->G = gsl_matrix_alloc(state->s, n);
+  state->U = gsl_matrix_alloc(state->s, n);
+  state->M = gsl_matrix_alloc(state->s, state->s);
+  if (!state->P || !state->G || !state->U || !state->M)
+    {
+      idrs_free(state);
+      GSL_ERROR_NULL("failed to allocate idrs matrices", GSL_ENOMEM);
+    }
+
+  state->f = gsl_vector_alloc(state->s);
+  state->c = gsl_vector_alloc(state->s);
+  state->r = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->t = gsl_vector_alloc(n);
+  if (!state->f || !state->c || !state->r || !state->v || !state->t)
+    {
+      idrs_free(state);
+      GSL_ERROR_NULL("failed to allocate idrs vectors", GSL_ENOMEM);
+    }
+
+  /* shadow vectors uniform in [-1/2,1/2), from a linear congruential
+   * sequence */
+  for (i = 0; i < state->s; ++i)
+    {
+      for (j = 0; j < n; ++j)
+        {
+          seed = (seed * 69069UL + 1UL) & 0xffffffffUL;
+          gsl_matrix_set(state->P, i, j, seed / 4294967296.0 - 0.5);
+        }
+    }
+
+  /* orthonormalize the rows of P */
+  for (i = 0; i < state->s; ++i)
+    {
+      gsl_vector_view pi = gsl_matrix_row(state->P, i);
+      double norm;
+
+      for (k = 0; k < i; ++k)
+        {
+          gsl_vector_view pk = gsl_matrix_row(state->P, k);
+          double d;
+
+          gsl_blas_ddot(&pk.vector, &pi.vector, &d);
+          gsl_blas_daxpy(-d, &pk.vector, &pi.vector);
+        }
+
+      norm = gsl_blas_dnrm2(&pi.vector);
+      gsl_vector_scale(&pi.vector, 1.0 / norm);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* idrs_alloc() */
+
+static void
+idrs_free(void *vstate)
+{
+  idrs_state_t *state = (idrs_state_t *) vstate;
+
+  if (state->P)
+    gsl_matrix_free(state->P);
+
+  if (state->G)
+    gsl_matrix_free(state->G);
+
+  if (state->U)
+    gsl_matrix_free(state->U);
+
+  if (state->M)
+    gsl_matrix_free(state->M);
+
+  if (state->f)
+    gsl_vector_free(state->f);
+
+  if (state->c)
+    gsl_vector_free(state->c);
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->t)
+    gsl_vector_free(state->t);
+
+  free(state);
+} /* idrs_free() */
+
+/*
+idrs_iterate()
+  Solve A*x = b using the IDR(s) method
+
+Inputs: A      - sparse square matrix
+        b      - right hand side vector
+        tol    - stopping tolerance (see below)
+        precon - preconditioner, or NULL
+        x      - (input/output) on input, initial estimate x_0;
+                 on output, solution vector
+        work   - workspace
+
+Return:
+GSL_SUCCESS if converged to solution (solution stored in x). In
+this case the following will be true:
+
+||b - A*x|| <= tol * ||b||
+
+GSL_CONTINUE if not yet converged; in this case x contains the
+most recent solution vector and calling this function more times
+with the input x restarts the method from x
+
+Notes:
+1) Based on algorithm 1 of (van Gijzen and Sonneveld, 2011 [1]),
+without residual smoothing. Each cycle makes
+s + 1 matrix-vector products, and the storage is 3s + 3 vectors of
+length n; the vectors u_k and g_k are biorthogonal to the shadow
+vectors, so M = P^T G is lower triangular
+
+2) One iteration is one matrix-vector product. Each call performs
+at most n + n/s iterations, after which IDR(s) terminates in
+exact arithmetic
+
+3) A preconditioner M is applied on the right, as in [1]: M^{-1} is
+applied to v in the new u_k and to r in the dimension reduction
+step, so r remains the residual of the original system
+
+4) The iteration stops on the recursively updated residual, and the
+true residual b - A*x is computed at the end
+
+5) On output, work->normr contains ||b - A*x||
+*/
+
+static int
+idrs_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+             const double tol, const gsl_splinalg_precon *precon,
+             gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  idrs_state_t *state = (idrs_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t s = state->s;
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      const size_t incx = x->stride;
+      double *xd = x->data;
+      double *r = state->r->data;
+      double *v = state->v->data;
+      double *t = state->t->data;
+      const double *z = (precon != NULL) ? v : r; /* M^{-1} r */
+      gsl_matrix *P = state->P;
+      gsl_matrix *G = state->G;
+      gsl_matrix *U = state->U;
+      gsl_matrix *M = state->M;
+      gsl_vector *f = state->f;
+      gsl_vector *c = state->c;
+      double omega = 1.0;
+      double normr;
+      size_t iter = 0;
+      size_t i, j, k;
+      int breakdown = 0;
+      int status;
+
+      /* r = b - A*x_0 */
+      gsl_vector_memcpy(state->r, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, state->r);
+      normr = gsl_blas_dnrm2(state->r);
+
+      gsl_matrix_set_zero(G);
+      gsl_matrix_set_zero(U);
+      gsl_matrix_set_identity(M);
+
+      while (normr > reltol && iter < state->maxit && !breakdown)
+        {
+          double ts = 0.0, tt = 0.0, normt, rho, normr2 = 0.0;
+
+          /* f = P^T r */
+          gsl_blas_dgemv(CblasNoTrans, 1.0, P, state->r, 0.0, f);
+
+          for (k = 0; k < s; ++k)
+            {
+              gsl_vector_view uk = gsl_matrix_row(U, k);
+              gsl_vector_view gk = gsl_matrix_row(G, k);
+              double *ud = uk.vector.data;
+              double *gd = gk.vector.data;
+              double mkk, beta;
+
+              /* solve M(k:s,k:s) c = f(k:s), lower triangular */
+              {
+                gsl_matrix_view Mk = gsl_matrix_submatrix(M, k, k, s - k, s - k);
+                gsl_vector_view ck = gsl_vector_subvector(c, k, s - k);
+                gsl_vector_const_view fk = gsl_vector_const_subvector(f, k, s - k);
+
+                gsl_vector_memcpy(&ck.vector, &fk.vector);
+                gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit,
+                               &Mk.matrix, &ck.vector);
+              }
+
+              /*
+               * v = r - G(k:s) c, and the new u_k = U(k:s) c +
+               * omega M^{-1} v, formed in t and then copied to row k of U
+               */
+              for (i = 0; i < N; ++i)
+                v[i] = r[i];
+
+              for (j = k; j < s; ++j)
+                {
+                  const double cj = gsl_vector_get(c, j);
+                  const double *gj = G->data + j * G->tda;
+
+                  for (i = 0; i < N; ++i)
+                    v[i] -= cj * gj[i];
+                }
+
+              if (precon != NULL)
+                {
+                  status = gsl_splinalg_precon_apply(state->v, state->t,
+                                                     precon);
+                  if (status)
+                    return status;
+
+                  for (i = 0; i < N; ++i)
+                    t[i] *= omega;
+                }
+              else
+                {
+                  for (i = 0; i < N; ++i)
+                    t[i] = omega * v[i];
+                }
+
+              for (j = k; j < s; ++j)
+                {
+                  const double cj = gsl_vector_get(c, j);
+                  const double *uj = U->data + j * U->tda;
+
+                  for (i = 0; i < N; ++i)
+                    t[i] += cj * uj[i];
+                }
+
+              gsl_vector_memcpy(&uk.vector, state->t);
+
+              /* g_k = A u_k */
+              gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &uk.vector, 0.0, &gk.vector);
+
+              /* make g_k orthogonal to p_i, i < k */
+              for (i = 0; i < k; ++i)
+                {
+                  gsl_vector_view pi = gsl_matrix_row(P, i);
+                  gsl_vector_view gi = gsl_matrix_row(G, i);
+                  gsl_vector_view ui = gsl_matrix_row(U, i);
+                  double alpha;
+
+                  gsl_blas_ddot(&pi.vector, &gk.vector, &alpha);
+                  alpha /= gsl_matrix_get(M, i, i);
+
+                  for (j = 0; j < N; ++j)
+                    {
+                      gd[j] -= alpha * gi.vector.data[j];
+                      ud[j] -= alpha * ui.vector.data[j];
+                    }
+                }
+
+              /* M(k:s,k) = P(k:s)^T g_k */
+              for (i = k; i < s; ++i)
+                {
+                  gsl_vector_view pi = gsl_matrix_row(P, i);
+                  double mik;
+
+                  gsl_blas_ddot(&pi.vector, &gk.vector, &mik);
+                  gsl_matrix_set(M, i, k, mik);
+                }
+
+              mkk = gsl_matrix_get(M, k, k);
+              if (mkk == 0.0)
+                {
+                  breakdown = 1;
+                  break;
+                }
+
+              /* r <- r - beta g_k, x <- x + beta u_k, ||r||^2 */
+              beta = gsl_vector_get(f, k) / mkk;
+              normr2 = 0.0;
+              for (i = 0; i < N; ++i)
+                {
+                  r[i] -= beta * gd[i];
+                  xd[i * incx] += beta * ud[i];
+                  normr2 += r[i] * r[i];
+                }
+
+              normr = sqrt(normr2);
+              ++iter;
+
+              if (normr <= reltol || iter >= state->maxit)
+                break;
+
+              /* f(k+1:s) <- f(k+1:s) - beta M(k+1:s,k) */
+              for (i = k + 1; i < s; ++i)
+                {
+                  double fi = gsl_vector_get(f, i);
+                  gsl_vector_set(f, i, fi - beta * gsl_matrix_get(M, i, k));
+                }
+            }
+
+          if (breakdown || normr <= reltol || iter >= state->maxit)
+            break;
+
+          /* dimension reduction step: t = A M^{-1} r */
+          if (precon != NULL)
+            {
+              status = gsl_splinalg_precon_apply(state->r, state->v, precon);
+              if (status)
+                return status;
+
+              gsl_spblas_dgemv(CblasNoTrans, 1.0, A, state->v, 0.0, state->t);
+            }
+          else
+            {
+              gsl_spblas_dgemv(CblasNoTrans, 1.0, A, state->r, 0.0, state->t);
+            }
+
+          for (i = 0; i < N; ++i)
+            {
+              ts += t[i] * r[i];
+              tt += t[i] * t[i];
+            }
+
+          if (tt == 0.0)
+            {
+              breakdown = 1;
+              break;
+            }
+
+          /* omega minimizes ||r - omega t||, kept away from zero */
+          normt = sqrt(tt);
+          omega = ts / tt;
+          rho = fabs(ts / (normt * normr));
+          if (rho < IDRS_ANGLE)
+            omega *= IDRS_ANGLE / rho;
+
+          if (omega == 0.0)
+            {
+              breakdown = 1;
+              break;
+            }
+
+          /* x <- x + omega M^{-1} r, r <- r - omega t, ||r||^2 */
+          normr2 = 0.0;
+          for (i = 0; i < N; ++i)
+            {
+              xd[i * incx] += omega * z[i];
+              r[i] -= omega * t[i];
+              normr2 += r[i] * r[i];
+            }
+
+          normr = sqrt(normr2);
+          ++iter;
+        }
+
+      /* compute true residual r = b - A*x */
+      gsl_vector_memcpy(state->r, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, state->r);
+      normr = gsl_blas_dnrm2(state->r);
+
+      /* store residual norm */
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;  /* converged */
+      else
+        return GSL_CONTINUE; /* not yet converged */
+    }
+} /* idrs_iterate() */
+
+static double
+idrs_normr(const void *vstate)
+{
+  const idrs_state_t *state = (const idrs_state_t *) vstate;
+  return state->normr;
+} /* idrs_normr() */
+
+static const gsl_splinalg_itersolve_type idrs_type =
+{
+  "idrs",
+  &idrs_alloc,
+  &idrs_iterate,
+  &idrs_normr,
+  &idrs_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_idrs =
+  &idrs_type;
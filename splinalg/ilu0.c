@@ -0,0 +1,238 @@
+/* ilu0.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "pccommon.c"
+
+/*
+ * Incomplete LU preconditioner with no fill-in, M = L U, where L
+ * and U have the sparsity pattern of the lower and upper triangles
+ * of A, based on algorithm 10.4 of
+ *
+ * [1] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of matrix */
+  gsl_spmatrix *R; /* factors L and U in CRS format, unit diagonal of L not stored */
+  size_t *diag;    /* diag[i] is the index of U_{ii} in R->data */
+  double *dinv;    /* inverse diagonal 1 / U_{ii} */
+  size_t *w;       /* w[j] = index of R_{ij} in row i plus 1, or 0 */
+} ilu0_state_t;
+
+static void ilu0_free(void *vstate);
+
+static void *
+ilu0_alloc(const size_t n)
+{
+  ilu0_state_t *state;
+
+  state = calloc(1, sizeof(ilu0_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ilu0 state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->diag = malloc(n * sizeof(size_t));
+  state->w = calloc(n, sizeof(size_t));
+  state->dinv = malloc(n * sizeof(double));
+  if (!state->diag || !state->w || !state->dinv)
+    {
+      ilu0_free(state);
+      GSL_ERROR_NULL("failed to allocate ilu0 workspace", GSL_ENOMEM);
+    }
+
+  return state;
+} /* ilu0_alloc() */
+
+static void
+ilu0_free(void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+
+  if (state->R)
+    gsl_spmatrix_free(state->R);
+
+  if (state->diag)
+    free(state->diag);
+
+  if (state->w)
+    free(state->w);
+
+  if (state->dinv)
+    free(state->dinv);
+
+  free(state);
+} /* ilu0_free() */
+
+/*
+ilu0_init()
+  Compute the incomplete LU factorization of A
+
+Notes:
+1) A is copied to CRS with sorted column indices and factored in
+place, row by row (IKJ variant). The positions of the entries of the
+current row are scattered into w, so that the update by each earlier
+row k touches only the entries in the pattern, in O(nnz of row k)
+
+2) Returns GSL_ESING on a zero pivot
+*/
+
+static int
+ilu0_init(const gsl_spmatrix *A, void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+  const size_t n = state->n;
+  size_t *diag = state->diag;
+  size_t *w = state->w;
+  size_t *Rp, *Ri;
+  double *Rd;
+  size_t i, p, q;
+  int status;
+
+  if (state->R)
+    gsl_spmatrix_free(state->R);
+
+  state->R = precon_crs(A);
+  if (state->R == NULL)
+    return GSL_ENOMEM;
+
+  status = precon_diag(state->R, diag);
+  if (status)
+    {
+      gsl_spmatrix_free(state->R);
+      state->R = NULL;
+      return status;
+    }
+
+  Rp = state->R->p;
+  Ri = state->R->i;
+  Rd = state->R->data;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (q = Rp[i]; q < Rp[i + 1]; ++q)
+        w[Ri[q]] = q + 1;
+
+      /* R_{ik} <- R_{ik} / U_{kk}, R_{ij} <- R_{ij} - R_{ik} U_{kj} */
+      for (p = Rp[i]; p < diag[i]; ++p)
+        {
+          const size_t k = Ri[p];
+          const double lik = Rd[p] * state->dinv[k];
+
+          Rd[p] = lik;
+
+          for (q = diag[k] + 1; q < Rp[k + 1]; ++q)
+            {
+              const size_t t = w[Ri[q]];
+
+              if (t)
+                Rd[t - 1] -= lik * Rd[q];
+            }
+        }
+
+      for (q = Rp[i]; q < Rp[i + 1]; ++q)
+        w[Ri[q]] = 0;
+
+      if (Rd[diag[i]] == 0.0)
+        {
+          gsl_spmatrix_free(state->R);
+          state->R = NULL;
+          GSL_ERROR("zero pivot in incomplete LU factorization", GSL_ESING);
+        }
+
+      state->dinv[i] = 1.0 / Rd[diag[i]];
+    }
+
+  return GSL_SUCCESS;
+} /* ilu0_init() */
+
+/*
+ilu0_apply()
+  Solve L U z = r by forward and back substitution
+*/
+
+static int
+ilu0_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  const ilu0_state_t *state = (const ilu0_state_t *) vstate;
+  const size_t n = state->n;
+  const size_t *diag = state->diag;
+  const double *dinv = state->dinv;
+  const size_t incr = r->stride;
+  const size_t incz = z->stride;
+  const double *rd = r->data;
+  double *zd = z->data;
+  const size_t *Rp, *Ri;
+  const double *Rd;
+  size_t i, p;
+
+  if (state->R == NULL)
+    {
+      GSL_ERROR("preconditioner has not been initialized", GSL_EINVAL);
+    }
+
+  Rp = state->R->p;
+  Ri = state->R->i;
+  Rd = state->R->data;
+
+  /* L y = r */
+  for (i = 0; i < n; ++i)
+    {
+      double s = rd[i * incr];
+
+      for (p = Rp[i]; p < diag[i]; ++p)
+        s -= Rd[p] * zd[Ri[p] * incz];
+
+      zd[i * incz] = s;
+    }
+
+  /* U z = y */
+  for (i = n; i-- > 0; )
+    {
+      double s = zd[i * incz];
+
+      for (p = diag[i] + 1; p < Rp[i + 1]; ++p)
+        s -= Rd[p] * zd[Ri[p] * incz];
+
+      zd[i * incz] = s * dinv[i];
+    }
+
+  return GSL_SUCCESS;
+} /* ilu0_apply() */
+
+static const gsl_splinalg_precon_type ilu0_type =
+{
+  "ilu0",
+  &ilu0_alloc,
+  &ilu0_init,
+  &ilu0_apply,
+  &ilu0_free
+};
+
+const gsl_splinalg_precon_type * gsl_splinalg_precon_ilu0 =
+  &ilu0_type;
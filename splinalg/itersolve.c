@@ -41,6 +41,7 @@ gsl_splinalg_itersolve_alloc(const gsl_splinalg_itersolve_type *T,
 
   w->type = T;
   w->normr = 0.0;
+  w->precon = NULL;
 
   w->state = w->type->alloc(n, m);
   if (w->state == NULL)
@@ -75,7 +76,7 @@ gsl_splinalg_itersolve_iterate(const gsl_spmatrix *A, const gsl_vector *b,
                                const double tol, gsl_vector *x,
                                gsl_splinalg_itersolve *w)
 {
-  int status = w->type->iterate(A, b, tol, x, w->state);
+  int status = w->type->iterate(A, b, tol, w->precon, x, w->state);
 
   /* store current residual */
   w->normr = w->type->normr(w->state);
@@ -88,3 +89,19 @@ gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w)
 {
   return w->normr;
 }
+
+/*
+gsl_splinalg_itersolve_set_precon()
+  Attach a preconditioner to the solver; the preconditioner must
+have been initialized with gsl_splinalg_precon_init() for the matrix
+given to the iterate function, and must remain allocated while it is
+in use. Setting P = NULL removes the preconditioner.
+*/
+
+int
+gsl_splinalg_itersolve_set_precon(gsl_splinalg_itersolve *w,
+                                  const gsl_splinalg_precon *P)
+{
+  w->precon = P;
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,143 @@
+/* jacobi.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Jacobi (diagonal) preconditioner M = diag(A)
+ */
+
+typedef struct
+{
+  size_t n;        /* size of matrix */
+  double *dinv;    /* inverse diagonal elements 1 / A_{ii} */
+} jacobi_state_t;
+
+static void *
+jacobi_alloc(const size_t n)
+{
+  jacobi_state_t *state;
+
+  state = calloc(1, sizeof(jacobi_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate jacobi state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->dinv = calloc(n, sizeof(double));
+  if (!state->dinv)
+    {
+      free(state);
+      GSL_ERROR_NULL("failed to allocate jacobi diagonal", GSL_ENOMEM);
+    }
+
+  return state;
+} /* jacobi_alloc() */
+
+static void
+jacobi_free(void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+
+  if (state->dinv)
+    free(state->dinv);
+
+  free(state);
+} /* jacobi_free() */
+
+/*
+jacobi_init()
+  Store the inverse diagonal of A. The diagonal is read directly
+from the storage of any format, summing duplicate triplets
+*/
+
+static int
+jacobi_init(const gsl_spmatrix *A, void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+  const size_t n = state->n;
+  double *d = state->dinv;
+  size_t i, j, p;
+
+  for (i = 0; i < n; ++i)
+    d[i] = 0.0;
+
+  if (GSL_SPMATRIX_ISTRIPLET(A))
+    {
+      for (p = 0; p < A->nz; ++p)
+        {
+          if (A->i[p] == A->p[p])
+            d[A->i[p]] += A->data[p];
+        }
+    }
+  else
+    {
+      for (j = 0; j < n; ++j)
+        {
+          for (p = A->p[j]; p < A->p[j + 1]; ++p)
+            {
+              if (A->i[p] == j)
+                d[j] += A->data[p];
+            }
+        }
+    }
+
+  for (i = 0; i < n; ++i)
+    {
+      if (d[i] == 0.0)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_ESING);
+        }
+
+      d[i] = 1.0 / d[i];
+    }
+
+  return GSL_SUCCESS;
+} /* jacobi_init() */
+
+static int
+jacobi_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  const jacobi_state_t *state = (const jacobi_state_t *) vstate;
+  const size_t n = state->n;
+  const double *d = state->dinv;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    z->data[i * z->stride] = d[i] * r->data[i * r->stride];
+
+  return GSL_SUCCESS;
+} /* jacobi_apply() */
+
+static const gsl_splinalg_precon_type jacobi_type =
+{
+  "jacobi",
+  &jacobi_alloc,
+  &jacobi_init,
+  &jacobi_apply,
+  &jacobi_free
+};
+
+const gsl_splinalg_precon_type * gsl_splinalg_precon_jacobi =
+  &jacobi_type;
@@ -0,0 +1,581 @@
+/* ldlt.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Sparse LDL^T factorization of a symmetric matrix, P A P^T = L D L^T,
+ * by the up-looking method: row k of L is found by a sparse triangular
+ * solve whose pattern is a subtree of the elimination tree. See
+ *
+ * [1] T. A. Davis, Algorithm 849: A concise sparse Cholesky
+ *     factorization package, ACM Trans. Math. Softw. 31(4), 2005.
+ */
+
+#define LDLT_NONE ((size_t) -1)
+
+static int ldlt_permute(const gsl_spmatrix *A,
+                        gsl_splinalg_ldlt_workspace *w);
+static int ldlt_factor(gsl_splinalg_ldlt_workspace *w);
+
+gsl_splinalg_ldlt_workspace *
+gsl_splinalg_ldlt_alloc(const size_t n)
+{
+  gsl_splinalg_ldlt_workspace *w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_ldlt_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for ldlt workspace",
+                     GSL_ENOMEM);
+    }
+
+  w->n = n;
+
+  w->perm = gsl_permutation_alloc(n);
+  w->D = gsl_vector_alloc(n);
+  w->pinv = malloc(n * sizeof(size_t));
+  w->parent = malloc(n * sizeof(size_t));
+  w->Lnz = malloc(n * sizeof(size_t));
+  w->flag = malloc(n * sizeof(size_t));
+  w->pattern = malloc(n * sizeof(size_t));
+  w->y = calloc(n, sizeof(double));
+  if (!w->perm || !w->D || !w->pinv || !w->parent || !w->Lnz ||
+      !w->flag || !w->pattern || !w->y)
+    {
+      gsl_splinalg_ldlt_free(w);
+      GSL_ERROR_NULL("failed to allocate space for ldlt workspace",
+                     GSL_ENOMEM);
+    }
+
+  return w;
+} /* gsl_splinalg_ldlt_alloc() */
+
+void
+gsl_splinalg_ldlt_free(gsl_splinalg_ldlt_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->perm)
+    gsl_permutation_free(w->perm);
+
+  if (w->D)
+    gsl_vector_free(w->D);
+
+  if (w->C)
+    gsl_spmatrix_free(w->C);
+
+  if (w->L)
+    gsl_spmatrix_free(w->L);
+
+  free(w->pinv);
+  free(w->parent);
+  free(w->Lnz);
+  free(w->flag);
+  free(w->pattern);
+  free(w->y);
+  free(w);
+} /* gsl_splinalg_ldlt_free() */
+
+/*
+gsl_splinalg_ldlt_symbolic()
+  Symbolic analysis of a symmetric matrix: compute a fill-reducing
+ordering, the elimination tree and the column counts of L, and
+allocate L
+
+Inputs: A - symmetric sparse matrix, in any format; only the lower
+            triangle is referenced
+        w - workspace
+
+Return: success or error
+
+Notes:
+1) The ordering is gsl_splinalg_mindeg()
+
+2) The elimination tree and the column counts are found from the
+upper triangle C of P A P^T: for each column k of C, the path from
+each entry i < k up the tree to a node already visited for k is the
+pattern of row k of L, and each node on it gains an entry (Davis, 2005
+[1]). This costs O(nnz(L))
+
+3) The analysis depends only on the pattern of A, and is reused by
+every call to gsl_splinalg_ldlt_decomp() for matrices of that pattern
+*/
+
+int
+gsl_splinalg_ldlt_symbolic(const gsl_spmatrix *A,
+                           gsl_splinalg_ldlt_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t *parent = w->parent;
+      size_t *Lnz = w->Lnz;
+      size_t *flag = w->flag;
+      size_t *Cp, *Ci;
+      size_t i, k, p, lnz;
+      int status;
+
+      w->symbolic = 0;
+      w->factored = 0;
+
+      status = gsl_splinalg_mindeg(A, w->perm);
+      if (status)
+        return status;
+
+      for (k = 0; k < n; ++k)
+        w->pinv[w->perm->data[k]] = k;
+
+      status = ldlt_permute(A, w);
+      if (status)
+        return status;
+
+      Cp = w->C->p;
+      Ci = w->C->i;
+
+      /* elimination tree and column counts of L */
+      for (k = 0; k < n; ++k)
+        {
+          parent[k] = LDLT_NONE;
+          flag[k] = k;
+          Lnz[k] = 0;
+
+          for (p = Cp[k]; p < Cp[k + 1]; ++p)
+            {
+              for (i = Ci[p]; flag[i] != k; i = parent[i])
+                {
+                  if (parent[i] == LDLT_NONE)
+                    parent[i] = k;
+
+                  ++Lnz[i];
+                  flag[i] = k;
+                }
+            }
+        }
+
+      for (lnz = 0, k = 0; k < n; ++k)
+        lnz += Lnz[k];
+
+      /* allocate L */
+      if (w->L == NULL)
+        {
+          w->L = gsl_spmatrix_alloc_nzmax(n, n, GSL_MAX(lnz, 1),
+                                          GSL_SPMATRIX_CCS);
+          if (w->L == NULL)
+            {
+              GSL_ERROR("failed to allocate space for L", GSL_ENOMEM);
+            }
+        }
+      else if (w->L->nzmax < lnz)
+        {
+          w->L->nz = 0;
+          status = gsl_spmatrix_realloc(lnz, w->L);
+          if (status)
+            return status;
+        }
+
+      w->L->p[0] = 0;
+      for (k = 0; k < n; ++k)
+        w->L->p[k + 1] = w->L->p[k] + Lnz[k];
+
+      w->L->nz = 0;
+      w->symbolic = 1;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_ldlt_symbolic() */
+
+/*
+gsl_splinalg_ldlt_decomp()
+  Numerical factorization P A P^T = L D L^T
+
+Inputs: A - symmetric sparse matrix with the pattern given to
+            gsl_splinalg_ldlt_symbolic(); only the lower triangle is
+            referenced
+        w - workspace
+
+Return: success or error
+
+Notes:
+1) No pivoting is done, so A need not be positive definite, but a
+zero pivot gives GSL_ESING
+
+2) A matrix with entries outside the analysed pattern gives GSL_EINVAL
+*/
+
+int
+gsl_splinalg_ldlt_decomp(const gsl_spmatrix *A,
+                         gsl_splinalg_ldlt_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else if (!w->symbolic)
+    {
+      GSL_ERROR("symbolic analysis has not been done", GSL_EINVAL);
+    }
+  else
+    {
+      size_t k;
+      int status;
+
+      w->factored = 0;
+
+      status = ldlt_permute(A, w);
+      if (status)
+        return status;
+
+      status = ldlt_factor(w);
+      if (status == GSL_SUCCESS)
+        {
+          w->L->nz = w->L->p[n];
+          w->factored = 1;
+          return GSL_SUCCESS;
+        }
+
+      /* leave y zero for the next call */
+      for (k = 0; k < n; ++k)
+        w->y[k] = 0.0;
+
+      w->L->nz = 0;
+
+      if (status == GSL_ESING)
+        {
+          GSL_ERROR("matrix is singular", GSL_ESING);
+        }
+      else
+        {
+          GSL_ERROR("matrix pattern differs from symbolic analysis",
+                    GSL_EINVAL);
+        }
+    }
+} /* gsl_splinalg_ldlt_decomp() */
+
+/*
+gsl_splinalg_ldlt_solve()
+  Solve A x = b using the factorization P A P^T = L D L^T
+
+Inputs: b - right hand side
+        x - (output) solution vector; may be the same as b
+        w - workspace holding the factorization
+*/
+
+int
+gsl_splinalg_ldlt_solve(const gsl_vector *b, gsl_vector *x,
+                        gsl_splinalg_ldlt_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (b->size != n)
+    {
+      GSL_ERROR("right hand side does not match workspace", GSL_EBADLEN);
+    }
+  else if (x->size != n)
+    {
+      GSL_ERROR("solution vector does not match workspace", GSL_EBADLEN);
+    }
+  else if (!w->factored)
+    {
+      GSL_ERROR("matrix has not been factored", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t *perm = w->perm->data;
+      const size_t *Lp = w->L->p;
+      const size_t *Li = w->L->i;
+      const double *Lx = w->L->data;
+      const double *D = w->D->data;
+      double *y = w->y;
+      size_t j, p;
+
+      /* y = P b */
+      for (j = 0; j < n; ++j)
+        y[j] = gsl_vector_get(b, perm[j]);
+
+      /* y <- L^{-1} y */
+      for (j = 0; j < n; ++j)
+        {
+          const double yj = y[j];
+
+          for (p = Lp[j]; p < Lp[j + 1]; ++p)
+            y[Li[p]] -= Lx[p] * yj;
+        }
+
+      /* y <- D^{-1} y */
+      for (j = 0; j < n; ++j)
+        y[j] /= D[j];
+
+      /* y <- L^{-T} y */
+      for (j = n; j-- > 0; )
+        {
+          double yj = y[j];
+
+          for (p = Lp[j]; p < Lp[j + 1]; ++p)
+            yj -= Lx[p] * y[Li[p]];
+
+          y[j] = yj;
+        }
+
+      /* x = P^T y */
+      for (j = 0; j < n; ++j)
+        {
+          gsl_vector_set(x, perm[j], y[j]);
+          y[j] = 0.0;
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_ldlt_solve() */
+
+/*
+ldlt_factor()
+  Compute L and D from the upper triangle C of P A P^T
+
+Return: GSL_SUCCESS, GSL_ESING on a zero pivot, or GSL_EINVAL if C
+has entries outside the analysed pattern
+
+Notes: row k of L solves L(0:k-1,0:k-1) D(0:k-1) l_k = C(0:k-1,k).
+The entries of column k of C are scattered into y, and the pattern of
+the solve is found by walking up the elimination tree from each of
+them, giving the rows in topological order. Each column i of L on the
+pattern then updates y and receives its entry in row k, so the columns
+of L are filled top to bottom (Davis, 2005 [1]). On success y is left
+zero
+*/
+
+static int
+ldlt_factor(gsl_splinalg_ldlt_workspace *w)
+{
+  const size_t n = w->n;
+  const size_t *parent = w->parent;
+  const size_t *Lp = w->L->p;
+  const size_t *Cp = w->C->p;
+  const size_t *Ci = w->C->i;
+  const double *Cx = w->C->data;
+  size_t *Li = w->L->i;
+  double *Lx = w->L->data;
+  size_t *Lnz = w->Lnz;
+  size_t *flag = w->flag;
+  size_t *pattern = w->pattern;
+  double *y = w->y;
+  double *D = w->D->data;
+  size_t i, k, p, top, len;
+
+  for (k = 0; k < n; ++k)
+    Lnz[k] = 0;
+
+  for (k = 0; k < n; ++k)
+    {
+      /* scatter C(:,k) into y, and find the pattern of row k of L */
+      top = n;
+      flag[k] = k;
+
+      for (p = Cp[k]; p < Cp[k + 1]; ++p)
+        {
+          i = Ci[p];
+          y[i] += Cx[p];
+
+          for (len = 0; flag[i] != k; i = parent[i])
+            {
+              /* the path must reach k */
+              if (parent[i] == LDLT_NONE)
+                return GSL_EINVAL;
+
+              pattern[len++] = i;
+              flag[i] = k;
+            }
+
+          while (len > 0)
+            pattern[--top] = pattern[--len];
+        }
+
+      D[k] = y[k];
+      y[k] = 0.0;
+
+      for (; top < n; ++top)
+        {
+          const double yi = y[pattern[top]];
+          double lki;
+
+          i = pattern[top];
+          y[i] = 0.0;
+
+          for (p = Lp[i]; p < Lp[i] + Lnz[i]; ++p)
+            y[Li[p]] -= Lx[p] * yi;
+
+          /* column i is full */
+          if (p == Lp[i + 1])
+            return GSL_EINVAL;
+
+          lki = yi / D[i];
+          D[k] -= lki * yi;
+          Li[p] = k;
+          Lx[p] = lki;
+          ++Lnz[i];
+        }
+
+      if (D[k] == 0.0)
+        return GSL_ESING;
+    }
+
+  return GSL_SUCCESS;
+} /* ldlt_factor() */
+
+/*
+ldlt_permute()
+  Form the upper triangle C of P A P^T in CCS format from the lower
+triangle of A, in any format; the entry A(i,j), i >= j, goes to
+C(min(pinv[i],pinv[j]), max(pinv[i],pinv[j])). Duplicate entries are
+kept, and summed by the numerical factorization
+*/
+
+static int
+ldlt_permute(const gsl_spmatrix *A, gsl_splinalg_ldlt_workspace *w)
+{
+  const size_t n = w->n;
+  const size_t *pinv = w->pinv;
+  size_t *cnt = w->pattern;
+  size_t *Cp, *Ci;
+  double *Cx;
+  size_t i, j, k, p, nz = 0;
+  int pass;
+
+  /* count the entries of each column of C, then scatter them */
+  for (pass = 0; pass < 2; ++pass)
+    {
+      if (pass == 1)
+        {
+          if (w->C == NULL)
+            {
+              w->C = gsl_spmatrix_alloc_nzmax(n, n, GSL_MAX(nz, 1),
+                                              GSL_SPMATRIX_CCS);
+              if (w->C == NULL)
+                {
+                  GSL_ERROR("failed to allocate space for C", GSL_ENOMEM);
+                }
+            }
+          else if (w->C->nzmax < nz)
+            {
+              int status;
+
+              w->C->nz = 0;
+              status = gsl_spmatrix_realloc(nz, w->C);
+              if (status)
+                return status;
+            }
+
+          Cp = w->C->p;
+          Ci = w->C->i;
+          Cx = w->C->data;
+
+          /* cnt[k] = next free position in column k */
+          Cp[0] = 0;
+          for (k = 0; k < n; ++k)
+            {
+              Cp[k + 1] = Cp[k] + cnt[k];
+              cnt[k] = Cp[k];
+            }
+
+          w->C->nz = nz;
+        }
+      else
+        {
+          for (k = 0; k < n; ++k)
+            cnt[k] = 0;
+        }
+
+#define LDLT_ENTRY(row, col, val)                               \
+      if ((row) >= (col))                                       \
+        {                                                       \
+          const size_t a = pinv[row], b = pinv[col];            \
+          const size_t c = GSL_MAX(a, b);                       \
+          if (pass == 0)                                        \
+            {                                                   \
+              ++cnt[c];                                         \
+              ++nz;                                             \
+            }                                                   \
+          else                                                  \
+            {                                                   \
+              Ci[cnt[c]] = GSL_MIN(a, b);                       \
+              Cx[cnt[c]++] = (val);                             \
+            }                                                   \
+        }
+
+      if (GSL_SPMATRIX_ISTRIPLET(A))
+        {
+          for (p = 0; p < A->nz; ++p)
+            {
+              LDLT_ENTRY(A->i[p], A->p[p], A->data[p]);
+            }
+        }
+      else if (GSL_SPMATRIX_ISCCS(A))
+        {
+          for (j = 0; j < n; ++j)
+            {
+              for (p = A->p[j]; p < A->p[j + 1]; ++p)
+                {
+                  i = A->i[p];
+                  LDLT_ENTRY(i, j, A->data[p]);
+                }
+            }
+        }
+      else
+        {
+          for (i = 0; i < n; ++i)
+            {
+              for (p = A->p[i]; p < A->p[i + 1]; ++p)
+                {
+                  j = A->i[p];
+                  LDLT_ENTRY(i, j, A->data[p]);
+                }
+            }
+        }
+
+#undef LDLT_ENTRY
+    }
+
+  return GSL_SUCCESS;
+} /* ldlt_permute() */
@@ -0,0 +1,610 @@
+/* lu.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Sparse LU factorization P A Q = L U by the left-looking method of
+ * Gilbert and Peierls: column k of L and U is found by a sparse
+ * triangular solve with the columns of L already computed, whose
+ * pattern is found by a depth-first search. See
+ *
+ * [1] J. R. Gilbert and T. Peierls, Sparse partial pivoting in time
+ *     proportional to arithmetic operations, SIAM J. Sci. Stat.
+ *     Comput. 9(5), 1988.
+ *
+ * [2] T. A. Davis, Direct methods for sparse linear systems, SIAM,
+ *     2006, chapter 6.
+ */
+
+#define LU_NONE ((size_t) -1)
+
+/* the diagonal is the pivot when |a_kk| >= LU_PIVOT_TOL * max |a_ik| */
+#define LU_PIVOT_TOL 0.1
+
+static int lu_ccs(const gsl_spmatrix *A, gsl_spmatrix *C);
+static int lu_grow(gsl_spmatrix *M, const size_t nz);
+static size_t lu_reach(const size_t n, const gsl_spmatrix *C,
+                       const size_t col, const gsl_spmatrix *L,
+                       const size_t *pinv, const size_t stamp,
+                       gsl_splinalg_lu_workspace *w);
+
+gsl_splinalg_lu_workspace *
+gsl_splinalg_lu_alloc(const size_t n)
+{
+  gsl_splinalg_lu_workspace *w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_lu_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for lu workspace",
+                     GSL_ENOMEM);
+    }
+
+  w->n = n;
+
+  w->q = gsl_permutation_alloc(n);
+  w->pinv = malloc(n * sizeof(size_t));
+  w->x = calloc(n, sizeof(double));
+  w->xi = malloc(n * sizeof(size_t));
+  w->stack = malloc(n * sizeof(size_t));
+  w->pstack = malloc(n * sizeof(size_t));
+  w->mark = calloc(n, sizeof(size_t));
+  if (!w->q || !w->pinv || !w->x || !w->xi || !w->stack ||
+      !w->pstack || !w->mark)
+    {
+      gsl_splinalg_lu_free(w);
+      GSL_ERROR_NULL("failed to allocate space for lu workspace",
+                     GSL_ENOMEM);
+    }
+
+  return w;
+} /* gsl_splinalg_lu_alloc() */
+
+void
+gsl_splinalg_lu_free(gsl_splinalg_lu_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->q)
+    gsl_permutation_free(w->q);
+
+  if (w->C)
+    gsl_spmatrix_free(w->C);
+
+  if (w->L)
+    gsl_spmatrix_free(w->L);
+
+  if (w->U)
+    gsl_spmatrix_free(w->U);
+
+  free(w->pinv);
+  free(w->x);
+  free(w->xi);
+  free(w->stack);
+  free(w->pstack);
+  free(w->mark);
+  free(w);
+} /* gsl_splinalg_lu_free() */
+
+/*
+gsl_splinalg_lu_symbolic()
+  Symbolic analysis of a square matrix: compute the column ordering
+Q and allocate the factors
+
+Inputs: A - square sparse matrix, in any format
+        w - workspace
+
+Return: success or error
+
+Notes:
+1) Q is the minimum degree ordering of A + A^T from
+gsl_splinalg_mindeg(), which suits matrices whose pattern is nearly
+symmetric, such as those from meshes; the row ordering P is chosen
+during the numerical factorization
+
+2) The factors are allocated with room for nnz(A) + n entries each,
+and grow as needed; the space is kept for later factorizations
+*/
+
+int
+gsl_splinalg_lu_symbolic(const gsl_spmatrix *A,
+                         gsl_splinalg_lu_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nzmax = A->nz + n;
+      int status;
+
+      w->symbolic = 0;
+      w->factored = 0;
+
+      status = gsl_splinalg_mindeg(A, w->q);
+      if (status)
+        return status;
+
+      if (w->L == NULL)
+        w->L = gsl_spmatrix_alloc_nzmax(n, n, nzmax, GSL_SPMATRIX_CCS);
+
+      if (w->U == NULL)
+        w->U = gsl_spmatrix_alloc_nzmax(n, n, nzmax, GSL_SPMATRIX_CCS);
+
+      if (w->C == NULL)
+        w->C = gsl_spmatrix_alloc_nzmax(n, n, GSL_MAX(A->nz, 1),
+                                        GSL_SPMATRIX_CCS);
+
+      if (w->L == NULL || w->U == NULL || w->C == NULL)
+        {
+          GSL_ERROR("failed to allocate space for factors", GSL_ENOMEM);
+        }
+
+      w->symbolic = 1;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_lu_symbolic() */
+
+/*
+gsl_splinalg_lu_decomp()
+  Numerical factorization P A Q = L U
+
+Inputs: A - square sparse matrix, in any format
+        w - workspace, after gsl_splinalg_lu_symbolic()
+
+Return: success or error
+
+Notes:
+1) For column k, x = L \ A(:,q_k) is computed by a sparse triangular
+solve. Its pattern is the set of rows reachable from the pattern of
+A(:,q_k) in the graph of L, found by a depth-first search which
+gives them in topological order (Gilbert and Peierls, 1988 [1]). The
+cost of each column is proportional to its flop count
+
+2) The pivot is the entry of largest magnitude among the rows of x
+not yet pivotal, except that row q_k (the diagonal of the symmetric
+ordering) is kept when it is within a factor LU_PIVOT_TOL of the
+largest, which preserves the sparsity given by the ordering
+
+3) L has a unit diagonal, stored as the first entry of each column,
+and U has its diagonal as the last entry of each column. While
+factoring, the row indices of L are rows of A; they are renumbered
+by P at the end
+
+4) Returns GSL_ESING if a column has no nonzero candidate pivot
+*/
+
+int
+gsl_splinalg_lu_decomp(const gsl_spmatrix *A,
+                       gsl_splinalg_lu_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else if (!w->symbolic)
+    {
+      GSL_ERROR("symbolic analysis has not been done", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t *q = w->q->data;
+      size_t *pinv = w->pinv;
+      size_t *xi = w->xi;
+      double *x = w->x;
+      gsl_spmatrix *C = w->C;
+      gsl_spmatrix *L = w->L;
+      gsl_spmatrix *U = w->U;
+      size_t lnz = 0, unz = 0;
+      size_t i, k, p, t, top;
+      int status;
+
+      w->factored = 0;
+
+      status = lu_ccs(A, C);
+      if (status)
+        return status;
+
+      for (i = 0; i < n; ++i)
+        {
+          pinv[i] = LU_NONE;
+          w->mark[i] = 0;
+        }
+
+      for (k = 0; k < n; ++k)
+        {
+          const size_t col = q[k];
+          size_t ipiv = LU_NONE;
+          double amax = 0.0, pivot;
+
+          /* room for a full column in L and U */
+          L->nz = lnz;
+          U->nz = unz;
+          status = lu_grow(L, lnz + n - k);
+          if (!status)
+            status = lu_grow(U, unz + k + 1);
+          if (status)
+            return status;
+
+          L->p[k] = lnz;
+          U->p[k] = unz;
+
+          /* x = L \ A(:,col), on the pattern xi[top..n-1] */
+          top = lu_reach(n, C, col, L, pinv, k + 1, w);
+
+          for (p = C->p[col]; p < C->p[col + 1]; ++p)
+            x[C->i[p]] += C->data[p];
+
+          for (t = top; t < n; ++t)
+            {
+              const size_t j = pinv[xi[t]];
+              double xj;
+
+              if (j == LU_NONE)
+                continue;
+
+              xj = x[xi[t]];
+              for (p = L->p[j] + 1; p < L->p[j + 1]; ++p)
+                x[L->i[p]] -= L->data[p] * xj;
+            }
+
+          /* U(:,k) gets the pivotal rows; find the pivot among the others */
+          for (t = top; t < n; ++t)
+            {
+              i = xi[t];
+
+              if (pinv[i] == LU_NONE)
+                {
+                  const double a = fabs(x[i]);
+
+                  if (a > amax)
+                    {
+                      amax = a;
+                      ipiv = i;
+                    }
+                }
+              else
+                {
+                  U->i[unz] = pinv[i];
+                  U->data[unz++] = x[i];
+                }
+            }
+
+          if (ipiv == LU_NONE)
+            {
+              for (t = top; t < n; ++t)
+                x[xi[t]] = 0.0;
+
+              GSL_ERROR("matrix is singular", GSL_ESING);
+            }
+
+          if (pinv[col] == LU_NONE && fabs(x[col]) >= LU_PIVOT_TOL * amax)
+            ipiv = col;
+
+          pivot = x[ipiv];
+          U->i[unz] = k;
+          U->data[unz++] = pivot;
+
+          pinv[ipiv] = k;
+          L->i[lnz] = ipiv;
+          L->data[lnz++] = 1.0;
+
+          for (t = top; t < n; ++t)
+            {
+              i = xi[t];
+
+              if (pinv[i] == LU_NONE)
+                {
+                  L->i[lnz] = i;
+                  L->data[lnz++] = x[i] / pivot;
+                }
+
+              x[i] = 0.0;
+            }
+        }
+
+      L->p[n] = lnz;
+      U->p[n] = unz;
+      L->nz = lnz;
+      U->nz = unz;
+
+      /* renumber the rows of L by P */
+      for (p = 0; p < lnz; ++p)
+        L->i[p] = pinv[L->i[p]];
+
+      w->factored = 1;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_lu_decomp() */
+
+/*
+gsl_splinalg_lu_solve()
+  Solve A x = b using the factorization P A Q = L U
+
+Inputs: b - right hand side
+        x - (output) solution vector; may be the same as b
+        w - workspace holding the factorization
+*/
+
+int
+gsl_splinalg_lu_solve(const gsl_vector *b, gsl_vector *x,
+                      gsl_splinalg_lu_workspace *w)
+{
+  const size_t n = w->n;
+
+  if (b->size != n)
+    {
+      GSL_ERROR("right hand side does not match workspace", GSL_EBADLEN);
+    }
+  else if (x->size != n)
+    {
+      GSL_ERROR("solution vector does not match workspace", GSL_EBADLEN);
+    }
+  else if (!w->factored)
+    {
+      GSL_ERROR("matrix has not been factored", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t *q = w->q->data;
+      const size_t *pinv = w->pinv;
+      const size_t *Lp = w->L->p;
+      const size_t *Li = w->L->i;
+      const double *Lx = w->L->data;
+      const size_t *Up = w->U->p;
+      const size_t *Ui = w->U->i;
+      const double *Ux = w->U->data;
+      double *y = w->x;
+      size_t i, j, p;
+
+      /* y = P b */
+      for (i = 0; i < n; ++i)
+        y[pinv[i]] = gsl_vector_get(b, i);
+
+      /* y <- L^{-1} y */
+      for (j = 0; j < n; ++j)
+        {
+          const double yj = y[j];
+
+          for (p = Lp[j] + 1; p < Lp[j + 1]; ++p)
+            y[Li[p]] -= Lx[p] * yj;
+        }
+
+      /* y <- U^{-1} y */
+      for (j = n; j-- > 0; )
+        {
+          const double yj = y[j] / Ux[Up[j + 1] - 1];
+
+          y[j] = yj;
+          for (p = Up[j]; p < Up[j + 1] - 1; ++p)
+            y[Ui[p]] -= Ux[p] * yj;
+        }
+
+      /* x = Q y */
+      for (j = 0; j < n; ++j)
+        {
+          gsl_vector_set(x, q[j], y[j]);
+          y[j] = 0.0;
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_lu_solve() */
+
+/*
+lu_reach()
+  Find the rows reachable from the pattern of C(:,col) in the graph
+of L, in which row i has edges to the rows of column pinv[i] of L
+when it is pivotal. The search is iterative, with the path in
+w->stack and the position in each adjacency list in w->pstack
+
+Return: top, such that w->xi[top..n-1] holds the rows in topological
+order; the rows visited are marked with stamp
+*/
+
+static size_t
+lu_reach(const size_t n, const gsl_spmatrix *C, const size_t col,
+         const gsl_spmatrix *L, const size_t *pinv, const size_t stamp,
+         gsl_splinalg_lu_workspace *w)
+{
+  size_t *xi = w->xi;
+  size_t *stack = w->stack;
+  size_t *pstack = w->pstack;
+  size_t *mark = w->mark;
+  size_t top = n;
+  size_t p;
+
+  for (p = C->p[col]; p < C->p[col + 1]; ++p)
+    {
+      size_t depth;
+
+      if (mark[C->i[p]] == stamp)
+        continue;
+
+      stack[0] = C->i[p];
+      depth = 1;
+
+      while (depth > 0)
+        {
+          const size_t r = stack[depth - 1];
+          const size_t j = pinv[r];
+          int done = 1;
+
+          if (mark[r] != stamp)
+            {
+              /* first visit; skip the unit diagonal of L(:,j) */
+              mark[r] = stamp;
+              pstack[depth - 1] = (j == LU_NONE) ? 0 : L->p[j] + 1;
+            }
+
+          if (j != LU_NONE)
+            {
+              size_t s;
+
+              for (s = pstack[depth - 1]; s < L->p[j + 1]; ++s)
+                {
+                  const size_t c = L->i[s];
+
+                  if (mark[c] != stamp)
+                    {
+                      pstack[depth - 1] = s + 1;
+                      stack[depth++] = c;
+                      done = 0;
+                      break;
+                    }
+                }
+            }
+
+          if (done)
+            {
+              --depth;
+              xi[--top] = r;
+            }
+        }
+    }
+
+  return top;
+} /* lu_reach() */
+
+/* make room for nz entries in M, doubling its size */
+static int
+lu_grow(gsl_spmatrix *M, const size_t nz)
+{
+  if (nz > M->nzmax)
+    return gsl_spmatrix_realloc(GSL_MAX(nz, 2 * M->nzmax), M);
+
+  return GSL_SUCCESS;
+}
+
+/*
+lu_ccs()
+  Copy A, in any format, into C in CCS format by counting the entries
+of each column and scattering them; duplicate entries are kept, and
+summed by the factorization
+*/
+
+static int
+lu_ccs(const gsl_spmatrix *A, gsl_spmatrix *C)
+{
+  const size_t n = A->size2;
+  size_t *Cp = C->p;
+  size_t *cnt = (size_t *) C->work;
+  size_t i, j, p;
+
+  if (C->nzmax < A->nz)
+    {
+      int status;
+
+      C->nz = 0;
+      status = gsl_spmatrix_realloc(A->nz, C);
+      if (status)
+        return status;
+    }
+
+  if (GSL_SPMATRIX_ISCCS(A))
+    {
+      for (j = 0; j <= n; ++j)
+        Cp[j] = A->p[j];
+
+      for (p = 0; p < A->nz; ++p)
+        {
+          C->i[p] = A->i[p];
+          C->data[p] = A->data[p];
+        }
+    }
+  else
+    {
+      for (j = 0; j < n; ++j)
+        cnt[j] = 0;
+
+      if (GSL_SPMATRIX_ISTRIPLET(A))
+        {
+          for (p = 0; p < A->nz; ++p)
+            ++cnt[A->p[p]];
+        }
+      else
+        {
+          for (p = 0; p < A->nz; ++p)
+            ++cnt[A->i[p]];
+        }
+
+      Cp[0] = 0;
+      for (j = 0; j < n; ++j)
+        {
+          Cp[j + 1] = Cp[j] + cnt[j];
+          cnt[j] = Cp[j];
+        }
+
+      if (GSL_SPMATRIX_ISTRIPLET(A))
+        {
+          for (p = 0; p < A->nz; ++p)
+            {
+              const size_t k = cnt[A->p[p]]++;
+
+              C->i[k] = A->i[p];
+              C->data[k] = A->data[p];
+            }
+        }
+      else
+        {
+          for (i = 0; i < A->size1; ++i)
+            {
+              for (p = A->p[i]; p < A->p[i + 1]; ++p)
+                {
+                  const size_t k = cnt[A->i[p]]++;
+
+                  C->i[k] = i;
+                  C->data[k] = A->data[p];
+                }
+            }
+        }
+    }
+
+  C->nz = A->nz;
+
+  return GSL_SUCCESS;
+} /* lu_ccs() */
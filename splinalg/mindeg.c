@@ -0,0 +1,725 @@
+/* mindeg.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Approximate minimum degree ordering of the graph of A + A^T, on the
+ * quotient graph of [1]. An eliminated node becomes an element, whose
+ * list holds the remaining nodes it joins, in place of the clique of
+ * the elimination graph, and the elements adjacent to the pivot are
+ * absorbed into the new element. The lists of the quotient graph are
+ * therefore never longer in total than those of A + A^T. The list of
+ * a node not yet eliminated, a variable, holds the elements it belongs
+ * to followed by the variables it is still joined to directly.
+ *
+ * The exact degree of a variable would take a union of element lists
+ * to compute; instead the upper bound of [1] is computed from the
+ * sizes of the elements. Variables with the same list are merged into
+ * supervariables and eliminated together, and rows with many more
+ * entries than the average are removed at the start and ordered last,
+ * as each of their neighbours would otherwise have to be updated at
+ * every step. See
+ *
+ * [1] P. R. Amestoy, T. A. Davis and I. S. Duff, An approximate
+ *     minimum degree ordering algorithm, SIAM J. Matrix Anal. Appl.
+ *     17 (1996), 886-905.
+ *
+ * [2] T. A. Davis, Direct methods for sparse linear systems, SIAM,
+ *     2006, chapter 7.
+ */
+
+#define MINDEG_NONE ((size_t) -1)
+
+/* kinds of node */
+#define MINDEG_VARIABLE 0  /* not eliminated */
+#define MINDEG_ELEMENT  1  /* eliminated, with the list of its variables */
+#define MINDEG_DEAD     2  /* absorbed element, or merged or ordered variable */
+#define MINDEG_DENSE    3  /* dense row, ordered last */
+
+typedef struct
+{
+  size_t n;
+  size_t *iw;      /* lists of the nodes */
+  size_t iwlen;    /* allocated length of iw */
+  size_t pfree;    /* first unused position of iw */
+  size_t *pe;      /* pe[i] = start of the list of node i in iw */
+  size_t *len;     /* length of the list of node i */
+  size_t *elen;    /* number of elements in the list of variable i */
+  size_t *nv;      /* number of rows in supervariable i */
+  size_t *degree;  /* approximate external degree of variable i, or
+                      number of rows in element e */
+  size_t *w;       /* w[e] - wflg = rows of element e outside the pivot */
+  size_t *head;    /* head[d] = first variable of degree d, or NONE */
+  size_t *next;    /* doubly linked lists of variables of equal degree */
+  size_t *last;
+  size_t *hhead;   /* hhead[h] = first variable of hash h, or NONE */
+  size_t *hnext;   /* lists of variables of equal hash */
+  size_t *hash;
+  size_t *mark;    /* mark[i] = stamp of the last visit of node i */
+  size_t *mnext;   /* mnext[i] = next row of the supervariable of i */
+  size_t *mtail;   /* mtail[i] = last row of supervariable i */
+  size_t *tmp;     /* the new element while it is built */
+  unsigned char *kind;
+} mindeg_graph;
+
+static void mindeg_free(mindeg_graph *g);
+
+static int
+mindeg_alloc(const size_t n, mindeg_graph *g)
+{
+  g->n = n;
+  g->iw = NULL;
+  g->iwlen = 0;
+  g->pfree = 0;
+  g->pe = malloc(n * sizeof(size_t));
+  g->len = calloc(n, sizeof(size_t));
+  g->elen = malloc(n * sizeof(size_t));
+  g->nv = malloc(n * sizeof(size_t));
+  g->degree = malloc(n * sizeof(size_t));
+  g->w = malloc(n * sizeof(size_t));
+  g->head = malloc(n * sizeof(size_t));
+  g->next = malloc(n * sizeof(size_t));
+  g->last = malloc(n * sizeof(size_t));
+  g->hhead = malloc(n * sizeof(size_t));
+  g->hnext = malloc(n * sizeof(size_t));
+  g->hash = malloc(n * sizeof(size_t));
+  g->mark = calloc(n, sizeof(size_t));
+  g->mnext = malloc(n * sizeof(size_t));
+  g->mtail = malloc(n * sizeof(size_t));
+  g->tmp = malloc(n * sizeof(size_t));
+  g->kind = malloc(n * sizeof(unsigned char));
+
+  if (!g->pe || !g->len || !g->elen || !g->nv || !g->degree || !g->w ||
+      !g->head || !g->next || !g->last || !g->hhead || !g->hnext ||
+      !g->hash || !g->mark || !g->mnext || !g->mtail || !g->tmp ||
+      !g->kind)
+    {
+      mindeg_free(g);
+      GSL_ERROR("failed to allocate space for minimum degree graph",
+                GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+mindeg_free(mindeg_graph *g)
+{
+  free(g->iw);
+  free(g->pe);
+  free(g->len);
+  free(g->elen);
+  free(g->nv);
+  free(g->degree);
+  free(g->w);
+  free(g->head);
+  free(g->next);
+  free(g->last);
+  free(g->hhead);
+  free(g->hnext);
+  free(g->hash);
+  free(g->mark);
+  free(g->mnext);
+  free(g->mtail);
+  free(g->tmp);
+  free(g->kind);
+}
+
+static void
+mindeg_insert(mindeg_graph *g, const size_t i)
+{
+  const size_t d = g->degree[i];
+
+  g->last[i] = MINDEG_NONE;
+  g->next[i] = g->head[d];
+  if (g->head[d] != MINDEG_NONE)
+    g->last[g->head[d]] = i;
+  g->head[d] = i;
+}
+
+static void
+mindeg_remove(mindeg_graph *g, const size_t i)
+{
+  if (g->last[i] != MINDEG_NONE)
+    g->next[g->last[i]] = g->next[i];
+  else
+    g->head[g->degree[i]] = g->next[i];
+
+  if (g->next[i] != MINDEG_NONE)
+    g->last[g->next[i]] = g->last[i];
+}
+
+/* append the rows of supervariable i to the ordering */
+static size_t
+mindeg_order(const mindeg_graph *g, size_t i, size_t order[], size_t k)
+{
+  for (; i != MINDEG_NONE; i = g->mnext[i])
+    order[k++] = i;
+
+  return k;
+}
+
+/*
+ * move the lists of the variables and elements to the start of iw,
+ * keeping their order. The first entry of the list of node i is saved
+ * in hash[i], which is not in use, and replaced by n + i to mark the
+ * start of the list, as node indices are less than n
+ */
+static void
+mindeg_compact(mindeg_graph *g)
+{
+  const size_t n = g->n;
+  size_t i, p, q, r;
+
+  for (i = 0; i < n; ++i)
+    {
+      if ((g->kind[i] == MINDEG_VARIABLE || g->kind[i] == MINDEG_ELEMENT) &&
+          g->len[i] > 0)
+        {
+          g->hash[i] = g->iw[g->pe[i]];
+          g->iw[g->pe[i]] = n + i;
+        }
+    }
+
+  for (p = 0, q = 0; p < g->pfree; ++p)
+    {
+      if (g->iw[p] >= n)
+        {
+          i = g->iw[p] - n;
+          g->pe[i] = q;
+          g->iw[q++] = g->hash[i];
+
+          for (r = 1; r < g->len[i]; ++r)
+            g->iw[q++] = g->iw[p + r];
+
+          p += g->len[i] - 1;
+        }
+    }
+
+  g->pfree = q;
+}
+
+/* add the edge i - j to the counts or lists of A + A^T */
+static void
+mindeg_edge(mindeg_graph *g, const size_t i, const size_t j, const int fill)
+{
+  if (i == j)
+    return;
+
+  if (fill)
+    {
+      g->iw[g->pe[i] + g->len[i]] = j;
+      g->iw[g->pe[j] + g->len[j]] = i;
+    }
+
+  ++g->len[i];
+  ++g->len[j];
+}
+
+static void
+mindeg_edges(const gsl_spmatrix *A, mindeg_graph *g, const int fill)
+{
+  size_t j, p;
+
+  if (GSL_SPMATRIX_ISTRIPLET(A))
+    {
+      for (p = 0; p < A->nz; ++p)
+        mindeg_edge(g, A->i[p], A->p[p], fill);
+    }
+  else
+    {
+      for (j = 0; j < g->n; ++j)
+        {
+          for (p = A->p[j]; p < A->p[j + 1]; ++p)
+            mindeg_edge(g, A->i[p], j, fill);
+        }
+    }
+}
+
+/*
+gsl_splinalg_mindeg()
+  Compute a fill-reducing ordering of a square sparse matrix
+
+Inputs: A    - square sparse matrix, in any format
+        perm - (output) permutation; perm[k] is the row and column of
+               A which is eliminated k-th, so the Cholesky factor of
+               P A P^T has little fill-in
+
+Return: success or error
+
+Notes:
+1) The ordering is computed for the pattern of A + A^T, and the
+numerical values of A are not used
+
+2) Rows with more than max(16, 10 sqrt(n)) off-diagonal entries in
+A + A^T are dense: they are removed from the graph at the start and
+ordered last. Rows with no off-diagonal entries are ordered first
+
+3) At each step the supervariable of least approximate degree is
+eliminated, taking the most recently updated one when several have
+the least degree, followed by the variables left adjacent only to it
+(mass elimination)
+*/
+
+int
+gsl_splinalg_mindeg(const gsl_spmatrix *A, gsl_permutation *perm)
+{
+  const size_t n = A->size1;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (perm->size != n)
+    {
+      GSL_ERROR("permutation length does not match matrix", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t dense = (size_t) GSL_MAX(16.0, 10.0 * sqrt((double) n));
+      size_t *order = perm->data;
+      mindeg_graph g;
+      size_t nel = 0;     /* number of rows eliminated or set aside */
+      size_t k = 0;       /* number of rows ordered */
+      size_t mindeg = 0;
+      size_t stamp = 0;
+      size_t wflg = 1;
+      size_t i, j, p, q, nz;
+      int status;
+
+      status = mindeg_alloc(n, &g);
+      if (status)
+        return status;
+
+      /* build the lists of A + A^T, with room for the new elements */
+
+      mindeg_edges(A, &g, 0);
+
+      for (i = 0, nz = 0; i < n; ++i)
+        {
+          g.pe[i] = nz;
+          nz += g.len[i];
+          g.len[i] = 0;
+        }
+
+      g.iwlen = nz + nz / 5 + 2 * n + 1;
+      g.iw = malloc(g.iwlen * sizeof(size_t));
+      if (g.iw == NULL)
+        {
+          mindeg_free(&g);
+          GSL_ERROR("failed to allocate space for minimum degree graph",
+                    GSL_ENOMEM);
+        }
+
+      mindeg_edges(A, &g, 1);
+      g.pfree = nz;
+
+      /* remove duplicate edges, and set the dense rows aside */
+      for (i = 0; i < n; ++i)
+        {
+          size_t *ai = g.iw + g.pe[i];
+          size_t m = 0;
+
+          ++stamp;
+          g.mark[i] = stamp;
+          for (p = 0; p < g.len[i]; ++p)
+            {
+              j = ai[p];
+              if (g.mark[j] != stamp)
+                {
+                  g.mark[j] = stamp;
+                  ai[m++] = j;
+                }
+            }
+
+          g.len[i] = m;
+          g.kind[i] = (m > dense) ? MINDEG_DENSE : MINDEG_VARIABLE;
+          g.elen[i] = 0;
+          g.nv[i] = 1;
+          g.w[i] = 0;
+          g.head[i] = MINDEG_NONE;
+          g.hhead[i] = MINDEG_NONE;
+          g.mnext[i] = MINDEG_NONE;
+          g.mtail[i] = i;
+
+          if (g.kind[i] == MINDEG_DENSE)
+            ++nel;
+        }
+
+      /* remove the edges to dense rows; isolated rows come first */
+      for (i = 0; i < n; ++i)
+        {
+          size_t *ai = g.iw + g.pe[i];
+          size_t m = 0;
+
+          if (g.kind[i] == MINDEG_DENSE)
+            continue;
+
+          for (p = 0; p < g.len[i]; ++p)
+            {
+              if (g.kind[ai[p]] != MINDEG_DENSE)
+                ai[m++] = ai[p];
+            }
+
+          g.len[i] = m;
+          g.degree[i] = m;
+
+          if (m == 0)
+            {
+              g.kind[i] = MINDEG_DEAD;
+              order[k++] = i;
+              ++nel;
+            }
+          else
+            {
+              mindeg_insert(&g, i);
+            }
+        }
+
+      while (nel < n)
+        {
+          size_t me, elenme, nlme, degme, t;
+          size_t *lme;
+
+          if (wflg > ((size_t) -1) - 2 * n - 2)
+            {
+              for (i = 0; i < n; ++i)
+                g.w[i] = 0;
+
+              wflg = 1;
+            }
+
+          /* select the supervariable of least degree */
+
+          while (g.head[mindeg] == MINDEG_NONE)
+            ++mindeg;
+
+          me = g.head[mindeg];
+          mindeg_remove(&g, me);
+          elenme = g.elen[me];
+          nel += g.nv[me];
+          k = mindeg_order(&g, me, order, k);
+          g.kind[me] = MINDEG_ELEMENT;
+
+          /*
+           * the new element Lme is the union of the elements of me,
+           * which are absorbed into it, and the variables of me. Its
+           * variables are marked and taken out of the degree lists
+           */
+
+          ++stamp;
+          degme = 0;
+          nlme = 0;
+
+          if (elenme == 0)
+            {
+              /* Lme is built in place of the list of me */
+              size_t *ame = g.iw + g.pe[me];
+
+              for (p = 0; p < g.len[me]; ++p)
+                {
+                  i = ame[p];
+                  if (g.kind[i] == MINDEG_VARIABLE && g.mark[i] != stamp)
+                    {
+                      g.mark[i] = stamp;
+                      degme += g.nv[i];
+                      mindeg_remove(&g, i);
+                      ame[nlme++] = i;
+                    }
+                }
+            }
+          else
+            {
+              for (q = 0; q <= elenme; ++q)
+                {
+                  size_t e, p1, ln;
+
+                  if (q < elenme)
+                    {
+                      e = g.iw[g.pe[me] + q];
+                      if (g.kind[e] != MINDEG_ELEMENT)
+                        continue;
+
+                      p1 = g.pe[e];
+                      ln = g.len[e];
+                    }
+                  else
+                    {
+                      e = me;
+                      p1 = g.pe[me] + elenme;
+                      ln = g.len[me] - elenme;
+                    }
+
+                  for (p = p1; p < p1 + ln; ++p)
+                    {
+                      i = g.iw[p];
+                      if (g.kind[i] == MINDEG_VARIABLE && g.mark[i] != stamp)
+                        {
+                          g.mark[i] = stamp;
+                          degme += g.nv[i];
+                          mindeg_remove(&g, i);
+                          g.tmp[nlme++] = i;
+                        }
+                    }
+
+                  if (e != me)
+                    g.kind[e] = MINDEG_DEAD; /* element absorption */
+                }
+
+              /* store Lme after the other lists */
+
+              g.len[me] = 0;
+
+              if (g.pfree + nlme > g.iwlen)
+                mindeg_compact(&g);
+
+              if (g.pfree + nlme > g.iwlen)
+                {
+                  size_t iwlen = g.pfree + nlme + n;
+                  size_t *iw = realloc(g.iw, iwlen * sizeof(size_t));
+
+                  if (iw == NULL)
+                    {
+                      mindeg_free(&g);
+                      GSL_ERROR("failed to allocate space for minimum degree graph",
+                                GSL_ENOMEM);
+                    }
+
+                  g.iw = iw;
+                  g.iwlen = iwlen;
+                }
+
+              g.pe[me] = g.pfree;
+              for (p = 0; p < nlme; ++p)
+                g.iw[g.pfree++] = g.tmp[p];
+            }
+
+          g.len[me] = nlme;
+          g.elen[me] = 0;
+          lme = g.iw + g.pe[me];
+
+          /*
+           * w[e] - wflg = the rows of each element e adjacent to Lme
+           * which are not in Lme, starting from the size of e
+           */
+
+          for (t = 0; t < nlme; ++t)
+            {
+              const size_t nvi = g.nv[lme[t]];
+              const size_t *ai = g.iw + g.pe[lme[t]];
+
+              for (p = 0; p < g.elen[lme[t]]; ++p)
+                {
+                  const size_t e = ai[p];
+
+                  if (g.kind[e] != MINDEG_ELEMENT)
+                    continue;
+
+                  if (g.w[e] >= wflg)
+                    g.w[e] -= nvi;
+                  else
+                    g.w[e] = g.degree[e] + wflg - nvi;
+                }
+            }
+
+          /*
+           * bound the degree of each variable of Lme by the sizes of
+           * its other elements and its variables outside Lme, removing
+           * absorbed elements and the variables of Lme from its list
+           * and putting me first
+           */
+
+          for (t = 0; t < nlme; ++t)
+            {
+              const size_t pi = g.pe[lme[t]];
+              const size_t p2 = pi + g.elen[lme[t]];
+              const size_t pend = pi + g.len[lme[t]];
+              size_t pn = pi, p3, deg = 0, h = 0;
+
+              i = lme[t];
+
+              for (p = pi; p < p2; ++p)
+                {
+                  const size_t e = g.iw[p];
+                  size_t dext;
+
+                  if (g.kind[e] != MINDEG_ELEMENT)
+                    continue;
+
+                  dext = g.w[e] - wflg;
+                  if (dext > 0)
+                    {
+                      deg += dext;
+                      g.iw[pn++] = e;
+                      h += e;
+                    }
+                  else
+                    {
+                      /* aggressive absorption, e is a subset of Lme */
+                      g.kind[e] = MINDEG_DEAD;
+                    }
+                }
+
+              g.elen[i] = pn - pi + 1;
+              p3 = pn;
+
+              for (p = p2; p < pend; ++p)
+                {
+                  j = g.iw[p];
+                  if (g.kind[j] == MINDEG_VARIABLE && g.mark[j] != stamp)
+                    {
+                      deg += g.nv[j];
+                      g.iw[pn++] = j;
+                      h += j;
+                    }
+                }
+
+              if (g.elen[i] == 1 && p3 == pn)
+                {
+                  /* mass elimination, i is adjacent only to me */
+                  g.kind[i] = MINDEG_DEAD;
+                  k = mindeg_order(&g, i, order, k);
+                  nel += g.nv[i];
+                  degme -= g.nv[i];
+                }
+              else
+                {
+                  g.degree[i] = GSL_MIN(g.degree[i], deg);
+
+                  /* pn < pend, as me or an element absorbed into it
+                     has been removed from the list */
+                  g.iw[pn] = g.iw[p3];
+                  g.iw[p3] = g.iw[pi];
+                  g.iw[pi] = me;
+                  g.len[i] = pn - pi + 1;
+
+                  h %= n;
+                  g.hash[i] = h;
+                  g.hnext[i] = g.hhead[h];
+                  g.hhead[h] = i;
+                }
+            }
+
+          g.degree[me] = degme;
+
+          /*
+           * merge the variables of Lme with the same list into
+           * supervariables. Only the variables in the same hash bucket
+           * are compared, marking the list of one and checking the
+           * list of the other
+           */
+
+          for (t = 0; t < nlme; ++t)
+            {
+              size_t h;
+
+              i = lme[t];
+              if (g.kind[i] != MINDEG_VARIABLE)
+                continue;
+
+              h = g.hash[i];
+              j = g.hhead[h];
+              g.hhead[h] = MINDEG_NONE;
+
+              for (; j != MINDEG_NONE; j = g.hnext[j])
+                {
+                  const size_t ln = g.len[j];
+                  const size_t eln = g.elen[j];
+                  size_t jlast = j, jj;
+
+                  ++stamp;
+                  for (p = g.pe[j] + 1; p < g.pe[j] + ln; ++p)
+                    g.mark[g.iw[p]] = stamp;
+
+                  for (jj = g.hnext[j]; jj != MINDEG_NONE; jj = g.hnext[jj])
+                    {
+                      int same = (g.len[jj] == ln && g.elen[jj] == eln);
+
+                      for (p = g.pe[jj] + 1; same && p < g.pe[jj] + ln; ++p)
+                        same = (g.mark[g.iw[p]] == stamp);
+
+                      if (same)
+                        {
+                          /* jj is indistinguishable from j */
+                          g.nv[j] += g.nv[jj];
+                          g.kind[jj] = MINDEG_DEAD;
+                          g.mnext[g.mtail[j]] = jj;
+                          g.mtail[j] = g.mtail[jj];
+                          g.hnext[jlast] = g.hnext[jj];
+                        }
+                      else
+                        {
+                          jlast = jj;
+                        }
+                    }
+                }
+            }
+
+          /* finalize the degrees and keep the variables left in Lme */
+
+          for (t = 0, q = 0; t < nlme; ++t)
+            {
+              size_t nvi, d;
+
+              i = lme[t];
+              if (g.kind[i] != MINDEG_VARIABLE)
+                continue;
+
+              nvi = g.nv[i];
+              d = g.degree[i] + degme - nvi;
+              d = GSL_MIN(d, n - nel - nvi);
+              g.degree[i] = d;
+              mindeg_insert(&g, i);
+
+              if (d < mindeg)
+                mindeg = d;
+
+              lme[q++] = i;
+            }
+
+          g.len[me] = q;
+          if (q == 0)
+            g.kind[me] = MINDEG_DEAD;
+
+          wflg += n + 1;
+        }
+
+      /* the dense rows come last */
+      for (i = 0; i < n; ++i)
+        {
+          if (g.kind[i] == MINDEG_DENSE)
+            order[k++] = i;
+        }
+
+      mindeg_free(&g);
+
+      if (k != n)
+        {
+          GSL_ERROR("minimum degree ordering is incomplete", GSL_ESANITY);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_mindeg() */
@@ -0,0 +1,397 @@
+/* minres.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * The code in this module is based on the MINRES method
+ * described in
+ *
+ * [1] C. C. Paige and M. A. Saunders, Solution of sparse indefinite
+ *     systems of linear equations, SIAM J. Numer. Anal. 12(4), 1975.
+ *
+ * [2] S.-C. T. Choi, C. C. Paige and M. A. Saunders, MINRES-QLP: a
+ *     Krylov subspace method for indefinite or singular symmetric
+ *     systems, SIAM J. Sci. Comput. 33(4), 2011.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t maxit;    /* maximum iterations per call */
+  gsl_vector *r1;  /* previous two Lanczos vectors, unnormalized */
+  gsl_vector *r2;
+  gsl_vector *y;   /* next Lanczos vector, unnormalized */
+  gsl_vector *v;   /* current Lanczos vector */
+  gsl_vector *z;   /* preconditioned Lanczos vector M^{-1} r2 */
+  gsl_vector *w;   /* last three search directions */
+  gsl_vector *w1;
+  gsl_vector *w2;
+
+  double normr;    /* residual norm ||r|| */
+} minres_state_t;
+
+static void minres_free(void *vstate);
+static int minres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                          const double tol, const gsl_splinalg_precon *P,
+                          gsl_vector *x, void *vstate);
+
+/*
+minres_alloc()
+  Allocate a MINRES workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations in each call to
+            minres_iterate(); if this parameter is 0, the value n
+            is used
+
+Return: pointer to workspace
+*/
+
+static void *
+minres_alloc(const size_t n, const size_t m)
+{
+  minres_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(minres_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate minres state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->maxit = (m == 0) ? n : m;
+
+  state->r1 = gsl_vector_alloc(n);
+  state->r2 = gsl_vector_alloc(n);
+  state->y = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->z = gsl_vector_alloc(n);
+  state->w = gsl_vector_alloc(n);
+  state->w1 = gsl_vector_alloc(n);
+  state->w2 = gsl_vector_alloc(n);
+  if (!state->r1 || !state->r2 || !state->y || !state->v || !state->z ||
+      !state->w || !state->w1 || !state->w2)
+    {
+      minres_free(state);
+      GSL_ERROR_NULL("failed to allocate minres vectors", GSL_ENOMEM);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* minres_alloc() */
+
+static void
+minres_free(void *vstate)
+{
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (state->r1)
+    gsl_vector_free(state->r1);
+
+  if (state->r2)
+    gsl_vector_free(state->r2);
+
+  if (state->y)
+    gsl_vector_free(state->y);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->z)
+    gsl_vector_free(state->z);
+
+  if (state->w)
+    gsl_vector_free(state->w);
+
+  if (state->w1)
+    gsl_vector_free(state->w1);
+
+  if (state->w2)
+    gsl_vector_free(state->w2);
+
+  free(state);
+} /* minres_free() */
+
+/*
+minres_iterate()
+  Solve A*x = b using the MINRES method
+
+Inputs: A    - sparse symmetric matrix, possibly indefinite
+        b    - right hand side vector
+        tol  - stopping tolerance (see below)
+        P    - symmetric positive definite preconditioner, or NULL
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if converged to solution (solution stored in x). In
+this case the following will be true:
+
+||b - A*x|| <= tol * ||b||
+
+GSL_CONTINUE if not yet converged; in this case x contains the
+most recent solution vector and calling this function more times
+with the input x restarts the method from x
+
+Notes:
+1) Based on the MINRES algorithm of (Choi et al, 2011 [2], table 2.5),
+with the three-term Lanczos recurrence and the QR factorization of
+the tridiagonal matrix updated by one Givens rotation per step. The
+residual norm of the iterate is known from the rotations without
+computing it. The Lanczos vectors and search directions are
+rotated between the buffers rather than copied, and the vector
+updates are fused with the inner products which follow them
+
+2) With a preconditioner M, the Lanczos process is run in the inner
+product defined by M^{-1}, the Lanczos vectors being z = M^{-1} r2
+normalized by beta = sqrt(r2.z). The estimated residual norm is then
+||r||_{M^{-1}}, and it is scaled by ||r_0|| / ||r_0||_{M^{-1}} for
+the stopping test
+
+3) The iteration stops on the estimated residual norm, and the true
+residual b - A*x is computed at the end
+
+4) On output, work->normr contains ||b - A*x||
+*/
+
+static int
+minres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+               const double tol, const gsl_splinalg_precon *P,
+               gsl_vector *x, void *vstate)
+{
+  const size_t N = A->size1;
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      const size_t incx = x->stride;
+      double *xd = x->data;
+      gsl_vector *r1 = state->r1;
+      gsl_vector *r2 = state->r2;
+      gsl_vector *y = state->y;
+      gsl_vector *w = state->w;
+      gsl_vector *w1 = state->w1;
+      gsl_vector *w2 = state->w2;
+      double *v = state->v->data;
+      double beta, oldb = 0.0;   /* Lanczos scalars */
+      double dbar = 0.0, epsln = 0.0;
+      double cs = -1.0, sn = 0.0; /* Givens rotation */
+      double phibar, normr, scale = 1.0;
+      size_t i, k;
+      int status;
+
+      /* r1 = r2 = b - A*x_0 */
+      gsl_vector_memcpy(r1, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r1);
+      gsl_vector_memcpy(r2, r1);
+      gsl_vector_set_zero(w);
+      gsl_vector_set_zero(w2);
+
+      normr = gsl_blas_dnrm2(r1);
+      beta = normr;
+
+      if (P != NULL && normr > 0.0)
+        {
+          /* z = M^{-1} r1, beta = ||r1||_{M^{-1}} */
+          status = gsl_splinalg_precon_apply(r1, state->z, P);
+          if (status)
+            return status;
+
+          gsl_blas_ddot(r1, state->z, &beta);
+          if (beta <= 0.0)
+            {
+              GSL_ERROR("preconditioner is not positive definite", GSL_EDOM);
+            }
+
+          beta = sqrt(beta);
+          scale = normr / beta;
+        }
+
+      phibar = beta;
+
+      for (k = 0; k < state->maxit && normr > reltol && beta > 0.0; ++k)
+        {
+          const double s = 1.0 / beta;
+          double alfa = 0.0, beta2 = 0.0;
+          double oldeps, delta, gbar, gamma, phi;
+          double *yd, *r1d, *r2d, *wd, *w1d, *w2d;
+          gsl_vector *tmp;
+
+          /* v = z / beta, where z = r2 without a preconditioner */
+          r2d = r2->data;
+          yd = (P != NULL) ? state->z->data : r2d;
+          for (i = 0; i < N; ++i)
+            v[i] = s * yd[i];
+
+          /* y = A*v - (beta/oldb) r1, alfa = v.y */
+          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, state->v, 0.0, y);
+
+          yd = y->data;
+          r1d = r1->data;
+          if (k > 0)
+            {
+              const double c = beta / oldb;
+
+              for (i = 0; i < N; ++i)
+                {
+                  yd[i] -= c * r1d[i];
+                  alfa += v[i] * yd[i];
+                }
+            }
+          else
+            {
+              for (i = 0; i < N; ++i)
+                alfa += v[i] * yd[i];
+            }
+
+          /* y <- y - (alfa/beta) r2, beta2 = ||y||^2 */
+          {
+            const double c = alfa / beta;
+
+            for (i = 0; i < N; ++i)
+              {
+                yd[i] -= c * r2d[i];
+                beta2 += yd[i] * yd[i];
+              }
+          }
+
+          /* r1 <- r2, r2 <- y, and the old r1 holds the next y */
+          tmp = r1;
+          r1 = r2;
+          r2 = y;
+          y = tmp;
+
+          if (P != NULL)
+            {
+              /* z = M^{-1} r2, beta2 = r2.z */
+              status = gsl_splinalg_precon_apply(r2, state->z, P);
+              if (status)
+                return status;
+
+              gsl_blas_ddot(r2, state->z, &beta2);
+              if (beta2 < 0.0)
+                {
+                  GSL_ERROR("preconditioner is not positive definite",
+                            GSL_EDOM);
+                }
+            }
+
+          oldb = beta;
+          beta = sqrt(beta2);
+
+          /* apply previous rotation, and find the next one */
+          oldeps = epsln;
+          delta = cs * dbar + sn * alfa;
+          gbar = sn * dbar - cs * alfa;
+          epsln = sn * beta;
+          dbar = -cs * beta;
+
+          gamma = gsl_hypot(gbar, beta);
+          gamma = GSL_MAX(gamma, GSL_DBL_EPSILON);
+          cs = gbar / gamma;
+          sn = beta / gamma;
+          phi = cs * phibar;
+          phibar = sn * phibar;
+
+          /*
+           * w1 <- w2, w2 <- w, w = (v - oldeps w1 - delta w2) / gamma,
+           * computed in the buffer of the old w1, and x <- x + phi w
+           */
+          tmp = w1;
+          w1 = w2;
+          w2 = w;
+          w = tmp;
+
+          wd = w->data;
+          w1d = w1->data;
+          w2d = w2->data;
+          for (i = 0; i < N; ++i)
+            {
+              wd[i] = (v[i] - oldeps * w1d[i] - delta * w2d[i]) / gamma;
+              xd[i * incx] += phi * wd[i];
+            }
+
+          normr = scale * phibar;
+        }
+
+      /* compute true residual r = b - A*x */
+      gsl_vector_memcpy(y, b);
+      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, y);
+      normr = gsl_blas_dnrm2(y);
+
+      /* store residual norm */
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;  /* converged */
+      else
+        return GSL_CONTINUE; /* not yet converged */
+    }
+} /* minres_iterate() */
+
+static double
+minres_normr(const void *vstate)
+{
+  const minres_state_t *state = (const minres_state_t *) vstate;
+  return state->normr;
+} /* minres_normr() */
+
+static const gsl_splinalg_itersolve_type minres_type =
+{
+  "minres",
+  &minres_alloc,
+  &minres_iterate,
+  &minres_normr,
+  &minres_free
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_minres =
+  &minres_type;
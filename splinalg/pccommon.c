@@ -0,0 +1,124 @@
+/* pccommon.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Routines shared by the preconditioners which work on the rows of
+ * the matrix; this file is included by them.
+ *
+ * These preconditioners store the inverse of the diagonal they divide
+ * by. In the triangular solves of their apply functions each z_i
+ * depends on the one computed before it, so a division there would
+ * lie on the critical path of the loop, where a multiplication costs
+ * a fraction of the latency.
+ */
+
+/*
+precon_crs()
+  Copy a square matrix into compressed row format, with the column
+indices of each row in increasing order and duplicate entries summed
+
+Inputs: A - sparse matrix in triplet, CCS or CRS format
+
+Return: pointer to new CRS matrix, or NULL on error
+*/
+
+static gsl_spmatrix *
+precon_crs(const gsl_spmatrix *A)
+{
+  const size_t n = A->size1;
+  const gsl_spmatrix *S = A;
+  gsl_spmatrix *T = NULL;
+  gsl_spmatrix *R;
+  size_t j, p;
+
+  if (!GSL_SPMATRIX_ISTRIPLET(A))
+    {
+      /* gather the entries into a triplet matrix to sort them */
+      T = gsl_spmatrix_alloc_nzmax(n, n, GSL_MAX(A->nz, 1),
+                                   GSL_SPMATRIX_TRIPLET | GSL_SPMATRIX_NOTREE);
+      if (T == NULL)
+        {
+          GSL_ERROR_NULL("failed to allocate space for triplet matrix",
+                         GSL_ENOMEM);
+        }
+
+      for (j = 0; j < n; ++j)
+        {
+          for (p = A->p[j]; p < A->p[j + 1]; ++p)
+            {
+              if (GSL_SPMATRIX_ISCCS(A))
+                gsl_spmatrix_set(T, A->i[p], j, A->data[p]);
+              else
+                gsl_spmatrix_set(T, j, A->i[p], A->data[p]);
+            }
+        }
+
+      S = T;
+    }
+
+  R = gsl_spmatrix_alloc_nzmax(n, n, GSL_MAX(S->nz, 1), GSL_SPMATRIX_CRS);
+  if (R != NULL && gsl_spmatrix_compress(NULL, R, S) != GSL_SUCCESS)
+    {
+      gsl_spmatrix_free(R);
+      R = NULL;
+    }
+
+  if (T != NULL)
+    gsl_spmatrix_free(T);
+
+  if (R == NULL)
+    {
+      GSL_ERROR_NULL("failed to copy matrix to compressed row format",
+                     GSL_ENOMEM);
+    }
+
+  return R;
+} /* precon_crs() */
+
+/*
+precon_diag()
+  Find the position of the diagonal element in each row of a CRS
+matrix with sorted column indices
+
+Inputs: R    - sparse matrix in CRS format
+        diag - (output) diag[i] is the index of R_{ii} in R->data
+
+Return: success, or GSL_ESING if a diagonal element is zero or
+not stored
+*/
+
+static int
+precon_diag(const gsl_spmatrix *R, size_t *diag)
+{
+  const size_t n = R->size1;
+  size_t i, p;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (p = R->p[i]; p < R->p[i + 1] && R->i[p] < i; ++p)
+        ;
+
+      if (p == R->p[i + 1] || R->i[p] != i || R->data[p] == 0.0)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_ESING);
+        }
+
+      diag[i] = p;
+    }
+
+  return GSL_SUCCESS;
+} /* precon_diag() */
@@ -0,0 +1,120 @@
+/* precon.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+gsl_splinalg_precon *
+gsl_splinalg_precon_alloc(const gsl_splinalg_precon_type *T,
+                          const size_t n)
+{
+  gsl_splinalg_precon *P;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  P = calloc(1, sizeof(gsl_splinalg_precon));
+  if (P == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for precon struct",
+                     GSL_ENOMEM);
+    }
+
+  P->type = T;
+  P->n = n;
+
+  P->state = P->type->alloc(n);
+  if (P->state == NULL)
+    {
+      gsl_splinalg_precon_free(P);
+      GSL_ERROR_NULL("failed to allocate space for precon state",
+                     GSL_ENOMEM);
+    }
+
+  return P;
+} /* gsl_splinalg_precon_alloc() */
+
+void
+gsl_splinalg_precon_free(gsl_splinalg_precon *P)
+{
+  RETURN_IF_NULL(P);
+
+  if (P->state)
+    P->type->free(P->state);
+
+  free(P);
+}
+
+const char *
+gsl_splinalg_precon_name(const gsl_splinalg_precon *P)
+{
+  return P->type->name;
+}
+
+/*
+gsl_splinalg_precon_init()
+  Compute the preconditioner M for the n-by-n matrix A, which may
+be stored in triplet, CCS or CRS format. This must be called again
+whenever the entries of A change.
+*/
+
+int
+gsl_splinalg_precon_init(const gsl_spmatrix *A, gsl_splinalg_precon *P)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != P->n)
+    {
+      GSL_ERROR("matrix does not match preconditioner", GSL_EBADLEN);
+    }
+  else
+    {
+      return P->type->init(A, P->state);
+    }
+}
+
+/*
+gsl_splinalg_precon_apply()
+  Solve M z = r for z, where M is the preconditioner
+*/
+
+int
+gsl_splinalg_precon_apply(const gsl_vector *r, gsl_vector *z,
+                          const gsl_splinalg_precon *P)
+{
+  if (r->size != P->n)
+    {
+      GSL_ERROR("vector r does not match preconditioner", GSL_EBADLEN);
+    }
+  else if (z->size != P->n)
+    {
+      GSL_ERROR("vector z does not match preconditioner", GSL_EBADLEN);
+    }
+  else
+    {
+      return P->type->apply(r, z, P->state);
+    }
+}
@@ -0,0 +1,226 @@
+/* ssor.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "pccommon.c"
+
+/*
+ * SSOR preconditioner with relaxation parameter omega,
+ *
+ * M = (D + omega L) D^{-1} (D + omega U)
+ *
+ * where D, L and U are the diagonal and the strictly lower and upper
+ * triangles of A; the constant factor 1 / (omega (2 - omega)) of the
+ * SSOR iteration matrix is left out, as it does not change the
+ * preconditioned iterates. omega = 1 (symmetric Gauss-Seidel) unless
+ * set with gsl_splinalg_precon_ssor_set_omega(). See section 10.2 of
+ *
+ * [1] Y. Saad, Iterative methods for sparse linear systems,
+ *     2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of matrix */
+  gsl_spmatrix *R; /* A in CRS format */
+  size_t *diag;    /* diag[i] is the index of A_{ii} in R->data */
+  double *dinv;    /* inverse diagonal 1 / A_{ii} */
+  double omega;    /* relaxation parameter, 0 < omega < 2 */
+} ssor_state_t;
+
+static void ssor_free(void *vstate);
+
+static void *
+ssor_alloc(const size_t n)
+{
+  ssor_state_t *state;
+
+  state = calloc(1, sizeof(ssor_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ssor state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->omega = 1.0;
+
+  state->diag = malloc(n * sizeof(size_t));
+  state->dinv = malloc(n * sizeof(double));
+  if (!state->diag || !state->dinv)
+    {
+      ssor_free(state);
+      GSL_ERROR_NULL("failed to allocate ssor workspace", GSL_ENOMEM);
+    }
+
+  return state;
+} /* ssor_alloc() */
+
+static void
+ssor_free(void *vstate)
+{
+  ssor_state_t *state = (ssor_state_t *) vstate;
+
+  if (state->R)
+    gsl_spmatrix_free(state->R);
+
+  if (state->diag)
+    free(state->diag);
+
+  if (state->dinv)
+    free(state->dinv);
+
+  free(state);
+} /* ssor_free() */
+
+/* copy A to CRS with sorted rows and invert its diagonal */
+
+static int
+ssor_init(const gsl_spmatrix *A, void *vstate)
+{
+  ssor_state_t *state = (ssor_state_t *) vstate;
+  size_t i;
+  int status;
+
+  if (state->R)
+    gsl_spmatrix_free(state->R);
+
+  state->R = precon_crs(A);
+  if (state->R == NULL)
+    return GSL_ENOMEM;
+
+  status = precon_diag(state->R, state->diag);
+  if (status)
+    {
+      gsl_spmatrix_free(state->R);
+      state->R = NULL;
+      return status;
+    }
+
+  for (i = 0; i < state->n; ++i)
+    state->dinv[i] = 1.0 / state->R->data[state->diag[i]];
+
+  return GSL_SUCCESS;
+} /* ssor_init() */
+
+/*
+ssor_apply()
+  Solve (D + omega L) y = r, then (D + omega U) z = D y; the second
+solve is written as z_i = y_i - omega (U z)_i / D_{ii} so that D y is
+not formed
+*/
+
+static int
+ssor_apply(const gsl_vector *r, gsl_vector *z, void *vstate)
+{
+  const ssor_state_t *state = (const ssor_state_t *) vstate;
+  const size_t n = state->n;
+  const size_t *diag = state->diag;
+  const double *dinv = state->dinv;
+  const double omega = state->omega;
+  const size_t incr = r->stride;
+  const size_t incz = z->stride;
+  const double *rd = r->data;
+  double *zd = z->data;
+  const size_t *Rp, *Ri;
+  const double *Rd;
+  size_t i, p;
+
+  if (state->R == NULL)
+    {
+      GSL_ERROR("preconditioner has not been initialized", GSL_EINVAL);
+    }
+
+  Rp = state->R->p;
+  Ri = state->R->i;
+  Rd = state->R->data;
+
+  /* (D + omega L) y = r */
+  for (i = 0; i < n; ++i)
+    {
+      double s = 0.0;
+
+      for (p = Rp[i]; p < diag[i]; ++p)
+        s += Rd[p] * zd[Ri[p] * incz];
+
+      zd[i * incz] = (rd[i * incr] - omega * s) * dinv[i];
+    }
+
+  /* (D + omega U) z = D y */
+  for (i = n; i-- > 0; )
+    {
+      double s = 0.0;
+
+      for (p = diag[i] + 1; p < Rp[i + 1]; ++p)
+        s += Rd[p] * zd[Ri[p] * incz];
+
+      zd[i * incz] -= omega * s * dinv[i];
+    }
+
+  return GSL_SUCCESS;
+} /* ssor_apply() */
+
+static const gsl_splinalg_precon_type ssor_type =
+{
+  "ssor",
+  &ssor_alloc,
+  &ssor_init,
+  &ssor_apply,
+  &ssor_free
+};
+
+const gsl_splinalg_precon_type * gsl_splinalg_precon_ssor =
+  &ssor_type;
+
+/*
+gsl_splinalg_precon_ssor_set_omega()
+  Set the relaxation parameter of an SSOR preconditioner; it takes
+effect at the next apply, without calling gsl_splinalg_precon_init()
+again
+
+Inputs: P     - preconditioner of type gsl_splinalg_precon_ssor
+        omega - relaxation parameter, 0 < omega < 2
+
+Return: success or error
+*/
+
+int
+gsl_splinalg_precon_ssor_set_omega(gsl_splinalg_precon *P,
+                                   const double omega)
+{
+  if (P->type != gsl_splinalg_precon_ssor)
+    {
+      GSL_ERROR("preconditioner is not of type ssor", GSL_EINVAL);
+    }
+  else if (!(omega > 0.0 && omega < 2.0))
+    {
+      GSL_ERROR("omega must be in (0, 2)", GSL_EDOM);
+    }
+  else
+    {
+      ssor_state_t *state = (ssor_state_t *) P->state;
+
+      state->omega = omega;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_precon_ssor_set_omega() */
@@ -29,6 +29,9 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_blas.h>
+#include <gsl/gsl_complex_math.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_sort_vector.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
@@ -100,9 +103,9 @@ test_poisson()
   epsrel is the relative error threshold with the exact solution
 */
 static void
-test_poisson(const size_t N, const double epsrel, const int compress)
+test_poisson(const gsl_splinalg_itersolve_type *T, const size_t N,
+             const double epsrel, const int compress)
 {
-  const gsl_splinalg_itersolve_type *T = gsl_splinalg_itersolve_gmres;
   const size_t n = N - 2;                     /* subtract 2 to exclude boundaries */
   const double h = 1.0 / (N - 1.0);           /* grid spacing */
   const double tol = 1.0e-9;
@@ -209,13 +212,12 @@ rhs = ones(n,1)
 */
 
 static void
-test_toeplitz(const size_t N, const double a, const double b,
-              const double c)
+test_toeplitz(const gsl_splinalg_itersolve_type *T, const size_t N,
+              const double a, const double b, const double c)
 {
   int status;
   const double tol = 1.0e-10;
   const size_t max_iter = 10;
-  const gsl_splinalg_itersolve_type *T = gsl_splinalg_itersolve_gmres;
   const char *desc;
   gsl_spmatrix *A;
   gsl_vector *rhs, *x;
@@ -337,28 +339,1074 @@ test_random(const size_t N, const gsl_rng *r, const int compress)
     gsl_spmatrix_free(B);
 } /* test_random() */
 
+/*
+test_system()
+  Solve A x = b with the solver T and the preconditioner PT (or
+none if PT is NULL), calling the iterate function up to max_iter
+times, and check the status and the residual
+*/
+
+static void
+test_system(const gsl_splinalg_itersolve_type *T,
+            const gsl_splinalg_precon_type *PT, const gsl_spmatrix *A,
+            const gsl_vector *b, const double tol, const size_t max_iter,
+            const char *name)
+{
+  const size_t N = A->size1;
+  gsl_vector *x = gsl_vector_calloc(N);
+  gsl_splinalg_itersolve *w = gsl_splinalg_itersolve_alloc(T, N, 0);
+  gsl_splinalg_precon *P = NULL;
+  const char *desc = gsl_splinalg_itersolve_name(w);
+  const char *pdesc = "none";
+  size_t iter = 0;
+  int status;
+
+  if (PT != NULL)
+    {
+      P = gsl_splinalg_precon_alloc(PT, N);
+      pdesc = gsl_splinalg_precon_name(P);
+
+      status = gsl_splinalg_precon_init(A, P);
+      gsl_test(status, "%s %s precon=%s init N=%zu", desc, name, pdesc, N);
+
+      gsl_splinalg_itersolve_set_precon(w, P);
+    }
+
+  do
+    {
+      status = gsl_splinalg_itersolve_iterate(A, b, tol, x, w);
+    }
+  while (status == GSL_CONTINUE && ++iter < max_iter);
+
+  gsl_test(status, "%s %s precon=%s status s=%d N=%zu",
+           desc, name, pdesc, status, N);
+
+  /* check that the residual satisfies ||r|| <= tol*||b|| */
+  {
+    gsl_vector *r = gsl_vector_alloc(N);
+    double normr, normb;
+
+    gsl_vector_memcpy(r, b);
+    gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+
+    normr = gsl_blas_dnrm2(r);
+    normb = gsl_blas_dnrm2(b);
+
+    status = (normr <= tol*normb) != 1;
+    gsl_test(status, "%s %s precon=%s residual N=%zu normr=%.12e normb=%.12e",
+             desc, name, pdesc, N, normr, normb);
+
+    status = fabs(gsl_splinalg_itersolve_normr(w) - normr) > 1.0e-8 * normb;
+    gsl_test(status, "%s %s precon=%s normr N=%zu", desc, name, pdesc, N);
+
+    gsl_vector_free(r);
+  }
+
+  gsl_vector_free(x);
+  gsl_splinalg_itersolve_free(w);
+
+  if (P != NULL)
+    gsl_splinalg_precon_free(P);
+} /* test_system() */
+
+/*
+test_spd()
+  Test a random symmetric positive definite matrix, made
+diagonally dominant, with a random right hand side
+*/
+
+static void
+test_spd(const gsl_splinalg_itersolve_type *T,
+         const gsl_splinalg_precon_type *PT, const size_t N,
+         const gsl_rng *r)
+{
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_spmatrix *C;
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *d = gsl_vector_calloc(N);
+  size_t i, k;
+
+  for (k = 0; k < 3 * N; ++k)
+    {
+      size_t i = gsl_rng_uniform(r) * N;
+      size_t j = gsl_rng_uniform(r) * N;
+      double x = gsl_rng_uniform(r) - 0.5;
+
+      if (i == j)
+        continue;
+
+      gsl_spmatrix_set(A, i, j, x);
+      gsl_spmatrix_set(A, j, i, x);
+    }
+
+  /* the diagonal exceeds the sum of |a_ij| in each row */
+  for (k = 0; k < A->nz; ++k)
+    gsl_vector_set(d, A->i[k], gsl_vector_get(d, A->i[k]) + fabs(A->data[k]));
+
+  for (i = 0; i < N; ++i)
+    gsl_spmatrix_set(A, i, i, gsl_vector_get(d, i) + 0.1);
+
+  create_random_vector(b, r);
+
+  C = gsl_spmatrix_crs(A);
+  test_system(T, PT, C, b, 1.0e-10, 10, "spd");
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(C);
+  gsl_vector_free(b);
+  gsl_vector_free(d);
+} /* test_spd() */
+
+/*
+test_indefinite()
+  Test the symmetric indefinite matrix of the 1D Helmholtz
+equation -u'' - k^2 u = 1 with Dirichlet boundary conditions
+*/
+
+static void
+test_indefinite(const gsl_splinalg_itersolve_type *T,
+                const gsl_splinalg_precon_type *PT, const size_t N,
+                const double k2)
+{
+  const double h = 1.0 / (N + 1.0);
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_spmatrix *C;
+  gsl_vector *b = gsl_vector_alloc(N);
+  size_t i;
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_spmatrix_set(A, i, i, 2.0 / (h * h) - k2);
+
+      if (i > 0)
+        gsl_spmatrix_set(A, i, i - 1, -1.0 / (h * h));
+
+      if (i < N - 1)
+        gsl_spmatrix_set(A, i, i + 1, -1.0 / (h * h));
+    }
+
+  gsl_vector_set_all(b, 1.0);
+
+  C = gsl_spmatrix_ccs(A);
+  test_system(T, PT, C, b, 1.0e-8, 20, "indefinite");
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(C);
+  gsl_vector_free(b);
+} /* test_indefinite() */
+
+/*
+test_convdiff()
+  Test the nonsymmetric matrix of the 2D convection-diffusion
+equation -lap(u) + a.grad(u) = 1 on the unit square, with upwind
+differences on an n-by-n interior grid
+*/
+
+static void
+test_convdiff(const gsl_splinalg_itersolve_type *T,
+              const gsl_splinalg_precon_type *PT, const size_t n,
+              const double a)
+{
+  const size_t N = n * n;
+  const double h = 1.0 / (n + 1.0);
+  gsl_spmatrix *A = gsl_spmatrix_alloc_nzmax(N, N, 5 * N,
+                                             GSL_SPMATRIX_TRIPLET);
+  gsl_spmatrix *C;
+  gsl_vector *b = gsl_vector_alloc(N);
+  size_t i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < n; ++j)
+        {
+          const size_t k = i * n + j;
+
+          gsl_spmatrix_set(A, k, k, 4.0 + 2.0 * a * h);
+
+          if (j > 0)
+            gsl_spmatrix_set(A, k, k - 1, -1.0 - a * h);
+          if (j < n - 1)
+            gsl_spmatrix_set(A, k, k + 1, -1.0);
+          if (i > 0)
+            gsl_spmatrix_set(A, k, k - n, -1.0 - a * h);
+          if (i < n - 1)
+            gsl_spmatrix_set(A, k, k + n, -1.0);
+        }
+    }
+
+  gsl_vector_set_all(b, h * h);
+
+  C = gsl_spmatrix_crs(A);
+  test_system(T, PT, C, b, 1.0e-10, 20, "convdiff");
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(C);
+  gsl_vector_free(b);
+} /* test_convdiff() */
+
+/*
+test_precon_tridiag()
+  Test that the incomplete factorization of a symmetric tridiagonal
+matrix, which has no fill-in, is exact, so that applying the
+preconditioner to A*x gives x back
+*/
+
+static void
+test_precon_tridiag(const gsl_splinalg_precon_type *PT, const size_t N,
+                    const int compress)
+{
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_spmatrix *B;
+  gsl_splinalg_precon *P = gsl_splinalg_precon_alloc(PT, N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *z = gsl_vector_alloc(N);
+  const char *desc = gsl_splinalg_precon_name(P);
+  size_t i;
+  int status;
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_spmatrix_set(A, i, i, 2.5 + 0.01 * i);
+
+      if (i > 0)
+        gsl_spmatrix_set(A, i, i - 1, -1.0);
+
+      if (i < N - 1)
+        gsl_spmatrix_set(A, i, i + 1, -1.0);
+
+      gsl_vector_set(x, i, sin(0.1 * i) + 1.0);
+    }
+
+  if (compress)
+    B = gsl_spmatrix_ccs(A);
+  else
+    B = A;
+
+  /* b = A x */
+  gsl_spblas_dgemv(CblasNoTrans, 1.0, B, x, 0.0, b);
+
+  status = gsl_splinalg_precon_init(B, P);
+  gsl_test(status, "%s tridiag init N=%zu compress=%d", desc, N, compress);
+
+  status = gsl_splinalg_precon_apply(b, z, P);
+  gsl_test(status, "%s tridiag apply N=%zu compress=%d", desc, N, compress);
+
+  for (i = 0; i < N; ++i)
+    {
+      double zi = gsl_vector_get(z, i);
+      double xi = gsl_vector_get(x, i);
+
+      gsl_test_rel(zi, xi, 1.0e-12, "%s tridiag N=%zu compress=%d i=%zu",
+                   desc, N, compress, i);
+    }
+
+  gsl_spmatrix_free(A);
+  gsl_splinalg_precon_free(P);
+  gsl_vector_free(x);
+  gsl_vector_free(b);
+  gsl_vector_free(z);
+
+  if (compress)
+    gsl_spmatrix_free(B);
+} /* test_precon_tridiag() */
+
+/*
+test_precon_ssor()
+  Test the SSOR preconditioner with relaxation parameter omega on a
+nonsymmetric banded matrix: b = M x is formed from the definition
+M = (D + omega L) D^{-1} (D + omega U), and applying the
+preconditioner to b must give x back
+*/
+
+static void
+test_precon_ssor(const size_t N, const double omega)
+{
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_splinalg_precon *P = gsl_splinalg_precon_alloc(gsl_splinalg_precon_ssor, N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *w = gsl_vector_alloc(N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *z = gsl_vector_alloc(N);
+  size_t i, j;
+  int status;
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_spmatrix_set(A, i, i, 4.0 + 0.01 * i);
+
+      if (i > 0)
+        gsl_spmatrix_set(A, i, i - 1, -1.0);
+      if (i < N - 1)
+        gsl_spmatrix_set(A, i, i + 1, -0.5);
+      if (i > 2)
+        gsl_spmatrix_set(A, i, i - 3, 0.25);
+      if (i + 3 < N)
+        gsl_spmatrix_set(A, i, i + 3, -0.75);
+
+      gsl_vector_set(x, i, cos(0.3 * i) + 0.5);
+    }
+
+  /* w = D^{-1} (D + omega U) x */
+  for (i = 0; i < N; ++i)
+    {
+      double s = 0.0;
+
+      for (j = i + 1; j < N; ++j)
+        s += gsl_spmatrix_get(A, i, j) * gsl_vector_get(x, j);
+
+      gsl_vector_set(w, i, gsl_vector_get(x, i) +
+                     omega * s / gsl_spmatrix_get(A, i, i));
+    }
+
+  /* b = (D + omega L) w */
+  for (i = 0; i < N; ++i)
+    {
+      double s = 0.0;
+
+      for (j = 0; j < i; ++j)
+        s += gsl_spmatrix_get(A, i, j) * gsl_vector_get(w, j);
+
+      gsl_vector_set(b, i, gsl_spmatrix_get(A, i, i) * gsl_vector_get(w, i) +
+                     omega * s);
+    }
+
+  status = gsl_splinalg_precon_init(A, P);
+  gsl_test(status, "ssor init N=%zu omega=%g", N, omega);
+
+  status = gsl_splinalg_precon_ssor_set_omega(P, omega);
+  gsl_test(status, "ssor set_omega N=%zu omega=%g", N, omega);
+
+  status = gsl_splinalg_precon_apply(b, z, P);
+  gsl_test(status, "ssor apply N=%zu omega=%g", N, omega);
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(z, i), gsl_vector_get(x, i), 1.0e-12,
+                   "ssor N=%zu omega=%g i=%zu", N, omega, i);
+    }
+
+  {
+    gsl_error_handler_t *handler = gsl_set_error_handler_off();
+    gsl_splinalg_precon *J = gsl_splinalg_precon_alloc(gsl_splinalg_precon_jacobi, N);
+
+    status = gsl_splinalg_precon_ssor_set_omega(P, 2.0);
+    gsl_test(status != GSL_EDOM, "ssor set_omega omega=2 rejected");
+
+    status = gsl_splinalg_precon_ssor_set_omega(J, omega);
+    gsl_test(status != GSL_EINVAL, "ssor set_omega on jacobi rejected");
+
+    gsl_splinalg_precon_free(J);
+    gsl_set_error_handler(handler);
+  }
+
+  gsl_spmatrix_free(A);
+  gsl_splinalg_precon_free(P);
+  gsl_vector_free(x);
+  gsl_vector_free(w);
+  gsl_vector_free(b);
+  gsl_vector_free(z);
+} /* test_precon_ssor() */
+
+/*
+test_direct_residual()
+  Check the backward error of a solution x of A x = b from a direct
+solver: ||b - A x|| <= tol * (||A||_F ||x|| + ||b||)
+*/
+
+static void
+test_direct_residual(const gsl_spmatrix *A, const gsl_vector *x,
+                     const gsl_vector *b, const double tol,
+                     const char *desc)
+{
+  const size_t N = A->size1;
+  gsl_vector *r = gsl_vector_alloc(N);
+  double normA = 0.0, normr, normx, normb;
+  size_t k;
+  int status;
+
+  for (k = 0; k < A->nz; ++k)
+    normA += A->data[k] * A->data[k];
+
+  normA = sqrt(normA);
+
+  gsl_vector_memcpy(r, b);
+  gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+
+  normr = gsl_blas_dnrm2(r);
+  normx = gsl_blas_dnrm2(x);
+  normb = gsl_blas_dnrm2(b);
+
+  status = !(normr <= tol * (normA * normx + normb));
+  gsl_test(status, "%s residual N=%zu normr=%.12e normx=%.12e",
+           desc, N, normr, normx);
+
+  gsl_vector_free(r);
+} /* test_direct_residual() */
+
+/*
+test_ldlt()
+  Test the sparse LDL^T solver on the symmetric quasi-definite matrix
+
+K = [ H    B ]
+    [ B^T -G ]
+
+with H and G random, symmetric and diagonally dominant, which is
+indefinite but factors stably in any symmetric order. The matrix is
+given in triplet (format 0), CCS (1) or CRS (2) format, with both
+triangles or the lower one only, and is factored again with the same
+pattern after it is scaled
+*/
+
+static void
+test_ldlt(const size_t N, const int format, const int lower,
+          const gsl_rng *r)
+{
+  const size_t N1 = N / 2;
+  gsl_spmatrix *T = gsl_spmatrix_alloc(N, N);
+  gsl_spmatrix *A;
+  gsl_splinalg_ldlt_workspace *w = gsl_splinalg_ldlt_alloc(N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *d = gsl_vector_calloc(N);
+  char desc[64];
+  size_t i, k;
+  int status;
+
+  sprintf(desc, "ldlt format=%d lower=%d", format, lower);
+
+  for (k = 0; k < 3 * N; ++k)
+    {
+      size_t i = gsl_rng_uniform(r) * N;
+      size_t j = gsl_rng_uniform(r) * N;
+      double a = gsl_rng_uniform(r) - 0.5;
+
+      if (i <= j)
+        continue;
+
+      /* i > j: entry of the lower triangle, and of B^T when j < N1 <= i */
+      gsl_spmatrix_set(T, i, j, a);
+      gsl_vector_set(d, i, gsl_vector_get(d, i) + fabs(a));
+      gsl_vector_set(d, j, gsl_vector_get(d, j) + fabs(a));
+
+      if (!lower)
+        gsl_spmatrix_set(T, j, i, a);
+    }
+
+  for (i = 0; i < N; ++i)
+    {
+      double di = gsl_vector_get(d, i) + 1.0;
+      gsl_spmatrix_set(T, i, i, (i < N1) ? di : -di);
+    }
+
+  if (format == 1)
+    A = gsl_spmatrix_ccs(T);
+  else if (format == 2)
+    A = gsl_spmatrix_crs(T);
+  else
+    A = T;
+
+  create_random_vector(b, r);
+
+  status = gsl_splinalg_ldlt_symbolic(A, w);
+  gsl_test(status, "%s symbolic N=%zu", desc, N);
+
+  status = gsl_splinalg_ldlt_decomp(A, w);
+  gsl_test(status, "%s decomp N=%zu", desc, N);
+
+  status = gsl_splinalg_ldlt_solve(b, x, w);
+  gsl_test(status, "%s solve N=%zu", desc, N);
+
+  /* the residual is checked with the full matrix */
+  if (lower)
+    {
+      for (k = 0; k < N; ++k)
+        {
+          size_t j;
+
+          for (j = 0; j < k; ++j)
+            {
+              double a = gsl_spmatrix_get(T, k, j);
+
+              if (a != 0.0)
+                gsl_spmatrix_set(T, j, k, a);
+            }
+        }
+    }
+
+  test_direct_residual(T, x, b, 1.0e-12, desc);
+
+  /* refactor 2 A with the same analysis; the solution is x / 2 */
+  {
+    gsl_vector *x2 = gsl_vector_alloc(N);
+
+    gsl_spmatrix_scale(A, 2.0);
+
+    status = gsl_splinalg_ldlt_decomp(A, w);
+    gsl_test(status, "%s refactor N=%zu", desc, N);
+
+    gsl_splinalg_ldlt_solve(b, x2, w);
+
+    for (i = 0; i < N; ++i)
+      {
+        gsl_test_rel(gsl_vector_get(x2, i), 0.5 * gsl_vector_get(x, i),
+                     1.0e-10, "%s refactor N=%zu i=%zu", desc, N, i);
+      }
+
+    gsl_vector_free(x2);
+  }
+
+  if (A != T)
+    gsl_spmatrix_free(A);
+
+  gsl_spmatrix_free(T);
+  gsl_splinalg_ldlt_free(w);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(d);
+} /* test_ldlt() */
+
+/*
+test_mindeg()
+  Test the minimum degree ordering on the 5-point Laplacian of an
+n-by-n grid: the ordering must be a permutation, and the factor must
+have at least a third less fill than the band of width n of the
+natural ordering
+*/
+
+static void
+test_mindeg(const size_t n)
+{
+  const size_t N = n * n;
+  gsl_spmatrix *A = gsl_spmatrix_alloc_nzmax(N, N, 5 * N,
+                                             GSL_SPMATRIX_TRIPLET);
+  gsl_permutation *perm = gsl_permutation_alloc(N);
+  gsl_splinalg_ldlt_workspace *w = gsl_splinalg_ldlt_alloc(N);
+  size_t i, j;
+  int status;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < n; ++j)
+        {
+          const size_t k = i * n + j;
+
+          gsl_spmatrix_set(A, k, k, 4.0);
+
+          if (j > 0)
+            gsl_spmatrix_set(A, k, k - 1, -1.0);
+          if (j < n - 1)
+            gsl_spmatrix_set(A, k, k + 1, -1.0);
+          if (i > 0)
+            gsl_spmatrix_set(A, k, k - n, -1.0);
+          if (i < n - 1)
+            gsl_spmatrix_set(A, k, k + n, -1.0);
+        }
+    }
+
+  status = gsl_splinalg_mindeg(A, perm);
+  gsl_test(status, "mindeg status n=%zu", n);
+
+  status = gsl_permutation_valid(perm);
+  gsl_test(status, "mindeg permutation n=%zu", n);
+
+  gsl_splinalg_ldlt_symbolic(A, w);
+  status = gsl_splinalg_ldlt_decomp(A, w);
+  gsl_test(status, "mindeg ldlt n=%zu", n);
+
+  status = !(3 * w->L->nz < 2 * N * n);
+  gsl_test(status, "mindeg fill n=%zu nnz(L)=%zu band=%zu",
+           n, w->L->nz, N * n);
+
+  gsl_spmatrix_free(A);
+  gsl_permutation_free(perm);
+  gsl_splinalg_ldlt_free(w);
+} /* test_mindeg() */
+
+/*
+test_mindeg_dense()
+  Test the minimum degree ordering on the arrowhead matrix of a
+tridiagonal matrix of size N with a dense first row and column: the
+dense row must be ordered last, so the factor keeps the pattern of
+the arrow
+*/
+
+static void
+test_mindeg_dense(const size_t N)
+{
+  gsl_spmatrix *A = gsl_spmatrix_alloc_nzmax(N, N, 5 * N,
+                                             GSL_SPMATRIX_TRIPLET);
+  gsl_permutation *perm = gsl_permutation_alloc(N);
+  gsl_splinalg_ldlt_workspace *w = gsl_splinalg_ldlt_alloc(N);
+  size_t i;
+  int status;
+
+  gsl_spmatrix_set(A, 0, 0, (double) N);
+
+  for (i = 1; i < N; ++i)
+    {
+      gsl_spmatrix_set(A, i, i, 4.0);
+      gsl_spmatrix_set(A, i, 0, 1.0);
+      gsl_spmatrix_set(A, 0, i, 1.0);
+
+      if (i > 1)
+        gsl_spmatrix_set(A, i, i - 1, -1.0);
+      if (i < N - 1)
+        gsl_spmatrix_set(A, i, i + 1, -1.0);
+    }
+
+  status = gsl_splinalg_mindeg(A, perm);
+  gsl_test(status, "mindeg dense status N=%zu", N);
+
+  status = gsl_permutation_valid(perm);
+  gsl_test(status, "mindeg dense permutation N=%zu", N);
+
+  status = (gsl_permutation_get(perm, N - 1) != 0);
+  gsl_test(status, "mindeg dense row last N=%zu", N);
+
+  gsl_splinalg_ldlt_symbolic(A, w);
+  status = gsl_splinalg_ldlt_decomp(A, w);
+  gsl_test(status, "mindeg dense ldlt N=%zu", N);
+
+  status = !(w->L->nz <= 3 * N);
+  gsl_test(status, "mindeg dense fill N=%zu nnz(L)=%zu", N, w->L->nz);
+
+  gsl_spmatrix_free(A);
+  gsl_permutation_free(perm);
+  gsl_splinalg_ldlt_free(w);
+} /* test_mindeg_dense() */
+
+/*
+test_lu()
+  Test the sparse LU solver on a random sparse matrix (shift = 0),
+and on a diagonally dominant one whose rows are shifted cyclically
+by shift, so that its diagonal is zero and pivoting is required; the
+matrix is factored again with the same analysis after it is scaled
+*/
+
+static void
+test_lu(const size_t N, const double density, const size_t shift,
+        const int format, const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_random_sparse(N, N, density, r);
+  gsl_spmatrix *A;
+  gsl_splinalg_lu_workspace *w = gsl_splinalg_lu_alloc(N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  char desc[64];
+  size_t i, k;
+  int status;
+
+  sprintf(desc, "lu format=%d shift=%zu", format, shift);
+
+  if (shift > 0)
+    {
+      /* make T diagonally dominant, then move row i to row i + shift */
+      for (i = 0; i < N; ++i)
+        gsl_spmatrix_set(T, i, i, N * density + 1.0);
+
+      for (k = 0; k < T->nz; ++k)
+        T->i[k] = (T->i[k] + shift) % N;
+
+      gsl_spmatrix_tree_rebuild(T);
+    }
+
+  if (format == 1)
+    A = gsl_spmatrix_ccs(T);
+  else if (format == 2)
+    A = gsl_spmatrix_crs(T);
+  else
+    A = T;
+
+  create_random_vector(b, r);
+
+  status = gsl_splinalg_lu_symbolic(A, w);
+  gsl_test(status, "%s symbolic N=%zu", desc, N);
+
+  status = gsl_splinalg_lu_decomp(A, w);
+  gsl_test(status, "%s decomp N=%zu", desc, N);
+
+  status = gsl_splinalg_lu_solve(b, x, w);
+  gsl_test(status, "%s solve N=%zu", desc, N);
+
+  test_direct_residual(T, x, b, 1.0e-12, desc);
+
+  /* refactor 2 A with the same analysis */
+  gsl_spmatrix_scale(A, 2.0);
+  if (A != T)
+    gsl_spmatrix_scale(T, 2.0);
+
+  status = gsl_splinalg_lu_decomp(A, w);
+  gsl_test(status, "%s refactor N=%zu", desc, N);
+
+  gsl_splinalg_lu_solve(b, x, w);
+  test_direct_residual(T, x, b, 1.0e-12, desc);
+
+  if (A != T)
+    gsl_spmatrix_free(A);
+
+  gsl_spmatrix_free(T);
+  gsl_splinalg_lu_free(w);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+} /* test_lu() */
+
+/* y = A x for the tridiagonal matrix tridiag(-1, 2, -1) */
+static int
+laplace_func(const gsl_vector *x, void *params, gsl_vector *y)
+{
+  const size_t N = x->size;
+  size_t i;
+
+  (void) params;
+
+  for (i = 0; i < N; ++i)
+    {
+      double yi = 2.0 * gsl_vector_get(x, i);
+
+      if (i > 0)
+        yi -= gsl_vector_get(x, i - 1);
+
+      if (i < N - 1)
+        yi -= gsl_vector_get(x, i + 1);
+
+      gsl_vector_set(y, i, yi);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+test_eigen_symm()
+  Test the symmetric sparse eigensolver on tridiag(-1, 2, -1), whose
+eigenvalues are 2 - 2 cos(k pi / (N + 1)), k = 1, ..., N; the matrix
+is applied by laplace_func() if format < 0
+*/
+
+static void
+test_eigen_symm(const size_t N, const size_t nev,
+                const gsl_splinalg_eigen_target_t target, const double sigma,
+                const int format)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc(N, N);
+  gsl_spmatrix *A;
+  gsl_splinalg_eigen_workspace *w = gsl_splinalg_eigen_alloc(N, nev, 0);
+  gsl_vector *eval = gsl_vector_alloc(nev);
+  gsl_matrix *evec = gsl_matrix_alloc(N, nev);
+  gsl_vector *lambda = gsl_vector_alloc(N);
+  gsl_vector *r = gsl_vector_alloc(N);
+  char desc[64];
+  size_t i, k;
+  int status;
+
+  sprintf(desc, "eigen symm target=%d format=%d", (int) target, format);
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_spmatrix_set(T, i, i, 2.0);
+
+      if (i > 0)
+        gsl_spmatrix_set(T, i, i - 1, -1.0);
+
+      if (i < N - 1)
+        gsl_spmatrix_set(T, i, i + 1, -1.0);
+    }
+
+  if (format == 1)
+    A = gsl_spmatrix_ccs(T);
+  else if (format == 2)
+    A = gsl_spmatrix_crs(T);
+  else
+    A = T;
+
+  if (format < 0)
+    {
+      gsl_splinalg_eigen_function F;
+
+      F.f = laplace_func;
+      F.n = N;
+      F.params = NULL;
+
+      status = gsl_splinalg_eigen_symm_f(&F, target, sigma, eval, evec, w);
+    }
+  else
+    {
+      status = gsl_splinalg_eigen_symm(A, target, sigma, eval, evec, w);
+    }
+
+  gsl_test(status, "%s status N=%zu nev=%zu niter=%zu", desc, N, nev,
+           w->niter);
+
+  /* exact eigenvalues, in the order of the target */
+  for (i = 0; i < N; ++i)
+    {
+      double li = 2.0 - 2.0 * cos((i + 1.0) * M_PI / (N + 1.0));
+
+      if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+        li = fabs(li - sigma);
+
+      gsl_vector_set(lambda, i, li);
+    }
+
+  gsl_sort_vector(lambda);
+  if (target == GSL_SPLINALG_EIGEN_LARGEST ||
+      target == GSL_SPLINALG_EIGEN_LARGEST_ABS)
+    gsl_vector_reverse(lambda);
+
+  for (k = 0; k < nev; ++k)
+    {
+      const double ek = gsl_vector_get(eval, k);
+      gsl_vector_view v = gsl_matrix_column(evec, k);
+      double expected = gsl_vector_get(lambda, k);
+      double normr;
+
+      if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+        gsl_test_rel(fabs(ek - sigma), expected, 1.0e-8,
+                     "%s distance N=%zu k=%zu", desc, N, k);
+      else
+        gsl_test_rel(ek, expected, 1.0e-8, "%s eval N=%zu k=%zu",
+                     desc, N, k);
+
+      gsl_test_rel(gsl_blas_dnrm2(&v.vector), 1.0, 1.0e-10,
+                   "%s norm N=%zu k=%zu", desc, N, k);
+
+      /* r = A v - lambda v */
+      gsl_spblas_dgemv(CblasNoTrans, 1.0, T, &v.vector, 0.0, r);
+      gsl_blas_daxpy(-ek, &v.vector, r);
+      normr = gsl_blas_dnrm2(r);
+
+      gsl_test(normr > 1.0e-8, "%s residual N=%zu k=%zu normr=%.12e",
+               desc, N, k, normr);
+    }
+
+  if (A != T)
+    gsl_spmatrix_free(A);
+
+  gsl_spmatrix_free(T);
+  gsl_splinalg_eigen_free(w);
+  gsl_vector_free(eval);
+  gsl_matrix_free(evec);
+  gsl_vector_free(lambda);
+  gsl_vector_free(r);
+} /* test_eigen_symm() */
+
+/*
+test_eigen_nonsymm()
+  Test the nonsymmetric sparse eigensolver on a random sparse matrix
+with density, plus d on the diagonal; the moduli of the eigenvalues
+are compared with those of gsl_eigen_nonsymm() for the largest
+magnitude target, and the residuals ||A v - lambda v|| are checked
+*/
+
+static void
+test_eigen_nonsymm(const size_t N, const size_t nev, const double density,
+                   const double d, const gsl_splinalg_eigen_target_t target,
+                   const double sigma, const gsl_rng *rng)
+{
+  gsl_spmatrix *T = create_random_sparse(N, N, density, rng);
+  gsl_spmatrix *A;
+  gsl_splinalg_eigen_workspace *w = gsl_splinalg_eigen_alloc(N, nev, 0);
+  gsl_vector_complex *eval = gsl_vector_complex_alloc(nev);
+  gsl_matrix_complex *evec = gsl_matrix_complex_alloc(N, nev);
+  gsl_matrix *D = gsl_matrix_alloc(N, N);
+  gsl_vector_complex *deval = gsl_vector_complex_alloc(N);
+  gsl_eigen_nonsymm_workspace *dw = gsl_eigen_nonsymm_alloc(N);
+  gsl_vector *lambda = gsl_vector_alloc(N);
+  gsl_vector *rr = gsl_vector_alloc(N);
+  gsl_vector *ri = gsl_vector_alloc(N);
+  char desc[64];
+  size_t i, k;
+  int status;
+
+  sprintf(desc, "eigen nonsymm target=%d d=%g", (int) target, d);
+
+  for (i = 0; i < N; ++i)
+    {
+      double *Aii = gsl_spmatrix_ptr(T, i, i);
+
+      if (Aii)
+        *Aii += d;
+      else
+        gsl_spmatrix_set(T, i, i, d);
+    }
+
+  A = gsl_spmatrix_ccs(T);
+
+  status = gsl_splinalg_eigen_nonsymm(A, target, sigma, eval, evec, w);
+  gsl_test(status, "%s status N=%zu nev=%zu niter=%zu", desc, N, nev,
+           w->niter);
+
+  /* reference: distances from sigma, or moduli, of all eigenvalues */
+  gsl_spmatrix_sp2d(D, T);
+  gsl_eigen_nonsymm(D, deval, dw);
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_complex z = gsl_vector_complex_get(deval, i);
+
+      if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+        z = gsl_complex_sub_real(z, sigma);
+
+      gsl_vector_set(lambda, i, gsl_complex_abs(z));
+    }
+
+  gsl_sort_vector(lambda);
+  if (target == GSL_SPLINALG_EIGEN_LARGEST_ABS)
+    gsl_vector_reverse(lambda);
+
+  for (k = 0; k < nev; ++k)
+    {
+      gsl_complex ek = gsl_vector_complex_get(eval, k);
+      gsl_vector_complex_view v = gsl_matrix_complex_column(evec, k);
+      gsl_vector_view vr = gsl_vector_complex_real(&v.vector);
+      gsl_vector_view vi = gsl_vector_complex_imag(&v.vector);
+      gsl_complex z = ek;
+      double normv, normr;
+
+      if (target == GSL_SPLINALG_EIGEN_SHIFT_INVERT)
+        z = gsl_complex_sub_real(z, sigma);
+
+      gsl_test_rel(gsl_complex_abs(z), gsl_vector_get(lambda, k), 1.0e-8,
+                   "%s modulus N=%zu k=%zu", desc, N, k);
+
+      /* r = A v - lambda v, real and imaginary parts */
+      gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vr.vector, 0.0, rr);
+      gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vi.vector, 0.0, ri);
+      gsl_blas_daxpy(-GSL_REAL(ek), &vr.vector, rr);
+      gsl_blas_daxpy(GSL_IMAG(ek), &vi.vector, rr);
+      gsl_blas_daxpy(-GSL_REAL(ek), &vi.vector, ri);
+      gsl_blas_daxpy(-GSL_IMAG(ek), &vr.vector, ri);
+
+      normv = gsl_hypot(gsl_blas_dnrm2(&vr.vector), gsl_blas_dnrm2(&vi.vector));
+      normr = gsl_hypot(gsl_blas_dnrm2(rr), gsl_blas_dnrm2(ri));
+
+      gsl_test(normr > 1.0e-8 * normv * GSL_MAX(1.0, gsl_complex_abs(ek)),
+               "%s residual N=%zu k=%zu normr=%.12e", desc, N, k, normr);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_splinalg_eigen_free(w);
+  gsl_vector_complex_free(eval);
+  gsl_matrix_complex_free(evec);
+  gsl_matrix_free(D);
+  gsl_vector_complex_free(deval);
+  gsl_eigen_nonsymm_free(dw);
+  gsl_vector_free(lambda);
+  gsl_vector_free(rr);
+  gsl_vector_free(ri);
+} /* test_eigen_nonsymm() */
+
 int
 main()
 {
+  const gsl_splinalg_itersolve_type *types[5];
+  const gsl_splinalg_precon_type *ptypes[4];
   gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
-  size_t n;
+  size_t i, j, n;
+
+  types[0] = gsl_splinalg_itersolve_gmres;
+  types[1] = gsl_splinalg_itersolve_cg;
+  types[2] = gsl_splinalg_itersolve_bicgstab;
+  types[3] = gsl_splinalg_itersolve_minres;
+  types[4] = gsl_splinalg_itersolve_idrs;
+
+  ptypes[0] = gsl_splinalg_precon_jacobi;
+  ptypes[1] = gsl_splinalg_precon_ssor;
+  ptypes[2] = gsl_splinalg_precon_ilu0;
+  ptypes[3] = gsl_splinalg_precon_ic0;
+
+  for (i = 0; i < 5; ++i)
+    {
+      const gsl_splinalg_itersolve_type *T = types[i];
+
+      test_poisson(T, 7, 1.0e-1, 0);
+      test_poisson(T, 7, 1.0e-1, 1);
+
+      test_poisson(T, 543, 1.0e-5, 0);
+      test_poisson(T, 543, 1.0e-5, 1);
+
+      test_poisson(T, 1000, 1.0e-6, 0);
+      test_poisson(T, 1000, 1.0e-6, 1);
+
+      test_poisson(T, 5000, 1.0e-7, 0);
+      test_poisson(T, 5000, 1.0e-7, 1);
+
+      test_spd(T, NULL, 10, r);
+      test_spd(T, NULL, 200, r);
+      test_spd(T, NULL, 3000, r);
+
+      /* symmetric positive definite preconditioners */
+      for (j = 0; j < 4; ++j)
+        {
+          if (ptypes[j] == gsl_splinalg_precon_ilu0 &&
+              (T == gsl_splinalg_itersolve_cg ||
+               T == gsl_splinalg_itersolve_minres))
+            continue;
 
-  test_poisson(7, 1.0e-1, 0);
-  test_poisson(7, 1.0e-1, 1);
+          test_spd(T, ptypes[j], 200, r);
+          test_spd(T, ptypes[j], 3000, r);
+        }
+    }
+
+  /* nonsymmetric systems */
+  for (i = 0; i < 5; ++i)
+    {
+      const gsl_splinalg_itersolve_type *T = types[i];
+
+      if (T == gsl_splinalg_itersolve_cg || T == gsl_splinalg_itersolve_minres)
+        continue;
+
+      test_toeplitz(T, 15, 0.01, 1.0, 0.01);
+      test_toeplitz(T, 15, 1.0, 1.0, 0.01);
+      test_toeplitz(T, 50, 1.0, 2.0, 0.01);
+      test_toeplitz(T, 1000, 0.5, 1.0, 0.01);
+    }
+
+  /* these need more than the default GMRES(10) subspace */
+  test_convdiff(gsl_splinalg_itersolve_bicgstab, NULL, 10, 1.0);
+  test_convdiff(gsl_splinalg_itersolve_bicgstab, NULL, 40, 10.0);
+  test_convdiff(gsl_splinalg_itersolve_bicgstab, NULL, 60, 100.0);
 
-  test_poisson(543, 1.0e-5, 0);
-  test_poisson(543, 1.0e-5, 1);
+  test_convdiff(gsl_splinalg_itersolve_idrs, NULL, 10, 1.0);
+  test_convdiff(gsl_splinalg_itersolve_idrs, NULL, 40, 10.0);
+  test_convdiff(gsl_splinalg_itersolve_idrs, NULL, 60, 100.0);
+
+  /* nonsymmetric preconditioners; ILU(0) makes GMRES(10) converge */
+  for (i = 0; i < 5; ++i)
+    {
+      const gsl_splinalg_itersolve_type *T = types[i];
+
+      if (T == gsl_splinalg_itersolve_cg || T == gsl_splinalg_itersolve_minres)
+        continue;
+
+      test_convdiff(T, gsl_splinalg_precon_ilu0, 40, 10.0);
+      test_convdiff(T, gsl_splinalg_precon_ilu0, 60, 100.0);
+
+      if (T != gsl_splinalg_itersolve_gmres)
+        {
+          test_convdiff(T, gsl_splinalg_precon_jacobi, 40, 10.0);
+          test_convdiff(T, gsl_splinalg_precon_ssor, 40, 10.0);
+        }
+    }
 
-  test_poisson(1000, 1.0e-6, 0);
-  test_poisson(1000, 1.0e-6, 1);
+  /* symmetric indefinite systems */
+  test_indefinite(gsl_splinalg_itersolve_minres, NULL, 100, 50.0);
+  test_indefinite(gsl_splinalg_itersolve_minres, NULL, 1000, 200.0);
+  test_indefinite(gsl_splinalg_itersolve_minres, gsl_splinalg_precon_jacobi,
+                  1000, 200.0);
+  test_indefinite(gsl_splinalg_itersolve_minres, gsl_splinalg_precon_ssor,
+                  1000, 200.0);
 
-  test_poisson(5000, 1.0e-7, 0);
-  test_poisson(5000, 1.0e-7, 1);
+  /* preconditioners which are exact for tridiagonal matrices */
+  test_precon_tridiag(gsl_splinalg_precon_ilu0, 100, 0);
+  test_precon_tridiag(gsl_splinalg_precon_ilu0, 100, 1);
+  test_precon_tridiag(gsl_splinalg_precon_ic0, 100, 0);
+  test_precon_tridiag(gsl_splinalg_precon_ic0, 100, 1);
 
-  test_toeplitz(15, 0.01, 1.0, 0.01);
-  test_toeplitz(15, 1.0, 1.0, 0.01);
-  test_toeplitz(50, 1.0, 2.0, 0.01);
-  test_toeplitz(1000, 0.5, 1.0, 0.01);
+  test_precon_ssor(60, 1.0);
+  test_precon_ssor(60, 0.6);
+  test_precon_ssor(60, 1.5);
 
   for (n = 1; n <= 100; ++n)
     {
@@ -366,6 +1414,50 @@ main()
       test_random(n, r, 1);
     }
 
+  /* sparse direct solvers */
+  test_mindeg(10);
+  test_mindeg(40);
+  test_mindeg_dense(400);
+
+  for (i = 0; i < 3; ++i)
+    {
+      test_ldlt(10, i, 0, r);
+      test_ldlt(10, i, 1, r);
+      test_ldlt(500, i, 0, r);
+      test_ldlt(500, i, 1, r);
+
+      test_lu(10, 0.3, 0, i, r);
+      test_lu(10, 0.3, 3, i, r);
+      test_lu(500, 0.01, 0, i, r);
+      test_lu(500, 0.01, 7, i, r);
+    }
+
+  for (n = 1; n <= 30; ++n)
+    {
+      test_ldlt(n, 1, 1, r);
+      test_lu(n, 0.2, 0, 1, r);
+      test_lu(n, 0.2, n / 2, 0, r);
+    }
+
+  /* sparse eigensolvers */
+  for (i = 0; i < 3; ++i)
+    {
+      test_eigen_symm(100, 5, GSL_SPLINALG_EIGEN_LARGEST, 0.0, i);
+      test_eigen_symm(100, 5, GSL_SPLINALG_EIGEN_SHIFT_INVERT, 0.0, i);
+      test_eigen_symm(100, 4, GSL_SPLINALG_EIGEN_SHIFT_INVERT, 1.3, i);
+    }
+
+  test_eigen_symm(100, 3, GSL_SPLINALG_EIGEN_SMALLEST, 0.0, 1);
+  test_eigen_symm(400, 6, GSL_SPLINALG_EIGEN_LARGEST_ABS, 0.0, -1);
+  test_eigen_symm(10, 9, GSL_SPLINALG_EIGEN_LARGEST, 0.0, 1);
+
+  test_eigen_nonsymm(200, 6, 0.05, 0.0, GSL_SPLINALG_EIGEN_LARGEST_ABS,
+                     0.0, r);
+  test_eigen_nonsymm(200, 6, 0.05, 1.0, GSL_SPLINALG_EIGEN_SHIFT_INVERT,
+                     0.3, r);
+  test_eigen_nonsymm(30, 5, 0.2, 0.0, GSL_SPLINALG_EIGEN_LARGEST_ABS,
+                     0.0, r);
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
@@ -115,6 +115,13 @@ typedef struct
 #define GSL_SPMATRIX_CCS          (1)
 #define GSL_SPMATRIX_CRS          (2)
 
+/* flag for gsl_spmatrix_alloc_nzmax: triplet matrix without binary tree */
+#define GSL_SPMATRIX_NOTREE       (1 << 8)
+
+/* handling of duplicate entries in gsl_spmatrix_assemble */
+#define GSL_SPMATRIX_SUM          (0)
+#define GSL_SPMATRIX_REPLACE      (1)
+
 #define GSL_SPMATRIX_ISTRIPLET(m) ((m)->sptype == GSL_SPMATRIX_TRIPLET)
 #define GSL_SPMATRIX_ISCCS(m)     ((m)->sptype == GSL_SPMATRIX_CCS)
 #define GSL_SPMATRIX_ISCRS(m)     ((m)->sptype == GSL_SPMATRIX_CRS)
@@ -149,13 +156,21 @@ gsl_spmatrix *gsl_spmatrix_compcol(const gsl_spmatrix *T);
 gsl_spmatrix *gsl_spmatrix_ccs(const gsl_spmatrix *T);
 gsl_spmatrix *gsl_spmatrix_crs(const gsl_spmatrix *T);
 void gsl_spmatrix_cumsum(const size_t n, size_t *c);
+int gsl_spmatrix_compress(gsl_spmatrix *A_ccs, gsl_spmatrix *A_crs,
+                          const gsl_spmatrix *T);
+int gsl_spmatrix_assemble(gsl_spmatrix *T, const size_t *rows,
+                          const size_t *cols, const double *vals,
+                          const size_t n, const int mode);
 
 /* spio.c */
 int gsl_spmatrix_fprintf(FILE *stream, const gsl_spmatrix *m,
                          const char *format);
 gsl_spmatrix * gsl_spmatrix_fscanf(FILE *stream);
+gsl_spmatrix * gsl_spmatrix_fscanf_ccs(FILE *stream);
+gsl_spmatrix * gsl_spmatrix_fscanf_crs(FILE *stream);
 int gsl_spmatrix_fwrite(FILE *stream, const gsl_spmatrix *m);
 int gsl_spmatrix_fread(FILE *stream, gsl_spmatrix *m);
+gsl_spmatrix * gsl_spmatrix_fread_alloc(FILE *stream);
 
 /* spoper.c */
 int gsl_spmatrix_scale(gsl_spmatrix *m, const double x);
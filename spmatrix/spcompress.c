@@ -24,6 +24,14 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_spmatrix.h>
 
+static size_t compress_dupl(const size_t n, const size_t nminor, size_t *Ap,
+                            size_t *Ai, double *Ad, size_t *w);
+static int triplet_sort(gsl_spmatrix *T, const int mode);
+static void compress_transpose(const size_t n, const size_t nout,
+                               const size_t *Ap, const size_t *Ai,
+                               const double *Ad, size_t *Bp, size_t *Bi,
+                               double *Bd, size_t *w);
+
 /*
 gsl_spmatrix_ccs()
   Create a sparse matrix in compressed column format
@@ -83,7 +91,16 @@ gsl_spmatrix_ccs(const gsl_spmatrix *T)
           m->data[k] = T->data[n];
         }
 
-      m->nz = T->nz;
+      if (T->tree_data == NULL)
+        {
+          /* no binary tree; sum duplicate entries in each column */
+          m->nz = compress_dupl(m->size2, m->size1, Cp, m->i, m->data,
+                                (size_t *) m->work);
+        }
+      else
+        {
+          m->nz = T->nz;
+        }
 
       return m;
     }
@@ -154,12 +171,436 @@ gsl_spmatrix_crs(const gsl_spmatrix *T)
           m->data[k] = T->data[n];
         }
 
-      m->nz = T->nz;
+      if (T->tree_data == NULL)
+        {
+          /* no binary tree; sum duplicate entries in each row */
+          m->nz = compress_dupl(m->size1, m->size2, Cp, m->i, m->data,
+                                (size_t *) m->work);
+        }
+      else
+        {
+          m->nz = T->nz;
+        }
 
       return m;
     }
 }
 
+/*
+gsl_spmatrix_compress()
+  Convert a triplet matrix to compressed column and/or compressed
+row format, with sorted indices and duplicate entries summed
+
+Inputs: A_ccs - (output) matrix in CCS format, or NULL
+        A_crs - (output) matrix in CRS format, or NULL
+        T     - sparse matrix in triplet format
+
+Return: success or error
+
+Notes:
+1) The triplets are scattered into CRS by row, and duplicates are
+summed with a marker array. Transposing the rows gives CCS with the
+row indices of each column in increasing order, and transposing that
+back gives CRS with sorted column indices. Each step is a counting
+pass, a cumulative sum and a scatter, so the cost is O(nz + size1 +
+size2), and both formats together cost one more scatter than one.
+
+2) The outputs must have the dimensions of T, and are reallocated
+if their nzmax is smaller than T->nz
+*/
+
+int
+gsl_spmatrix_compress(gsl_spmatrix *A_ccs, gsl_spmatrix *A_crs,
+                      const gsl_spmatrix *T)
+{
+  if (!GSL_SPMATRIX_ISTRIPLET(T))
+    {
+      GSL_ERROR("matrix must be in triplet format", GSL_EINVAL);
+    }
+  else if (A_ccs != NULL && !GSL_SPMATRIX_ISCCS(A_ccs))
+    {
+      GSL_ERROR("A_ccs must be in compressed column format", GSL_EINVAL);
+    }
+  else if (A_crs != NULL && !GSL_SPMATRIX_ISCRS(A_crs))
+    {
+      GSL_ERROR("A_crs must be in compressed row format", GSL_EINVAL);
+    }
+  else if ((A_ccs != NULL && (A_ccs->size1 != T->size1 ||
+                              A_ccs->size2 != T->size2)) ||
+           (A_crs != NULL && (A_crs->size1 != T->size1 ||
+                              A_crs->size2 != T->size2)))
+    {
+      GSL_ERROR("matrix sizes do not match", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t M = T->size1;
+      const size_t N = T->size2;
+      int s = GSL_SUCCESS;
+      gsl_spmatrix *C = A_ccs;
+      gsl_spmatrix *R = A_crs;
+      size_t *w;
+      size_t n;
+
+      /* temporary matrices for the formats not requested */
+      if (C == NULL)
+        C = gsl_spmatrix_alloc_nzmax(M, N, T->nz, GSL_SPMATRIX_CCS);
+      else if (C->nzmax < T->nz)
+        s = gsl_spmatrix_realloc(T->nz, C);
+
+      if (R == NULL)
+        R = gsl_spmatrix_alloc_nzmax(M, N, T->nz, GSL_SPMATRIX_CRS);
+      else if (!s && R->nzmax < T->nz)
+        s = gsl_spmatrix_realloc(T->nz, R);
+
+      if (C == NULL || R == NULL)
+        {
+          if (C != A_ccs)
+            gsl_spmatrix_free(C);
+          if (R != A_crs)
+            gsl_spmatrix_free(R);
+          GSL_ERROR("failed to allocate space for compressed matrix",
+                    GSL_ENOMEM);
+        }
+
+      if (!s)
+        {
+          w = (size_t *) R->work;
+
+          /* scatter the triplets into CRS, in the order of T */
+          for (n = 0; n < M + 1; ++n)
+            R->p[n] = 0;
+
+          for (n = 0; n < T->nz; ++n)
+            R->p[T->i[n]]++;
+
+          gsl_spmatrix_cumsum(M, R->p);
+
+          for (n = 0; n < M; ++n)
+            w[n] = R->p[n];
+
+          for (n = 0; n < T->nz; ++n)
+            {
+              size_t k = w[T->i[n]]++;
+              R->i[k] = T->p[n];
+              R->data[k] = T->data[n];
+            }
+
+          /* sum duplicate entries in each row */
+          R->nz = compress_dupl(M, N, R->p, R->i, R->data, w);
+
+          /* transpose to CCS, which sorts the row indices */
+          compress_transpose(M, N, R->p, R->i, R->data,
+                             C->p, C->i, C->data, w);
+          C->nz = R->nz;
+
+          /* and back to CRS, which sorts the column indices */
+          if (A_crs != NULL)
+            compress_transpose(N, M, C->p, C->i, C->data,
+                               R->p, R->i, R->data, w);
+        }
+
+      if (C != A_ccs)
+        gsl_spmatrix_free(C);
+      if (R != A_crs)
+        gsl_spmatrix_free(R);
+
+      return s;
+    }
+} /* gsl_spmatrix_compress() */
+
+/*
+compress_transpose()
+  Transpose a compressed matrix, switching its major
+
+Inputs: n    - number of columns (CCS) or rows (CRS) of A
+        nout - number of columns or rows of B
+        Ap   - column or row pointers of A, length n + 1
+        Ai   - row or column indices of A
+        Ad   - data of A
+        Bp   - (output) pointers of B, length nout + 1
+        Bi   - (output) indices of B
+        Bd   - (output) data of B
+        w    - workspace, length nout
+
+Notes: the columns or rows of A are visited in order, so the
+indices within each column or row of B are increasing
+*/
+
+static void
+compress_transpose(const size_t n, const size_t nout, const size_t *Ap,
+                   const size_t *Ai, const double *Ad, size_t *Bp,
+                   size_t *Bi, double *Bd, size_t *w)
+{
+  size_t j, k;
+
+  for (k = 0; k < nout + 1; ++k)
+    Bp[k] = 0;
+
+  for (k = 0; k < Ap[n]; ++k)
+    Bp[Ai[k]]++;
+
+  gsl_spmatrix_cumsum(nout, Bp);
+
+  for (k = 0; k < nout; ++k)
+    w[k] = Bp[k];
+
+  for (j = 0; j < n; ++j)
+    {
+      for (k = Ap[j]; k < Ap[j + 1]; ++k)
+        {
+          size_t q = w[Ai[k]]++;
+          Bi[q] = j;
+          Bd[q] = Ad[k];
+        }
+    }
+} /* compress_transpose() */
+
+/*
+gsl_spmatrix_assemble()
+  Add a batch of triplets to a triplet matrix
+
+Inputs: T    - sparse matrix in triplet format
+        rows - row indices, length n
+        cols - column indices, length n
+        vals - matrix values, length n
+        n    - number of triplets
+        mode - handling of duplicate entries, either within the
+               batch or with elements already in T:
+               GSL_SPMATRIX_SUM     - values are added
+               GSL_SPMATRIX_REPLACE - the last value is kept
+
+Return: success or error
+
+Notes:
+1) Instead of one binary tree insertion per element as in
+gsl_spmatrix_set(), all elements of T are sorted by row and column
+with two counting sorts, duplicates are merged, and the binary tree
+is rebuilt directly from the sorted elements, in
+O(nz + size1 + size2) time
+
+2) If T has no binary tree (GSL_SPMATRIX_NOTREE) and mode is
+GSL_SPMATRIX_SUM, the triplets are only appended, and duplicates
+are summed when T is compressed
+
+3) As in gsl_spmatrix_set(), the dimensions of T are increased as
+needed to hold the new elements
+*/
+
+int
+gsl_spmatrix_assemble(gsl_spmatrix *T, const size_t *rows,
+                      const size_t *cols, const double *vals,
+                      const size_t n, const int mode)
+{
+  if (!GSL_SPMATRIX_ISTRIPLET(T))
+    {
+      GSL_ERROR("matrix must be in triplet format", GSL_EINVAL);
+    }
+  else if (mode != GSL_SPMATRIX_SUM && mode != GSL_SPMATRIX_REPLACE)
+    {
+      GSL_ERROR("unknown mode for duplicate entries", GSL_EINVAL);
+    }
+  else
+    {
+      int s = GSL_SUCCESS;
+      size_t k;
+
+      /* check if matrix needs to be realloced */
+      if (T->nz + n > T->nzmax)
+        {
+          s = gsl_spmatrix_realloc(GSL_MAX(T->nz + n, 2 * T->nzmax), T);
+          if (s)
+            return s;
+        }
+
+      /* append the triplets */
+      for (k = 0; k < n; ++k)
+        {
+          T->i[T->nz + k] = rows[k];
+          T->p[T->nz + k] = cols[k];
+          T->data[T->nz + k] = vals[k];
+
+          /* increase matrix dimensions if needed */
+          T->size1 = GSL_MAX(T->size1, rows[k] + 1);
+          T->size2 = GSL_MAX(T->size2, cols[k] + 1);
+        }
+
+      T->nz += n;
+
+      if (T->tree_data == NULL && mode == GSL_SPMATRIX_SUM)
+        return s;
+
+      /* sort elements, merge duplicates, and rebuild the tree */
+      s = triplet_sort(T, mode);
+      if (s)
+        return s;
+
+      s = gsl_spmatrix_tree_rebuild(T);
+
+      return s;
+    }
+} /* gsl_spmatrix_assemble() */
+
+/*
+triplet_sort()
+  Sort the elements of a triplet matrix by row and then column
+index and merge duplicate entries
+
+Inputs: T    - triplet matrix
+        mode - GSL_SPMATRIX_SUM or GSL_SPMATRIX_REPLACE
+
+Notes: the elements are sorted with a stable counting sort on the
+column index followed by one on the row index, so that duplicates
+remain in the order in which they were added, and the last one
+is kept by GSL_SPMATRIX_REPLACE
+*/
+
+static int
+triplet_sort(gsl_spmatrix *T, const int mode)
+{
+  const size_t nz = T->nz;
+  const size_t ncount = GSL_MAX(T->size1, T->size2) + 1;
+  size_t *count, *ti, *tj;
+  double *td;
+  size_t k, q;
+
+  if (nz == 0)
+    return GSL_SUCCESS;
+
+  count = malloc(ncount * sizeof(size_t));
+  ti = malloc(nz * sizeof(size_t));
+  tj = malloc(nz * sizeof(size_t));
+  td = malloc(nz * sizeof(double));
+  if (!count || !ti || !tj || !td)
+    {
+      free(count);
+      free(ti);
+      free(tj);
+      free(td);
+      GSL_ERROR("failed to allocate space for sorting", GSL_ENOMEM);
+    }
+
+  /* sort by column index into (ti,tj,td) */
+  for (k = 0; k <= T->size2; ++k)
+    count[k] = 0;
+
+  for (k = 0; k < nz; ++k)
+    count[T->p[k]]++;
+
+  gsl_spmatrix_cumsum(T->size2, count);
+
+  for (k = 0; k < nz; ++k)
+    {
+      q = count[T->p[k]]++;
+      ti[q] = T->i[k];
+      tj[q] = T->p[k];
+      td[q] = T->data[k];
+    }
+
+  /* sort by row index back into T */
+  for (k = 0; k <= T->size1; ++k)
+    count[k] = 0;
+
+  for (k = 0; k < nz; ++k)
+    count[ti[k]]++;
+
+  gsl_spmatrix_cumsum(T->size1, count);
+
+  for (k = 0; k < nz; ++k)
+    {
+      q = count[ti[k]]++;
+      T->i[q] = ti[k];
+      T->p[q] = tj[k];
+      T->data[q] = td[k];
+    }
+
+  /* merge duplicates, which are now adjacent */
+  q = 0;
+  for (k = 0; k < nz; ++k)
+    {
+      if (q > 0 && T->i[k] == T->i[q - 1] && T->p[k] == T->p[q - 1])
+        {
+          if (mode == GSL_SPMATRIX_SUM)
+            T->data[q - 1] += T->data[k];
+          else
+            T->data[q - 1] = T->data[k];
+        }
+      else
+        {
+          T->i[q] = T->i[k];
+          T->p[q] = T->p[k];
+          T->data[q] = T->data[k];
+          ++q;
+        }
+    }
+
+  T->nz = q;
+
+  free(count);
+  free(ti);
+  free(tj);
+  free(td);
+
+  return GSL_SUCCESS;
+} /* triplet_sort() */
+
+/*
+compress_dupl()
+  Sum duplicate entries of a compressed matrix in place
+
+Inputs: n      - number of columns (CCS) or rows (CRS)
+        nminor - number of rows (CCS) or columns (CRS)
+        Ap     - (input/output) column or row pointers, length n + 1
+        Ai     - (input/output) row or column indices
+        Ad     - (input/output) data
+        w      - workspace, length nminor
+
+Return: number of elements after summing duplicates
+
+Notes: w[i] holds one past the position of minor index i in the
+output, so that w[i] > start of the current column or row means
+i has already been seen there
+*/
+
+static size_t
+compress_dupl(const size_t n, const size_t nminor, size_t *Ap,
+              size_t *Ai, double *Ad, size_t *w)
+{
+  size_t j, k, q = 0;
+
+  for (k = 0; k < nminor; ++k)
+    w[k] = 0;
+
+  for (j = 0; j < n; ++j)
+    {
+      const size_t q0 = q;
+
+      for (k = Ap[j]; k < Ap[j + 1]; ++k)
+        {
+          const size_t i = Ai[k];
+
+          if (w[i] > q0)
+            {
+              /* duplicate entry */
+              Ad[w[i] - 1] += Ad[k];
+            }
+          else
+            {
+              w[i] = q + 1;
+              Ai[q] = i;
+              Ad[q] = Ad[k];
+              ++q;
+            }
+        }
+
+      Ap[j] = q0;
+    }
+
+  Ap[n] = q;
+
+  return q;
+} /* compress_dupl() */
+
 /*
 gsl_spmatrix_cumsum()
 
@@ -64,6 +64,9 @@ gsl_spmatrix_memcpy(gsl_spmatrix *dest, const gsl_spmatrix *src)
               dest->data[n] = src->data[n];
 
               /* copy binary tree data */
+              if (dest->tree_data == NULL)
+                continue;
+
               ptr = avl_insert(dest->tree_data->tree, &dest->data[n]);
               if (ptr != NULL)
                 {
@@ -49,11 +49,19 @@ gsl_spmatrix_get(const gsl_spmatrix *m, const size_t i, const size_t j)
     {
       if (GSL_SPMATRIX_ISTRIPLET(m))
         {
-          /* traverse binary tree to search for (i,j) element */
-          void *ptr = tree_find(m, i, j);
-          double x = ptr ? *(double *) ptr : 0.0;
+          if (m->tree_data == NULL)
+            {
+              GSL_ERROR_VAL("matrix has no binary tree for element lookup",
+                            GSL_EINVAL, 0.0);
+            }
+          else
+            {
+              /* traverse binary tree to search for (i,j) element */
+              void *ptr = tree_find(m, i, j);
+              double x = ptr ? *(double *) ptr : 0.0;
 
-          return x;
+              return x;
+            }
         }
       else if (GSL_SPMATRIX_ISCCS(m))
         {
@@ -99,6 +107,10 @@ Inputs: m - spmatrix
         i - row index
         j - column index
         x - matrix value
+
+Notes: if m has no binary tree (GSL_SPMATRIX_NOTREE), the triplet
+is appended without searching for an existing (i,j) entry; duplicate
+entries are summed when the matrix is compressed
 */
 
 int
@@ -109,6 +121,34 @@ gsl_spmatrix_set(gsl_spmatrix *m, const size_t i, const size_t j,
     {
       GSL_ERROR("matrix not in triplet representation", GSL_EINVAL);
     }
+  else if (m->tree_data == NULL)
+    {
+      int s = GSL_SUCCESS;
+
+      if (x == 0.0)
+        return s;
+
+      /* check if matrix needs to be realloced */
+      if (m->nz >= m->nzmax)
+        {
+          s = gsl_spmatrix_realloc(2 * m->nzmax, m);
+          if (s)
+            return s;
+        }
+
+      /* append the triplet (i, j, x) */
+      m->i[m->nz] = i;
+      m->p[m->nz] = j;
+      m->data[m->nz] = x;
+
+      /* increase matrix dimensions if needed */
+      m->size1 = GSL_MAX(m->size1, i + 1);
+      m->size2 = GSL_MAX(m->size2, j + 1);
+
+      ++(m->nz);
+
+      return s;
+    }
   else if (x == 0.0)
     {
       /* traverse binary tree to search for (i,j) element */
@@ -179,9 +219,17 @@ gsl_spmatrix_ptr(gsl_spmatrix *m, const size_t i, const size_t j)
     {
       if (GSL_SPMATRIX_ISTRIPLET(m))
         {
-          /* traverse binary tree to search for (i,j) element */
-          void *ptr = tree_find(m, i, j);
-          return (double *) ptr;
+          if (m->tree_data == NULL)
+            {
+              GSL_ERROR_NULL("matrix has no binary tree for element lookup",
+                             GSL_EINVAL);
+            }
+          else
+            {
+              /* traverse binary tree to search for (i,j) element */
+              void *ptr = tree_find(m, i, j);
+              return (double *) ptr;
+            }
         }
       else if (GSL_SPMATRIX_ISCCS(m))
         {
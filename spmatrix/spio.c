@@ -1,31 +1,74 @@
 /* spio.c
- * 
+ *
  * Copyright (C) 2016 Patrick Alken
  * Copyright (C) 2016 Alexis Tantet
- * 
+ *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation; either version 3 of the License, or (at
  * your option) any later version.
- * 
+ *
  * This program is distributed in the hope that it will be useful, but
  * WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
  * General Public License for more details.
- * 
+ *
  * You should have received a copy of the GNU General Public License
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
 #include <config.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_spmatrix.h>
 
+/*
+ * The MatrixMarket files are read and written in chunks of
+ * SPIO_CHUNK bytes. A chunk which is read is cut after its last
+ * complete line and parsed with the functions below, which are much
+ * faster than sscanf(); the rest of the line is kept for the next
+ * chunk. The elements are stored directly in the arrays of a triplet
+ * matrix, which is then sorted or compressed in O(nz) time.
+ */
+
+#define SPIO_CHUNK      65536
+
+/* room needed in the output buffer for the indices of one element */
+#define SPIO_INDEX_MAX  64
+
+/* symmetry of a MatrixMarket file */
+#define SPIO_GENERAL    0
+#define SPIO_SYMMETRIC  1
+#define SPIO_SKEW       2
+
+/*
+ * first word of the binary format written by gsl_spmatrix_fwrite(),
+ * which cannot be the number of rows of the older format without a
+ * storage type
+ */
+#define SPIO_MAGIC      ((size_t) -1)
+
+static int spio_read_header(FILE *stream, size_t *size1, size_t *size2,
+                            size_t *nz, int *pattern, int *symmetry);
+static gsl_spmatrix *spio_read(FILE *stream, const size_t sptype);
+static int spio_read_entries(FILE *stream, gsl_spmatrix *m,
+                             const size_t nz, const int pattern,
+                             const int symmetry);
+static int spio_parse(const char *c, const char *end, gsl_spmatrix *m,
+                      const int pattern, const int symmetry,
+                      size_t *nread, const size_t nz);
+static int spio_parse_index(const char **s, size_t *x);
+static int spio_parse_double(const char **s, double *x);
+static size_t spio_utoa(char *s, size_t x);
+static int spio_fread_data(FILE *stream, gsl_spmatrix *m,
+                           const size_t nz);
+
 /*
 gsl_spmatrix_fprintf()
   Print sparse matrix to file in MatrixMarket format:
@@ -35,14 +78,27 @@ I1 J1 A(I1,J1)
 ...
 
 Note that indices start at 1 and not 0
+
+Notes: the lines are formatted into a buffer which is written with
+one fwrite() per SPIO_CHUNK bytes; the indices are converted by
+spio_utoa(), so that the format string is only parsed for the value
 */
 
 int
 gsl_spmatrix_fprintf(FILE *stream, const gsl_spmatrix *m,
                      const char *format)
 {
+  const size_t nmajor = GSL_SPMATRIX_ISCRS(m) ? m->size1 : m->size2;
+  char *buf;
+  size_t len, k, n;
   int status;
 
+  if (!GSL_SPMATRIX_ISTRIPLET(m) && !GSL_SPMATRIX_ISCCS(m) &&
+      !GSL_SPMATRIX_ISCRS(m))
+    {
+      GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
+    }
+
   /* print header */
   status = fprintf(stream, "%%%%MatrixMarket matrix coordinate real general\n");
   if (status < 0)
@@ -51,190 +107,190 @@ gsl_spmatrix_fprintf(FILE *stream, const gsl_spmatrix *m,
     }
 
   /* print rows,columns,nnz */
-  status = fprintf(stream, "%u\t%u\t%u\n",
-                   (unsigned int) m->size1,
-                   (unsigned int) m->size2,
-                   (unsigned int) m->nz);
+  status = fprintf(stream, "%lu\t%lu\t%lu\n",
+                   (unsigned long) m->size1,
+                   (unsigned long) m->size2,
+                   (unsigned long) m->nz);
   if (status < 0)
     {
       GSL_ERROR("fprintf failed for dimension header", GSL_EFAILED);
     }
 
-  if (GSL_SPMATRIX_ISTRIPLET(m))
+  buf = malloc(SPIO_CHUNK);
+  if (!buf)
+    {
+      GSL_ERROR("failed to allocate space for output buffer", GSL_ENOMEM);
+    }
+
+  len = 0;
+  k = 0;
+
+  for (n = 0; n < m->nz; ++n)
     {
-      size_t n;
+      size_t i, j, start = len;
+      int nc;
 
-      for (n = 0; n < m->nz; ++n)
+      if (GSL_SPMATRIX_ISTRIPLET(m))
         {
-          status = fprintf(stream, "%u\t%u\t", (unsigned int) m->i[n] + 1, (unsigned int) m->p[n] + 1);
-          if (status < 0)
-            {
-              GSL_ERROR("fprintf failed", GSL_EFAILED);
-            }
+          i = m->i[n];
+          j = m->p[n];
+        }
+      else
+        {
+          /* k is the column (CCS) or row (CRS) containing element n */
+          while (k < nmajor && m->p[k + 1] <= n)
+            ++k;
 
-          status = fprintf(stream, format, m->data[n]);
-          if (status < 0)
-            {
-              GSL_ERROR("fprintf failed", GSL_EFAILED);
-            }
+          i = GSL_SPMATRIX_ISCCS(m) ? m->i[n] : k;
+          j = GSL_SPMATRIX_ISCCS(m) ? k : m->i[n];
+        }
 
-          status = putc('\n', stream);
-          if (status == EOF)
+      if (SPIO_CHUNK - len < SPIO_INDEX_MAX + 32)
+        {
+          if (fwrite(buf, 1, len, stream) != len)
             {
-              GSL_ERROR("putc failed", GSL_EFAILED);
+              free(buf);
+              GSL_ERROR("fwrite failed", GSL_EFAILED);
             }
+
+          len = start = 0;
         }
-    }
-  else if (GSL_SPMATRIX_ISCCS(m))
-    {
-      size_t j, p;
 
-      for (j = 0; j < m->size2; ++j)
+      len += spio_utoa(buf + len, i + 1);
+      buf[len++] = '\t';
+      len += spio_utoa(buf + len, j + 1);
+      buf[len++] = '\t';
+
+      nc = snprintf(buf + len, SPIO_CHUNK - len, format, m->data[n]);
+      if (nc >= 0 && (size_t) nc >= SPIO_CHUNK - len && start > 0)
         {
-          for (p = m->p[j]; p < m->p[j + 1]; ++p)
+          /* no room for the value: write out the previous lines, move
+           * the indices of this one to the front and try again */
+          if (fwrite(buf, 1, start, stream) != start)
             {
-              status = fprintf(stream, "%u\t%u\t", (unsigned int) m->i[p] + 1, (unsigned int) j + 1);
-              if (status < 0)
-                {
-                  GSL_ERROR("fprintf failed", GSL_EFAILED);
-                }
+              free(buf);
+              GSL_ERROR("fwrite failed", GSL_EFAILED);
+            }
 
-              status = fprintf(stream, format, m->data[p]);
-              if (status < 0)
-                {
-                  GSL_ERROR("fprintf failed", GSL_EFAILED);
-                }
+          memmove(buf, buf + start, len - start);
+          len -= start;
+          start = 0;
 
-              status = putc('\n', stream);
-              if (status == EOF)
-                {
-                  GSL_ERROR("putc failed", GSL_EFAILED);
-                }
-            }
+          nc = snprintf(buf + len, SPIO_CHUNK - len, format, m->data[n]);
         }
-    }
-  else if (GSL_SPMATRIX_ISCRS(m))
-    {
-      size_t i, p;
 
-      for (i = 0; i < m->size1; ++i)
+      if (nc < 0 || (size_t) nc >= SPIO_CHUNK - len)
         {
-          for (p = m->p[i]; p < m->p[i + 1]; ++p)
-            {
-              status = fprintf(stream, "%u\t%u\t", (unsigned int) i + 1, (unsigned int) m->i[p] + 1);
-              if (status < 0)
-                {
-                  GSL_ERROR("fprintf failed", GSL_EFAILED);
-                }
-
-              status = fprintf(stream, format, m->data[p]);
-              if (status < 0)
-                {
-                  GSL_ERROR("fprintf failed", GSL_EFAILED);
-                }
-
-              status = putc('\n', stream);
-              if (status == EOF)
-                {
-                  GSL_ERROR("putc failed", GSL_EFAILED);
-                }
-            }
+          free(buf);
+          GSL_ERROR("failed to format matrix element", GSL_EFAILED);
         }
+
+      len += nc;
+      buf[len++] = '\n';
     }
-  else
+
+  if (fwrite(buf, 1, len, stream) != len)
     {
-      GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
+      free(buf);
+      GSL_ERROR("fwrite failed", GSL_EFAILED);
     }
 
+  free(buf);
+
   return GSL_SUCCESS;
 }
 
+/*
+gsl_spmatrix_fscanf()
+  Read a sparse matrix in MatrixMarket format
+
+Inputs: stream - input stream
+
+Return: pointer to new matrix in triplet format
+
+Notes:
+1) The header may give the field real, integer or pattern, for which
+the elements are 1, and the symmetry general, symmetric or
+skew-symmetric, for which the elements above the diagonal are added
+from those given below it. A file without the header line is read as
+real and general
+
+2) Duplicate entries are summed, as by gsl_spmatrix_fscanf_ccs() and
+gsl_spmatrix_fscanf_crs()
+*/
+
 gsl_spmatrix *
 gsl_spmatrix_fscanf(FILE *stream)
 {
-  gsl_spmatrix *m;
-  unsigned int size1, size2, nz;
-  char buf[1024];
-  int found_header = 0;
+  return spio_read(stream, GSL_SPMATRIX_TRIPLET);
+}
 
-  /* read file until we find rows,cols,nz header */
-  while (fgets(buf, 1024, stream) != NULL)
-    {
-      int c;
+/*
+gsl_spmatrix_fscanf_ccs()
+  Read a sparse matrix in MatrixMarket format into compressed
+column format
 
-      /* skip comments */
-      if (*buf == '%')
-        continue;
+Inputs: stream - input stream
 
-      c = sscanf(buf, "%u %u %u",
-                 &size1, &size2, &nz);
-      if (c == 3)
-        {
-          found_header = 1;
-          break;
-        }
-    }
+Return: pointer to new matrix in CCS format, with sorted row indices
 
-  if (!found_header)
-    {
-      GSL_ERROR_NULL ("fscanf failed reading header", GSL_EFAILED);
-    }
+Notes: the elements are read into a triplet matrix without a binary
+tree and compressed with gsl_spmatrix_compress(), which sums duplicate
+entries
+*/
 
-  m = gsl_spmatrix_alloc_nzmax((size_t) size1, (size_t) size2, (size_t) nz, GSL_SPMATRIX_TRIPLET);
-  if (!m)
-    {
-      GSL_ERROR_NULL ("error allocating m", GSL_ENOMEM);
-    }
+gsl_spmatrix *
+gsl_spmatrix_fscanf_ccs(FILE *stream)
+{
+  return spio_read(stream, GSL_SPMATRIX_CCS);
+}
+
+/*
+gsl_spmatrix_fscanf_crs()
+  Read a sparse matrix in MatrixMarket format into compressed
+row format
 
-  {
-    unsigned int i, j;
-    double val;
-
-    while (fgets(buf, 1024, stream) != NULL)
-      {
-        int c = sscanf(buf, "%u %u %lg", &i, &j, &val);
-        if (c < 3 || (i == 0) || (j == 0))
-          {
-            GSL_ERROR_NULL ("error in input file format", GSL_EFAILED);
-          }
-        else if ((i > size1) || (j > size2))
-          {
-            GSL_ERROR_NULL ("element exceeds matrix dimensions", GSL_EBADLEN);
-          }
-        else
-          {
-            /* subtract 1 from (i,j) since indexing starts at 1 */
-            gsl_spmatrix_set(m, i - 1, j - 1, val);
-          }
-      }
-  }
+Inputs: stream - input stream
 
-  return m;
+Return: pointer to new matrix in CRS format, with sorted column indices
+
+Notes: as for gsl_spmatrix_fscanf_ccs()
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_fscanf_crs(FILE *stream)
+{
+  return spio_read(stream, GSL_SPMATRIX_CRS);
 }
 
+/*
+gsl_spmatrix_fwrite()
+  Write a sparse matrix to a stream in binary format
+
+The header is the word SPIO_MAGIC followed by the storage type, size1,
+size2 and nz, all of type size_t; then follow the arrays i and data of
+length nz, and p, of length nz (triplet), size2 + 1 (CCS) or size1 + 1
+(CRS)
+*/
+
 int
 gsl_spmatrix_fwrite(FILE *stream, const gsl_spmatrix *m)
 {
+  size_t header[5];
   size_t items;
 
-  /* write header: size1, size2, nz */
-
-  items = fwrite(&(m->size1), sizeof(size_t), 1, stream);
-  if (items != 1)
-    {
-      GSL_ERROR("fwrite failed on size1", GSL_EFAILED);
-    }
+  /* write header: magic, sptype, size1, size2, nz */
 
-  items = fwrite(&(m->size2), sizeof(size_t), 1, stream);
-  if (items != 1)
-    {
-      GSL_ERROR("fwrite failed on size2", GSL_EFAILED);
-    }
+  header[0] = SPIO_MAGIC;
+  header[1] = m->sptype;
+  header[2] = m->size1;
+  header[3] = m->size2;
+  header[4] = m->nz;
 
-  items = fwrite(&(m->nz), sizeof(size_t), 1, stream);
-  if (items != 1)
+  items = fwrite(header, sizeof(size_t), 5, stream);
+  if (items != 5)
     {
-      GSL_ERROR("fwrite failed on nz", GSL_EFAILED);
+      GSL_ERROR("fwrite failed on header", GSL_EFAILED);
     }
 
   /* write m->i and m->data which are size nz in all storage formats */
@@ -279,90 +335,716 @@ gsl_spmatrix_fwrite(FILE *stream, const gsl_spmatrix *m)
   return GSL_SUCCESS;
 }
 
+/*
+gsl_spmatrix_fread()
+  Read a sparse matrix written by gsl_spmatrix_fwrite() into the
+preallocated matrix m
+
+Notes: files written without the storage type by earlier versions
+of the library, which begin with size1, are also accepted
+*/
+
 int
 gsl_spmatrix_fread(FILE *stream, gsl_spmatrix *m)
 {
-  size_t size1, size2, nz;
+  size_t header[5];
   size_t items;
 
-  /* read header: size1, size2, nz */
+  /* read header: magic, sptype, size1, size2, nz */
 
-  items = fread(&size1, sizeof(size_t), 1, stream);
-  if (items != 1)
+  items = fread(header, sizeof(size_t), 3, stream);
+  if (items != 3)
     {
-      GSL_ERROR("fread failed on size1", GSL_EFAILED);
+      GSL_ERROR("fread failed on header", GSL_EFAILED);
     }
 
-  items = fread(&size2, sizeof(size_t), 1, stream);
-  if (items != 1)
+  if (header[0] == SPIO_MAGIC)
     {
-      GSL_ERROR("fread failed on size2", GSL_EFAILED);
-    }
+      items = fread(header + 3, sizeof(size_t), 2, stream);
+      if (items != 2)
+        {
+          GSL_ERROR("fread failed on header", GSL_EFAILED);
+        }
 
-  items = fread(&nz, sizeof(size_t), 1, stream);
-  if (items != 1)
+      if (header[1] != m->sptype)
+        {
+          GSL_ERROR("matrix has wrong storage format", GSL_EINVAL);
+        }
+    }
+  else
     {
-      GSL_ERROR("fread failed on nz", GSL_EFAILED);
+      /* older format: size1, size2, nz */
+      header[4] = header[2];
+      header[3] = header[1];
+      header[2] = header[0];
     }
 
-  if (m->size1 != size1)
+  if (m->size1 != header[2])
     {
       GSL_ERROR("matrix has wrong size1", GSL_EBADLEN);
     }
-  else if (m->size2 != size2)
+  else if (m->size2 != header[3])
     {
       GSL_ERROR("matrix has wrong size2", GSL_EBADLEN);
     }
-  else if (nz > m->nzmax)
+  else if (header[4] > m->nzmax)
     {
       GSL_ERROR("matrix nzmax is too small", GSL_EBADLEN);
     }
-  else
+
+  return spio_fread_data(stream, m, header[4]);
+}
+
+/*
+gsl_spmatrix_fread_alloc()
+  Read a sparse matrix written by gsl_spmatrix_fwrite() into a
+newly allocated matrix of the storage format given in the file
+
+Inputs: stream - input stream
+
+Return: pointer to new matrix
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_fread_alloc(FILE *stream)
+{
+  size_t header[5];
+  size_t items;
+  gsl_spmatrix *m;
+  int status;
+
+  items = fread(header, sizeof(size_t), 5, stream);
+  if (items != 5)
+    {
+      GSL_ERROR_NULL("fread failed on header", GSL_EFAILED);
+    }
+
+  if (header[0] != SPIO_MAGIC)
+    {
+      GSL_ERROR_NULL("file has no storage format header", GSL_EFAILED);
+    }
+  else if (header[1] != GSL_SPMATRIX_TRIPLET &&
+           header[1] != GSL_SPMATRIX_CCS &&
+           header[1] != GSL_SPMATRIX_CRS)
+    {
+      GSL_ERROR_NULL("unknown sparse matrix type", GSL_EFAILED);
+    }
+
+  m = gsl_spmatrix_alloc_nzmax(header[2], header[3], header[4], header[1]);
+  if (!m)
+    return NULL;
+
+  status = spio_fread_data(stream, m, header[4]);
+  if (status)
+    {
+      gsl_spmatrix_free(m);
+      return NULL;
+    }
+
+  return m;
+}
+
+/*
+spio_fread_data()
+  Read the arrays of a matrix written by gsl_spmatrix_fwrite(),
+following the header
+
+Inputs: stream - input stream
+        m      - matrix of the dimensions and storage type in the file,
+                 with nzmax >= nz
+        nz     - number of elements
+*/
+
+static int
+spio_fread_data(FILE *stream, gsl_spmatrix *m, const size_t nz)
+{
+  size_t items;
+
+  /* read m->i and m->data arrays, which are size nz for all formats */
+
+  items = fread(m->i, sizeof(size_t), nz, stream);
+  if (items != nz)
     {
-      /* read m->i and m->data arrays, which are size nz for all formats */
+      GSL_ERROR("fread failed on row indices", GSL_EFAILED);
+    }
+
+  items = fread(m->data, sizeof(double), nz, stream);
+  if (items != nz)
+    {
+      GSL_ERROR("fread failed on data", GSL_EFAILED);
+    }
+
+  m->nz = nz;
 
-      items = fread(m->i, sizeof(size_t), nz, stream);
+  if (GSL_SPMATRIX_ISTRIPLET(m))
+    {
+      items = fread(m->p, sizeof(size_t), nz, stream);
       if (items != nz)
         {
-          GSL_ERROR("fread failed on row indices", GSL_EFAILED);
+          GSL_ERROR("fread failed on column indices", GSL_EFAILED);
         }
 
-      items = fread(m->data, sizeof(double), nz, stream);
-      if (items != nz)
+      /* build binary search tree for m */
+      return gsl_spmatrix_tree_rebuild(m);
+    }
+  else if (GSL_SPMATRIX_ISCCS(m))
+    {
+      items = fread(m->p, sizeof(size_t), m->size2 + 1, stream);
+      if (items != m->size2 + 1)
         {
-          GSL_ERROR("fread failed on data", GSL_EFAILED);
+          GSL_ERROR("fread failed on row pointers", GSL_EFAILED);
         }
+    }
+  else if (GSL_SPMATRIX_ISCRS(m))
+    {
+      items = fread(m->p, sizeof(size_t), m->size1 + 1, stream);
+      if (items != m->size1 + 1)
+        {
+          GSL_ERROR("fread failed on column pointers", GSL_EFAILED);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
 
-      m->nz = nz;
+/*
+spio_read()
+  Read a MatrixMarket file into a new matrix
 
-      if (GSL_SPMATRIX_ISTRIPLET(m))
+Inputs: stream - input stream
+        sptype - storage format of the result
+
+Return: pointer to new matrix
+*/
+
+static gsl_spmatrix *
+spio_read(FILE *stream, const size_t sptype)
+{
+  size_t size1, size2, nz, nzmax;
+  int pattern, symmetry;
+  gsl_spmatrix *T, *m;
+  int status;
+
+  status = spio_read_header(stream, &size1, &size2, &nz, &pattern,
+                            &symmetry);
+  if (status)
+    return NULL;
+
+  /* the elements of a symmetric file are stored twice */
+  nzmax = (symmetry == SPIO_GENERAL) ? nz : 2 * nz;
+
+  if (sptype == GSL_SPMATRIX_TRIPLET)
+    T = gsl_spmatrix_alloc_nzmax(size1, size2, nzmax, GSL_SPMATRIX_TRIPLET);
+  else
+    T = gsl_spmatrix_alloc_nzmax(size1, size2, nzmax,
+                                 GSL_SPMATRIX_TRIPLET | GSL_SPMATRIX_NOTREE);
+
+  if (!T)
+    {
+      GSL_ERROR_NULL ("error allocating m", GSL_ENOMEM);
+    }
+
+  status = spio_read_entries(stream, T, nz, pattern, symmetry);
+  if (status)
+    {
+      gsl_spmatrix_free(T);
+      return NULL;
+    }
+
+  if (sptype == GSL_SPMATRIX_TRIPLET)
+    {
+      /* sort the elements read, summing any duplicates as the
+       * compression below does, and build the binary tree */
+      status = gsl_spmatrix_assemble(T, NULL, NULL, NULL, 0,
+                                     GSL_SPMATRIX_SUM);
+      if (status)
+        {
+          gsl_spmatrix_free(T);
+          return NULL;
+        }
+
+      return T;
+    }
+
+  m = gsl_spmatrix_alloc_nzmax(size1, size2, T->nz, sptype);
+  if (!m)
+    {
+      gsl_spmatrix_free(T);
+      GSL_ERROR_NULL ("error allocating m", GSL_ENOMEM);
+    }
+
+  if (sptype == GSL_SPMATRIX_CCS)
+    status = gsl_spmatrix_compress(m, NULL, T);
+  else
+    status = gsl_spmatrix_compress(NULL, m, T);
+
+  gsl_spmatrix_free(T);
+
+  if (status)
+    {
+      gsl_spmatrix_free(m);
+      return NULL;
+    }
+
+  return m;
+}
+
+/*
+spio_read_header()
+  Read the header line, comments and size line of a MatrixMarket file
+
+Inputs: stream   - input stream
+        size1    - (output) number of rows
+        size2    - (output) number of columns
+        nz       - (output) number of entries in the file
+        pattern  - (output) 1 if the file has no values
+        symmetry - (output) SPIO_GENERAL, SPIO_SYMMETRIC or SPIO_SKEW
+*/
+
+static int
+spio_read_header(FILE *stream, size_t *size1, size_t *size2, size_t *nz,
+                 int *pattern, int *symmetry)
+{
+  char buf[1024];
+  int first = 1;
+
+  *pattern = 0;
+  *symmetry = SPIO_GENERAL;
+
+  /* read file until we find rows,cols,nz header */
+  while (fgets(buf, 1024, stream) != NULL)
+    {
+      const char *c = buf;
+
+      if (first && strncmp(buf, "%%MatrixMarket", 14) == 0)
         {
-          items = fread(m->p, sizeof(size_t), nz, stream);
-          if (items != nz)
+          char object[64], format[64], field[64], symm[64];
+          char *s;
+          int n;
+
+          /* the keywords are case-insensitive */
+          for (s = buf + 14; *s != '\0'; ++s)
+            {
+              if (*s >= 'A' && *s <= 'Z')
+                *s += 'a' - 'A';
+            }
+
+          n = sscanf(buf + 14, "%63s %63s %63s %63s",
+                     object, format, field, symm);
+          if (n != 4 || strcmp(object, "matrix") != 0)
+            {
+              GSL_ERROR("invalid MatrixMarket header", GSL_EFAILED);
+            }
+          else if (strcmp(format, "coordinate") != 0)
+            {
+              GSL_ERROR("only coordinate MatrixMarket files are supported",
+                        GSL_EFAILED);
+            }
+
+          if (strcmp(field, "pattern") == 0)
+            *pattern = 1;
+          else if (strcmp(field, "real") != 0 &&
+                   strcmp(field, "integer") != 0)
+            {
+              GSL_ERROR("MatrixMarket field must be real, integer or pattern",
+                        GSL_EFAILED);
+            }
+
+          if (strcmp(symm, "symmetric") == 0)
+            *symmetry = SPIO_SYMMETRIC;
+          else if (strcmp(symm, "skew-symmetric") == 0)
+            *symmetry = SPIO_SKEW;
+          else if (strcmp(symm, "general") != 0)
             {
-              GSL_ERROR("fread failed on column indices", GSL_EFAILED);
+              GSL_ERROR("MatrixMarket symmetry must be general, symmetric or skew-symmetric",
+                        GSL_EFAILED);
             }
 
-          /* build binary search tree for m */
-          gsl_spmatrix_tree_rebuild(m);
+          first = 0;
+          continue;
         }
-      else if (GSL_SPMATRIX_ISCCS(m))
+
+      first = 0;
+
+      /* skip comments */
+      if (*buf == '%')
+        continue;
+
+      if (spio_parse_index(&c, size1) &&
+          spio_parse_index(&c, size2) &&
+          spio_parse_index(&c, nz))
         {
-          items = fread(m->p, sizeof(size_t), size2 + 1, stream);
-          if (items != size2 + 1)
+          if ((*symmetry != SPIO_GENERAL) && (*size1 != *size2))
             {
-              GSL_ERROR("fread failed on row pointers", GSL_EFAILED);
+              GSL_ERROR("symmetric matrix must be square", GSL_EFAILED);
             }
+
+          return GSL_SUCCESS;
+        }
+    }
+
+  GSL_ERROR ("fscanf failed reading header", GSL_EFAILED);
+}
+
+/*
+spio_read_entries()
+  Read the entries of a MatrixMarket file in chunks, and append them
+to the arrays of the triplet matrix m, without using its tree
+
+Inputs: stream   - input stream, positioned after the size line
+        m        - triplet matrix, with nzmax large enough for the
+                   entries and their mirror images
+        nz       - number of entries in the file
+        pattern  - 1 if the file has no values
+        symmetry - SPIO_GENERAL, SPIO_SYMMETRIC or SPIO_SKEW
+*/
+
+static int
+spio_read_entries(FILE *stream, gsl_spmatrix *m, const size_t nz,
+                  const int pattern, const int symmetry)
+{
+  size_t cap = SPIO_CHUNK;
+  size_t len = 0;  /* bytes in buf */
+  size_t nread = 0; /* entries read */
+  char *buf = malloc(cap + 1);
+  int status = GSL_SUCCESS;
+
+  if (!buf)
+    {
+      GSL_ERROR("failed to allocate space for input buffer", GSL_ENOMEM);
+    }
+
+  m->nz = 0;
+
+  while (status == GSL_SUCCESS)
+    {
+      size_t nbytes = fread(buf + len, 1, cap - len, stream);
+      const int eof = (nbytes < cap - len);
+      size_t end;
+
+      len += nbytes;
+
+      if (eof && ferror(stream))
+        {
+          free(buf);
+          GSL_ERROR("fread failed", GSL_EFAILED);
         }
-      else if (GSL_SPMATRIX_ISCRS(m))
+
+      /* the chunk ends after the last complete line */
+      end = len;
+      if (!eof)
         {
-          items = fread(m->p, sizeof(size_t), size1 + 1, stream);
-          if (items != size1 + 1)
+          while (end > 0 && buf[end - 1] != '\n')
+            --end;
+
+          if (end == 0)
             {
-              GSL_ERROR("fread failed on column pointers", GSL_EFAILED);
+              /* a line longer than the buffer */
+              char *ptr = realloc(buf, 2 * cap + 1);
+              if (!ptr)
+                {
+                  free(buf);
+                  GSL_ERROR("failed to allocate space for input buffer",
+                            GSL_ENOMEM);
+                }
+
+              buf = ptr;
+              cap *= 2;
+              continue;
             }
         }
+
+      buf[len] = '\0';
+      status = spio_parse(buf, buf + end, m, pattern, symmetry, &nread, nz);
+
+      /* keep the incomplete line for the next chunk */
+      memmove(buf, buf + end, len - end);
+      len -= end;
+
+      if (eof)
+        break;
+    }
+
+  free(buf);
+
+  if (status)
+    return status;
+  else if (nread < nz)
+    {
+      GSL_ERROR("file has fewer entries than given in header", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+spio_parse()
+  Parse the complete lines [c, end) of a MatrixMarket file
+
+Inputs: c        - start of the lines
+        end      - end of the lines; *end is a newline or '\0'
+        m        - triplet matrix, elements are appended to its arrays
+        pattern  - 1 if the file has no values
+        symmetry - SPIO_GENERAL, SPIO_SYMMETRIC or SPIO_SKEW
+        nread    - (input/output) number of entries read
+        nz       - number of entries in the file
+*/
+
+static int
+spio_parse(const char *c, const char *end, gsl_spmatrix *m,
+           const int pattern, const int symmetry, size_t *nread,
+           const size_t nz)
+{
+  size_t *mi = m->i;
+  size_t *mj = m->p;
+  double *md = m->data;
+  size_t k = m->nz;
+
+  while (c < end)
+    {
+      size_t i, j;
+      double x = 1.0;
+
+      while (*c == ' ' || *c == '\t' || *c == '\r')
+        ++c;
+
+      if (*c == '%')
+        {
+          /* comment line */
+          while (c < end && *c != '\n')
+            ++c;
+        }
+
+      if (c >= end || *c == '\n')
+        {
+          /* blank line */
+          ++c;
+          continue;
+        }
+
+      if (!spio_parse_index(&c, &i) || !spio_parse_index(&c, &j) ||
+          (!pattern && !spio_parse_double(&c, &x)) ||
+          (i == 0) || (j == 0))
+        {
+          m->nz = k;
+          GSL_ERROR ("error in input file format", GSL_EFAILED);
+        }
+      else if ((i > m->size1) || (j > m->size2))
+        {
+          m->nz = k;
+          GSL_ERROR ("element exceeds matrix dimensions", GSL_EBADLEN);
+        }
+      else if (*nread >= nz)
+        {
+          m->nz = k;
+          GSL_ERROR ("file has more entries than given in header",
+                     GSL_EFAILED);
+        }
+
+      /* subtract 1 from (i,j) since indexing starts at 1 */
+      mi[k] = i - 1;
+      mj[k] = j - 1;
+      md[k] = x;
+      ++k;
+
+      if (symmetry != SPIO_GENERAL && i != j)
+        {
+          mi[k] = j - 1;
+          mj[k] = i - 1;
+          md[k] = (symmetry == SPIO_SKEW) ? -x : x;
+          ++k;
+        }
+
+      ++(*nread);
+
+      /* skip the rest of the line */
+      while (c < end && *c != '\n')
+        ++c;
     }
 
+  m->nz = k;
+
   return GSL_SUCCESS;
 }
+
+/* true if c ends a number */
+#define SPIO_DELIM(c) ((c) == ' ' || (c) == '\t' || (c) == '\n' || \
+                       (c) == '\r' || (c) == '\0')
+
+/*
+spio_parse_index()
+  Parse an unsigned decimal integer after optional blanks
+
+Inputs: s - (input/output) position in the string, advanced past
+            the integer on success
+        x - (output) integer
+
+Return: 1 on success, 0 if there is no integer
+*/
+
+static int
+spio_parse_index(const char **s, size_t *x)
+{
+  const char *c = *s;
+  size_t v = 0;
+
+  while (*c == ' ' || *c == '\t')
+    ++c;
+
+  if (*c < '0' || *c > '9')
+    return 0;
+
+  while (*c >= '0' && *c <= '9')
+    {
+      const size_t d = (size_t) (*c - '0');
+
+      if (v > (((size_t) -1) - d) / 10)
+        return 0; /* overflow */
+
+      v = 10 * v + d;
+      ++c;
+    }
+
+  if (!SPIO_DELIM(*c))
+    return 0;
+
+  *s = c;
+  *x = v;
+
+  return 1;
+}
+
+/*
+spio_parse_double()
+  Parse a floating point number after optional blanks
+
+Inputs: s - (input/output) position in the string, advanced past
+            the number on success
+        x - (output) number
+
+Return: 1 on success, 0 if there is no number
+
+Notes: a decimal number with at most 15 significant digits and a
+decimal exponent e with |e| <= 22 is m * 10^e, where the integer m
+and 10^|e| are exact doubles, so one multiplication or division gives
+the correctly rounded result (Clinger, 1990). Other numbers, including
+inf and nan, are converted by strtod()
+*/
+
+static int
+spio_parse_double(const char **s, double *x)
+{
+  static const double pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  const char *c = *s;
+  const char *start;
+  double m = 0.0;
+  int neg = 0, ndigits = 0, nsig = 0, exact = 1, frac = 0;
+  long e = 0;
+
+  while (*c == ' ' || *c == '\t')
+    ++c;
+
+  start = c;
+
+  if (*c == '-' || *c == '+')
+    neg = (*c++ == '-');
+
+  for (;; ++c)
+    {
+      if (*c >= '0' && *c <= '9')
+        {
+          ++ndigits;
+
+          if (nsig < 15)
+            {
+              m = 10.0 * m + (*c - '0');
+              if (m != 0.0)
+                ++nsig;
+              if (frac)
+                --e;
+            }
+          else
+            {
+              /* more significant digits than an exact m can hold */
+              exact = 0;
+              if (!frac)
+                ++e;
+            }
+        }
+      else if (*c == '.' && !frac)
+        frac = 1;
+      else
+        break;
+    }
+
+  if (ndigits > 0 && (*c == 'e' || *c == 'E'))
+    {
+      int eneg = 0;
+      long ex = 0;
+
+      ++c;
+      if (*c == '-' || *c == '+')
+        eneg = (*c++ == '-');
+
+      if (*c < '0' || *c > '9')
+        exact = 0;
+
+      while (*c >= '0' && *c <= '9')
+        {
+          if (ex < 100000)
+            ex = 10 * ex + (*c - '0');
+          ++c;
+        }
+
+      e += eneg ? -ex : ex;
+    }
+
+  if (ndigits > 0 && exact && e >= -22 && e <= 22 && SPIO_DELIM(*c))
+    {
+      m = (e < 0) ? m / pow10[-e] : m * pow10[e];
+      *x = neg ? -m : m;
+    }
+  else
+    {
+      char *cend;
+
+      *x = strtod(start, &cend);
+      if (cend == start || !SPIO_DELIM(*cend))
+        return 0;
+
+      c = cend;
+    }
+
+  *s = c;
+
+  return 1;
+}
+
+/*
+spio_utoa()
+  Write the decimal digits of x to s, without a terminating '\0'
+
+Return: number of characters written
+*/
+
+static size_t
+spio_utoa(char *s, size_t x)
+{
+  char tmp[32];
+  size_t n = 0, k;
+
+  do
+    {
+      tmp[n++] = (char) ('0' + x % 10);
+      x /= 10;
+    }
+  while (x > 0);
+
+  for (k = 0; k < n; ++k)
+    s[k] = tmp[n - 1 - k];
+
+  return n;
+}
@@ -28,6 +28,8 @@
 #include "avl.c"
 
 static int compare_triplet(const void *pa, const void *pb, void *param);
+static struct avl_node *tree_build(gsl_spmatrix *m, const size_t lo,
+                                   const size_t hi, int *height);
 static void *avl_spmalloc (size_t size, void *param);
 static void avl_spfree (void *block, void *param);
 
@@ -67,10 +69,16 @@ gsl_spmatrix_alloc_nzmax()
 Inputs: n1     - number of rows
         n2     - number of columns
         nzmax  - maximum number of matrix elements
-        sptype - type of matrix (triplet, CCS, CRS)
+        sptype - type of matrix (triplet, CCS, CRS), for triplet
+                 optionally with the flag GSL_SPMATRIX_NOTREE
 
-Notes: if (n1,n2) are not known at allocation time, they can each be
+Notes:
+1) if (n1,n2) are not known at allocation time, they can each be
 set to 1, and they will be expanded as elements are added to the matrix
+
+2) a triplet matrix allocated with GSL_SPMATRIX_NOTREE has no binary
+tree, so elements are appended without searching for duplicates,
+which are summed when the matrix is compressed
 */
 
 gsl_spmatrix *
@@ -101,7 +109,7 @@ gsl_spmatrix_alloc_nzmax(const size_t n1, const size_t n2,
   m->size2 = n2;
   m->nz = 0;
   m->nzmax = GSL_MAX(nzmax, 1);
-  m->sptype = sptype;
+  m->sptype = sptype & ~GSL_SPMATRIX_NOTREE;
 
   m->i = malloc(m->nzmax * sizeof(size_t));
   if (!m->i)
@@ -111,7 +119,17 @@ gsl_spmatrix_alloc_nzmax(const size_t n1, const size_t n2,
                      GSL_ENOMEM);
     }
 
-  if (sptype == GSL_SPMATRIX_TRIPLET)
+  if (sptype == (GSL_SPMATRIX_TRIPLET | GSL_SPMATRIX_NOTREE))
+    {
+      m->p = malloc(m->nzmax * sizeof(size_t));
+      if (!m->p)
+        {
+          gsl_spmatrix_free(m);
+          GSL_ERROR_NULL("failed to allocate space for column indices",
+                         GSL_ENOMEM);
+        }
+    }
+  else if (sptype == GSL_SPMATRIX_TRIPLET)
     {
       m->tree_data = malloc(sizeof(gsl_spmatrix_tree));
       if (!m->tree_data)
@@ -265,11 +283,12 @@ gsl_spmatrix_realloc(const size_t nzmax, gsl_spmatrix *m)
 
   m->data = (double *) ptr;
 
+  /* update to new nzmax */
+  m->nzmax = nzmax;
+
   /* rebuild binary tree */
-  if (GSL_SPMATRIX_ISTRIPLET(m))
+  if (GSL_SPMATRIX_ISTRIPLET(m) && m->tree_data)
     {
-      size_t n;
-
       /* reset tree to empty state, but don't free root tree ptr */
       avl_empty(m->tree_data->tree, NULL);
       m->tree_data->n = 0;
@@ -286,19 +305,9 @@ gsl_spmatrix_realloc(const size_t nzmax, gsl_spmatrix *m)
        * need to reinsert all tree elements since the m->data addresses
        * have changed
        */
-      for (n = 0; n < m->nz; ++n)
-        {
-          ptr = avl_insert(m->tree_data->tree, &m->data[n]);
-          if (ptr != NULL)
-            {
-              GSL_ERROR("detected duplicate entry", GSL_EINVAL);
-            }
-        }
+      s = gsl_spmatrix_tree_rebuild(m);
     }
 
-  /* update to new nzmax */
-  m->nzmax = nzmax;
-
   return s;
 } /* gsl_spmatrix_realloc() */
 
@@ -307,7 +316,7 @@ gsl_spmatrix_set_zero(gsl_spmatrix *m)
 {
   m->nz = 0;
 
-  if (GSL_SPMATRIX_ISTRIPLET(m))
+  if (GSL_SPMATRIX_ISTRIPLET(m) && m->tree_data)
     {
       /* reset tree to empty state and node index pointer to 0 */
       avl_empty(m->tree_data->tree, NULL);
@@ -375,6 +384,14 @@ copying a triplet matrix, it is necessary to rebuild the
 binary tree for element searches.
 
 Inputs: m - triplet matrix
+
+Notes:
+1) if the elements are sorted by row and column, as after
+gsl_spmatrix_assemble(), the balanced tree is built directly
+in O(nz) time instead of by nz insertions
+
+2) a matrix allocated with GSL_SPMATRIX_NOTREE has no tree
+to rebuild
 */
 
 int
@@ -384,6 +401,10 @@ gsl_spmatrix_tree_rebuild(gsl_spmatrix * m)
     {
       GSL_ERROR("m must be in triplet format", GSL_EINVAL);
     }
+  else if (m->tree_data == NULL)
+    {
+      return GSL_SUCCESS;
+    }
   else
     {
       size_t n;
@@ -392,6 +413,26 @@ gsl_spmatrix_tree_rebuild(gsl_spmatrix * m)
       avl_empty(m->tree_data->tree, NULL);
       m->tree_data->n = 0;
 
+      for (n = 1; n < m->nz; ++n)
+        {
+          if (gsl_spmatrix_compare_idx(m->i[n - 1], m->p[n - 1],
+                                       m->i[n], m->p[n]) >= 0)
+            break;
+        }
+
+      if (n >= m->nz)
+        {
+          /* elements are sorted and distinct */
+          struct avl_table *tree = (struct avl_table *) m->tree_data->tree;
+          int height;
+
+          tree->avl_root = tree_build(m, 0, m->nz, &height);
+          tree->avl_count = m->nz;
+          m->tree_data->n = m->nz;
+
+          return GSL_SUCCESS;
+        }
+
       /* insert all tree elements */
       for (n = 0; n < m->nz; ++n)
         {
@@ -406,6 +447,49 @@ gsl_spmatrix_tree_rebuild(gsl_spmatrix * m)
     }
 }
 
+/*
+tree_build()
+  Build a balanced AVL tree from the sorted elements
+[lo, hi) of a triplet matrix, using the node slots with
+the same indices
+
+Inputs: m      - triplet matrix
+        lo     - first element
+        hi     - one past the last element
+        height - (output) height of the tree
+
+Return: root of the tree
+*/
+
+static struct avl_node *
+tree_build(gsl_spmatrix *m, const size_t lo, const size_t hi, int *height)
+{
+  if (lo >= hi)
+    {
+      *height = 0;
+      return NULL;
+    }
+  else
+    {
+      struct avl_node *nodes = (struct avl_node *) m->tree_data->node_array;
+      const size_t mid = lo + (hi - lo) / 2;
+      struct avl_node *node = &nodes[mid];
+      int hleft, hright;
+
+      node->avl_data = &m->data[mid];
+      node->avl_link[0] = tree_build(m, lo, mid, &hleft);
+      node->avl_link[1] = tree_build(m, mid + 1, hi, &hright);
+
+      /* the halves differ in size by at most one element, so their
+       * heights differ by at most one */
+      node->avl_balance = (signed char) (hright - hleft);
+
+      *height = 1 + GSL_MAX(hleft, hright);
+
+      return node;
+    }
+} /* tree_build() */
+
 /*
 compare_triplet()
   Comparison function for searching binary tree in triplet
@@ -221,7 +221,8 @@ gsl_spmatrix_sp2d(gsl_matrix *A, const gsl_spmatrix *S)
               size_t j = S->p[n];
               double x = S->data[n];
 
-              gsl_matrix_set(A, i, j, x);
+              /* without a binary tree, S may contain duplicates */
+              *gsl_matrix_ptr(A, i, j) += x;
             }
         }
       else
@@ -766,6 +766,485 @@ test_io_binary(const size_t M, const size_t N,
   gsl_spmatrix_free(A_crs);
 }
 
+/* test MatrixMarket headers, compressed readers and exact parsing */
+static void
+test_io_mm(const size_t M, const size_t N,
+           const double density, const gsl_rng *r)
+{
+  int status;
+  gsl_spmatrix *A = create_random_sparse(M, N, density, r);
+  char filename[] = "test.dat";
+  size_t k;
+
+  /* values of all magnitudes round trip exactly with %.17g */
+  for (k = 0; k < A->nz; ++k)
+    A->data[k] = (gsl_rng_uniform(r) - 0.5) * pow(10.0, 60.0 * gsl_rng_uniform(r) - 30.0);
+
+  gsl_spmatrix_tree_rebuild(A);
+
+  {
+    FILE *f = fopen(filename, "w");
+
+    gsl_spmatrix_fprintf(f, A, "%.17g");
+
+    fclose(f);
+  }
+
+  {
+    FILE *f = fopen(filename, "r");
+    gsl_spmatrix *B = gsl_spmatrix_fscanf(f);
+
+    status = gsl_spmatrix_equal(A, B) != 1;
+    gsl_test(status, "test_io_mm: %%.17g M=%zu N=%zu triplet format", M, N);
+
+    fclose(f);
+    gsl_spmatrix_free(B);
+  }
+
+  {
+    FILE *f = fopen(filename, "r");
+    gsl_spmatrix *A_ccs = gsl_spmatrix_alloc_nzmax(M, N, A->nz, GSL_SPMATRIX_CCS);
+    gsl_spmatrix *B = gsl_spmatrix_fscanf_ccs(f);
+
+    /* the compressed readers sort the indices */
+    gsl_spmatrix_compress(A_ccs, NULL, A);
+
+    status = gsl_spmatrix_equal(A_ccs, B) != 1;
+    gsl_test(status, "test_io_mm: fscanf_ccs M=%zu N=%zu", M, N);
+
+    fclose(f);
+    gsl_spmatrix_free(A_ccs);
+    gsl_spmatrix_free(B);
+  }
+
+  {
+    FILE *f = fopen(filename, "r");
+    gsl_spmatrix *A_crs = gsl_spmatrix_alloc_nzmax(M, N, A->nz, GSL_SPMATRIX_CRS);
+    gsl_spmatrix *B = gsl_spmatrix_fscanf_crs(f);
+
+    gsl_spmatrix_compress(NULL, A_crs, A);
+
+    status = gsl_spmatrix_equal(A_crs, B) != 1;
+    gsl_test(status, "test_io_mm: fscanf_crs M=%zu N=%zu", M, N);
+
+    fclose(f);
+    gsl_spmatrix_free(A_crs);
+    gsl_spmatrix_free(B);
+  }
+
+  /* the fast path of the parser must round as strtod() does */
+  {
+    FILE *f = fopen(filename, "w");
+    char buf[64];
+
+    fprintf(f, "%%%%MatrixMarket matrix coordinate real general\n");
+    fprintf(f, "%zu %zu %zu\n", M, N, A->nz);
+
+    for (k = 0; k < A->nz; ++k)
+      {
+        const char *fmt[] = { "%.6e", "%.15g", "%.3f", "%g" };
+
+        sprintf(buf, fmt[k % 4], A->data[k]);
+        A->data[k] = strtod(buf, NULL);
+        fprintf(f, "  %zu\t%zu   %s \n", A->i[k] + 1, A->p[k] + 1, buf);
+      }
+
+    fclose(f);
+  }
+
+  {
+    FILE *f = fopen(filename, "r");
+    gsl_spmatrix *B = gsl_spmatrix_fscanf(f);
+
+    status = gsl_spmatrix_equal(A, B) != 1;
+    gsl_test(status, "test_io_mm: strtod rounding M=%zu N=%zu", M, N);
+
+    fclose(f);
+    gsl_spmatrix_free(B);
+  }
+
+  /* symmetric, skew-symmetric and pattern files of the lower triangle */
+  {
+    const char *symm[] = { "symmetric", "skew-symmetric", "symmetric" };
+    const char *field[] = { "real", "real", "pattern" };
+    const size_t n = GSL_MIN(M, N);
+    int t;
+
+    for (t = 0; t < 3; ++t)
+      {
+        gsl_spmatrix *L = gsl_spmatrix_alloc_nzmax(n, n, A->nz, GSL_SPMATRIX_TRIPLET);
+        gsl_spmatrix *S = gsl_spmatrix_alloc_nzmax(n, n, 2 * A->nz, GSL_SPMATRIX_TRIPLET);
+        gsl_spmatrix *B, *B_ccs;
+        FILE *f;
+
+        for (k = 0; k < A->nz; ++k)
+          {
+            size_t i = A->i[k], j = A->p[k];
+            double x = (t == 2) ? 1.0 : A->data[k];
+
+            if (i >= n || j >= n || j > i || (t == 1 && i == j))
+              continue;
+
+            gsl_spmatrix_set(L, i, j, x);
+            gsl_spmatrix_set(S, i, j, x);
+            gsl_spmatrix_set(S, j, i, (t == 1) ? -x : x);
+          }
+
+        f = fopen(filename, "w");
+        fprintf(f, "%%%%MatrixMarket Matrix Coordinate %s %s\n", field[t], symm[t]);
+        fprintf(f, "%% comment\n%zu %zu %zu\n", n, n, L->nz);
+
+        for (k = 0; k < L->nz; ++k)
+          {
+            if (t == 2)
+              fprintf(f, "%zu %zu\n", L->i[k] + 1, L->p[k] + 1);
+            else
+              fprintf(f, "%zu %zu %.17g\n", L->i[k] + 1, L->p[k] + 1, L->data[k]);
+          }
+
+        fclose(f);
+
+        f = fopen(filename, "r");
+        B = gsl_spmatrix_fscanf(f);
+        fclose(f);
+
+        status = gsl_spmatrix_equal(S, B) != 1;
+        gsl_test(status, "test_io_mm: %s %s n=%zu", field[t], symm[t], n);
+
+        f = fopen(filename, "r");
+        B_ccs = gsl_spmatrix_fscanf_ccs(f);
+        fclose(f);
+
+        gsl_spmatrix_free(B);
+        B = gsl_spmatrix_alloc_nzmax(n, n, S->nz, GSL_SPMATRIX_CCS);
+        gsl_spmatrix_compress(B, NULL, S);
+
+        status = gsl_spmatrix_equal(B, B_ccs) != 1;
+        gsl_test(status, "test_io_mm: %s %s n=%zu CCS", field[t], symm[t], n);
+
+        gsl_spmatrix_free(L);
+        gsl_spmatrix_free(S);
+        gsl_spmatrix_free(B);
+        gsl_spmatrix_free(B_ccs);
+      }
+  }
+
+  /* all three readers sum duplicate entries */
+  {
+    gsl_spmatrix *B, *B_ccs, *B_crs;
+    FILE *f = fopen(filename, "w");
+
+    fprintf(f, "%%%%MatrixMarket matrix coordinate real general\n");
+    fprintf(f, "3 2 5\n1 1 1.5\n3 2 2\n1 1 -0.25\n2 1 4\n3 2 0.5\n");
+    fclose(f);
+
+    f = fopen(filename, "r");
+    B = gsl_spmatrix_fscanf(f);
+    fclose(f);
+
+    f = fopen(filename, "r");
+    B_ccs = gsl_spmatrix_fscanf_ccs(f);
+    fclose(f);
+
+    f = fopen(filename, "r");
+    B_crs = gsl_spmatrix_fscanf_crs(f);
+    fclose(f);
+
+    status = B->nz != 3 || gsl_spmatrix_get(B, 0, 0) != 1.25 ||
+             gsl_spmatrix_get(B, 1, 0) != 4.0 || gsl_spmatrix_get(B, 2, 1) != 2.5;
+    gsl_test(status, "test_io_mm: fscanf sums duplicates");
+
+    status = B_ccs->nz != 3 || gsl_spmatrix_get(B_ccs, 0, 0) != 1.25 ||
+             gsl_spmatrix_get(B_ccs, 2, 1) != 2.5;
+    gsl_test(status, "test_io_mm: fscanf_ccs sums duplicates");
+
+    status = B_crs->nz != 3 || gsl_spmatrix_get(B_crs, 0, 0) != 1.25 ||
+             gsl_spmatrix_get(B_crs, 2, 1) != 2.5;
+    gsl_test(status, "test_io_mm: fscanf_crs sums duplicates");
+
+    gsl_spmatrix_free(B);
+    gsl_spmatrix_free(B_ccs);
+    gsl_spmatrix_free(B_crs);
+  }
+
+  /* gsl_spmatrix_fread_alloc() restores the storage format */
+  {
+    gsl_spmatrix *A_crs = gsl_spmatrix_crs(A);
+    FILE *f = fopen(filename, "wb");
+    gsl_spmatrix *B;
+
+    gsl_spmatrix_fwrite(f, A_crs);
+    fclose(f);
+
+    f = fopen(filename, "rb");
+    B = gsl_spmatrix_fread_alloc(f);
+    fclose(f);
+
+    status = !GSL_SPMATRIX_ISCRS(B) || gsl_spmatrix_equal(A_crs, B) != 1;
+    gsl_test(status, "test_io_mm: fread_alloc M=%zu N=%zu CRS format", M, N);
+
+    gsl_spmatrix_free(A_crs);
+    gsl_spmatrix_free(B);
+  }
+
+  /* files without the storage format header are still read */
+  {
+    gsl_spmatrix *A_ccs = gsl_spmatrix_ccs(A);
+    gsl_spmatrix *B = gsl_spmatrix_alloc_nzmax(M, N, A->nz, GSL_SPMATRIX_CCS);
+    FILE *f = fopen(filename, "wb");
+
+    fwrite(&(A_ccs->size1), sizeof(size_t), 1, f);
+    fwrite(&(A_ccs->size2), sizeof(size_t), 1, f);
+    fwrite(&(A_ccs->nz), sizeof(size_t), 1, f);
+    fwrite(A_ccs->i, sizeof(size_t), A_ccs->nz, f);
+    fwrite(A_ccs->data, sizeof(double), A_ccs->nz, f);
+    fwrite(A_ccs->p, sizeof(size_t), N + 1, f);
+    fclose(f);
+
+    f = fopen(filename, "rb");
+    status = gsl_spmatrix_fread(f, B);
+    fclose(f);
+
+    status = status || gsl_spmatrix_equal(A_ccs, B) != 1;
+    gsl_test(status, "test_io_mm: fread older format M=%zu N=%zu", M, N);
+
+    gsl_spmatrix_free(A_ccs);
+    gsl_spmatrix_free(B);
+  }
+
+  unlink(filename);
+
+  gsl_spmatrix_free(A);
+}
+
+/* test gsl_spmatrix_assemble and matrices without a binary tree */
+static void
+test_assemble(const size_t M, const size_t N,
+              const double density, const gsl_rng *r)
+{
+  const size_t n = (size_t) floor(2.0 * M * N * density) + 1;
+  size_t *rows = malloc(n * sizeof(size_t));
+  size_t *cols = malloc(n * sizeof(size_t));
+  double *vals = malloc(n * sizeof(double));
+  gsl_matrix *Dsum = gsl_matrix_calloc(M, N);
+  gsl_matrix *Drep = gsl_matrix_calloc(M, N);
+  gsl_matrix *D = gsl_matrix_alloc(M, N);
+  gsl_spmatrix *A = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_TRIPLET);
+  gsl_spmatrix *B = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_TRIPLET);
+  gsl_spmatrix *C = gsl_spmatrix_alloc_nzmax(1, 1, 1,
+                                             GSL_SPMATRIX_TRIPLET |
+                                             GSL_SPMATRIX_NOTREE);
+  gsl_spmatrix *R = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_TRIPLET);
+  gsl_spmatrix *C_ccs, *C_crs;
+  size_t i, j, k;
+  int status;
+
+  /* random triplets with integer values, many of them duplicates;
+   * the last one has the largest indices so C has full size */
+  for (k = 0; k < n; ++k)
+    {
+      rows[k] = (k == n - 1) ? M - 1 : (size_t) (gsl_rng_uniform(r) * M);
+      cols[k] = (k == n - 1) ? N - 1 : (size_t) (gsl_rng_uniform(r) * N);
+      vals[k] = (double) (int) (gsl_rng_uniform(r) * 9.0 + 1.0);
+
+      *gsl_matrix_ptr(Dsum, rows[k], cols[k]) += vals[k];
+      gsl_matrix_set(Drep, rows[k], cols[k], vals[k]);
+
+      /* reference with one tree insertion per element */
+      gsl_spmatrix_set(R, rows[k], cols[k], vals[k]);
+    }
+
+  /* add in two batches, to merge with existing elements */
+  gsl_spmatrix_assemble(A, rows, cols, vals, n / 2, GSL_SPMATRIX_SUM);
+  gsl_spmatrix_assemble(A, rows + n / 2, cols + n / 2, vals + n / 2,
+                        n - n / 2, GSL_SPMATRIX_SUM);
+
+  gsl_spmatrix_assemble(B, rows, cols, vals, n / 2, GSL_SPMATRIX_REPLACE);
+  gsl_spmatrix_assemble(B, rows + n / 2, cols + n / 2, vals + n / 2,
+                        n - n / 2, GSL_SPMATRIX_REPLACE);
+
+  gsl_spmatrix_assemble(C, rows, cols, vals, n / 2, GSL_SPMATRIX_SUM);
+  for (k = n / 2; k < n; ++k)
+    gsl_spmatrix_set(C, rows[k], cols[k], vals[k]);
+
+  status = 0;
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          if (gsl_spmatrix_get(A, i, j) != gsl_matrix_get(Dsum, i, j))
+            status = 1;
+        }
+    }
+
+  gsl_test(status, "test_assemble: M=%zu N=%zu sum", M, N);
+
+  status = gsl_spmatrix_equal(B, R) != 1;
+  gsl_test(status, "test_assemble: M=%zu N=%zu replace", M, N);
+
+  /* the tree is usable after assembly */
+  gsl_spmatrix_set(A, 0, 0, 1.5);
+  gsl_spmatrix_set(B, M - 1, N - 1, 2.5);
+  status = gsl_spmatrix_get(A, 0, 0) != 1.5 ||
+           gsl_spmatrix_get(B, M - 1, N - 1) != 2.5;
+  gsl_test(status, "test_assemble: M=%zu N=%zu set after assemble", M, N);
+
+  /* duplicates without a tree are summed by compression */
+  C_ccs = gsl_spmatrix_ccs(C);
+  C_crs = gsl_spmatrix_crs(C);
+
+  status = C->size1 != M || C->size2 != N;
+  gsl_test(status, "test_assemble: M=%zu N=%zu notree size", M, N);
+
+  status = 0;
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          double dij = gsl_matrix_get(Dsum, i, j);
+
+          if (gsl_spmatrix_get(C_ccs, i, j) != dij ||
+              gsl_spmatrix_get(C_crs, i, j) != dij)
+            status = 1;
+        }
+    }
+
+  gsl_test(status, "test_assemble: M=%zu N=%zu notree compressed", M, N);
+
+  status = C_ccs->nz != R->nz || C_crs->nz != R->nz;
+  gsl_test(status, "test_assemble: M=%zu N=%zu notree nnz", M, N);
+
+  gsl_spmatrix_sp2d(D, C);
+  gsl_matrix_sub(D, Dsum);
+  status = !gsl_matrix_isnull(D);
+  gsl_test(status, "test_assemble: M=%zu N=%zu notree sp2d", M, N);
+
+  /* replace mode without a tree merges immediately */
+  gsl_spmatrix_set_zero(C);
+  gsl_spmatrix_assemble(C, rows, cols, vals, n, GSL_SPMATRIX_REPLACE);
+  gsl_spmatrix_sp2d(D, C);
+  gsl_matrix_sub(D, Drep);
+  status = !gsl_matrix_isnull(D) || C->nz != R->nz;
+  gsl_test(status, "test_assemble: M=%zu N=%zu notree replace", M, N);
+
+  free(rows);
+  free(cols);
+  free(vals);
+  gsl_matrix_free(Dsum);
+  gsl_matrix_free(Drep);
+  gsl_matrix_free(D);
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(B);
+  gsl_spmatrix_free(C);
+  gsl_spmatrix_free(R);
+  gsl_spmatrix_free(C_ccs);
+  gsl_spmatrix_free(C_crs);
+}
+
+/* test gsl_spmatrix_compress */
+static void
+test_compress(const size_t M, const size_t N,
+              const double density, const gsl_rng *r)
+{
+  const size_t n = (size_t) floor(2.0 * M * N * density) + 1;
+  gsl_spmatrix *T = create_random_sparse(M, N, density, r);
+  gsl_spmatrix *T2 = gsl_spmatrix_alloc_nzmax(M, N, n,
+                                              GSL_SPMATRIX_TRIPLET |
+                                              GSL_SPMATRIX_NOTREE);
+  gsl_spmatrix *A_ccs = gsl_spmatrix_ccs(T);
+  gsl_spmatrix *A_crs = gsl_spmatrix_crs(T);
+  gsl_spmatrix *B_ccs = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_CCS);
+  gsl_spmatrix *B_crs = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_CRS);
+  gsl_spmatrix *C_ccs = gsl_spmatrix_alloc_nzmax(M, N, 1, GSL_SPMATRIX_CCS);
+  gsl_matrix *D = gsl_matrix_calloc(M, N);
+  gsl_matrix *E = gsl_matrix_alloc(M, N);
+  size_t i, j, k;
+  int status;
+
+  /* compress a matrix with a tree */
+  gsl_spmatrix_compress(B_ccs, B_crs, T);
+
+  status = B_ccs->nz != T->nz || B_crs->nz != T->nz;
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          double aij = gsl_spmatrix_get(A_ccs, i, j);
+
+          if (gsl_spmatrix_get(B_ccs, i, j) != aij ||
+              gsl_spmatrix_get(B_crs, i, j) != aij ||
+              gsl_spmatrix_get(A_crs, i, j) != aij)
+            status = 1;
+        }
+    }
+
+  gsl_test(status, "test_compress: M=%zu N=%zu values", M, N);
+
+  /* indices must be strictly increasing within each column and row */
+  status = 0;
+  for (j = 0; j < N; ++j)
+    {
+      for (k = B_ccs->p[j] + 1; k < B_ccs->p[j + 1]; ++k)
+        {
+          if (B_ccs->i[k] <= B_ccs->i[k - 1])
+            status = 1;
+        }
+    }
+
+  for (i = 0; i < M; ++i)
+    {
+      for (k = B_crs->p[i] + 1; k < B_crs->p[i + 1]; ++k)
+        {
+          if (B_crs->i[k] <= B_crs->i[k - 1])
+            status = 1;
+        }
+    }
+
+  gsl_test(status, "test_compress: M=%zu N=%zu sorted indices", M, N);
+
+  /* duplicates in a matrix without a tree, compressed to CCS only */
+  for (k = 0; k < n; ++k)
+    {
+      i = (size_t) (gsl_rng_uniform(r) * M);
+      j = (size_t) (gsl_rng_uniform(r) * N);
+      gsl_spmatrix_set(T2, i, j, (double) k);
+      *gsl_matrix_ptr(D, i, j) += (double) k;
+    }
+
+  gsl_spmatrix_compress(C_ccs, NULL, T2);
+
+  status = 0;
+  for (j = 0; j < N; ++j)
+    {
+      for (k = C_ccs->p[j]; k < C_ccs->p[j + 1]; ++k)
+        {
+          if (k > C_ccs->p[j] && C_ccs->i[k] <= C_ccs->i[k - 1])
+            status = 1;
+        }
+    }
+
+  gsl_matrix_set_zero(E);
+  for (j = 0; j < N; ++j)
+    {
+      for (k = C_ccs->p[j]; k < C_ccs->p[j + 1]; ++k)
+        gsl_matrix_set(E, C_ccs->i[k], j, C_ccs->data[k]);
+    }
+
+  gsl_matrix_sub(E, D);
+  status |= !gsl_matrix_isnull(E);
+  gsl_test(status, "test_compress: M=%zu N=%zu notree duplicates", M, N);
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(T2);
+  gsl_spmatrix_free(A_ccs);
+  gsl_spmatrix_free(A_crs);
+  gsl_spmatrix_free(B_ccs);
+  gsl_spmatrix_free(B_crs);
+  gsl_spmatrix_free(C_ccs);
+  gsl_matrix_free(D);
+  gsl_matrix_free(E);
+}
+
 int
 main()
 {
@@ -801,6 +1280,21 @@ main()
   test_io_binary(10, 25, 0.2, r);
   test_io_binary(101, 253, 0.3, r);
 
+  test_io_mm(30, 30, 0.3, r);
+  test_io_mm(25, 10, 0.2, r);
+  test_io_mm(10, 25, 0.2, r);
+  test_io_mm(300, 400, 0.05, r);
+
+  test_assemble(20, 20, 0.3, r);
+  test_assemble(35, 12, 0.2, r);
+  test_assemble(7, 93, 0.5, r);
+  test_assemble(200, 150, 0.1, r);
+
+  test_compress(20, 20, 0.3, r);
+  test_compress(45, 12, 0.2, r);
+  test_compress(9, 83, 0.5, r);
+  test_compress(150, 200, 0.1, r);
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
@@ -154,6 +154,7 @@ int gsl_vector_mul (gsl_vector * a, const gsl_vector * b);
 int gsl_vector_div (gsl_vector * a, const gsl_vector * b);
 int gsl_vector_scale (gsl_vector * a, const double x);
 int gsl_vector_add_constant (gsl_vector * a, const double x);
+int gsl_vector_axpby (const double alpha, const gsl_vector * x, const double beta, gsl_vector * y);
 
 int gsl_vector_equal (const gsl_vector * u, 
                             const gsl_vector * v);
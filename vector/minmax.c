@@ -3,6 +3,10 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
 
+/* number of independent partial results carried by the unit-stride
+   loops, enough to fill a 256-bit vector register with floats */
+#define NLANES 8
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "minmax_source.c"
@@ -17,6 +17,72 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* Unit-stride kernel for max, min and minmax.  NLANES independent
+   partial extrema are carried through the loop so that the compiler can
+   map it onto vector min/max instructions.  NaNs never compare less or
+   greater, so here they are only detected, through the sum of x - x
+   which is nonzero only for NaN or Inf.  In that case the return value
+   is nonzero and the caller falls back to the scalar loop, which
+   locates the first NaN (if any). */
+
+static inline int
+FUNCTION(vector,minmax_unit) (const BASE * data, const size_t N,
+                              BASE * min_out, BASE * max_out)
+{
+  BASE min[NLANES], max[NLANES];
+#ifdef FP
+  BASE check[NLANES];
+#endif
+  int found = 0;
+  size_t i, k;
+
+  for (k = 0; k < NLANES; k++)
+    {
+      min[k] = data[0];
+      max[k] = data[0];
+#ifdef FP
+      check[k] = 0;
+#endif
+    }
+
+  for (i = 0; i + NLANES <= N; i += NLANES)
+    {
+      for (k = 0; k < NLANES; k++)
+        {
+          BASE x = data[i + k];
+          min[k] = (x < min[k]) ? x : min[k];
+          max[k] = (x > max[k]) ? x : max[k];
+#ifdef FP
+          check[k] += x - x;
+#endif
+        }
+    }
+
+  for (; i < N; i++)
+    {
+      BASE x = data[i];
+      min[0] = (x < min[0]) ? x : min[0];
+      max[0] = (x > max[0]) ? x : max[0];
+#ifdef FP
+      check[0] += x - x;
+#endif
+    }
+
+  for (k = 0; k < NLANES; k++)
+    {
+      min[0] = (min[k] < min[0]) ? min[k] : min[0];
+      max[0] = (max[k] > max[0]) ? max[k] : max[0];
+#ifdef FP
+      found |= (check[k] != 0);
+#endif
+    }
+
+  *min_out = min[0];
+  *max_out = max[0];
+
+  return found;
+}
+
 BASE 
 FUNCTION(gsl_vector,max) (const TYPE(gsl_vector) * v)
 {
@@ -28,6 +94,14 @@ FUNCTION(gsl_vector,max) (const TYPE(gsl_vector) * v)
   BASE max = v->data[0 * stride];
   size_t i;
 
+  if (stride == 1)
+    {
+      BASE min;
+
+      if (!FUNCTION(vector,minmax_unit) (v->data, N, &min, &max))
+        return max;
+    }
+
   for (i = 0; i < N; i++)
     {
       BASE x = v->data[i*stride];
@@ -53,6 +127,14 @@ FUNCTION(gsl_vector,min) (const TYPE(gsl_vector) * v)
   BASE min = v->data[0 * stride];
   size_t i;
 
+  if (stride == 1)
+    {
+      BASE max;
+
+      if (!FUNCTION(vector,minmax_unit) (v->data, N, &min, &max))
+        return min;
+    }
+
   for (i = 0; i < N; i++)
     {
       BASE x = v->data[i*stride];
@@ -82,6 +164,16 @@ FUNCTION(gsl_vector,minmax) (const TYPE(gsl_vector) * v,
 
   size_t i;
 
+  if (stride == 1)
+    {
+      if (!FUNCTION(vector,minmax_unit) (v->data, N, &min, &max))
+        {
+          *min_out = min;
+          *max_out = max;
+          return;
+        }
+    }
+
   for (i = 0; i < N; i++)
     {
       BASE x = v->data[i*stride];
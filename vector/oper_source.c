@@ -33,9 +33,22 @@ FUNCTION(gsl_vector, add) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * a_data = a->data;
+          const ATOMIC * b_data = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              a_data[i] += b_data[i];
+            }
+        }
+      else
         {
-          a->data[i * stride_a] += b->data[i * stride_b];
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] += b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -58,9 +71,22 @@ FUNCTION(gsl_vector, sub) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * a_data = a->data;
+          const ATOMIC * b_data = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              a_data[i] -= b_data[i];
+            }
+        }
+      else
         {
-          a->data[i * stride_a] -= b->data[i * stride_b];
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] -= b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -83,9 +109,22 @@ FUNCTION(gsl_vector, mul) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
         {
-          a->data[i * stride_a] *= b->data[i * stride_b];
+          ATOMIC * a_data = a->data;
+          const ATOMIC * b_data = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              a_data[i] *= b_data[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] *= b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -108,9 +147,22 @@ FUNCTION(gsl_vector, div) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * a_data = a->data;
+          const ATOMIC * b_data = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              a_data[i] /= b_data[i];
+            }
+        }
+      else
         {
-          a->data[i * stride_a] /= b->data[i * stride_b];
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] /= b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -125,9 +177,21 @@ FUNCTION(gsl_vector, scale) (TYPE(gsl_vector) * a, const double x)
   
   size_t i;
   
-  for (i = 0; i < N; i++)
+  if (stride == 1)
+    {
+      ATOMIC * data = a->data;
+
+      for (i = 0; i < N; i++)
+        {
+          data[i] *= x;
+        }
+    }
+  else
     {
-      a->data[i * stride] *= x;
+      for (i = 0; i < N; i++)
+        {
+          a->data[i * stride] *= x;
+        }
     }
   
   return GSL_SUCCESS;
@@ -141,11 +205,74 @@ FUNCTION(gsl_vector, add_constant) (TYPE(gsl_vector) * a, const double x)
   
   size_t i;
   
-  for (i = 0; i < N; i++)
+  if (stride == 1)
+    {
+      ATOMIC * data = a->data;
+
+      for (i = 0; i < N; i++)
+        {
+          data[i] += x;
+        }
+    }
+  else
     {
-      a->data[i * stride] += x;
+      for (i = 0; i < N; i++)
+        {
+          a->data[i * stride] += x;
+        }
     }
   
   return GSL_SUCCESS;
 }
 
+int
+FUNCTION(gsl_vector, axpby) (const BASE alpha, const TYPE(gsl_vector) * x,
+                             const BASE beta, TYPE(gsl_vector) * y)
+{
+  /* computes y = alpha x + beta y in a single pass */
+
+  const size_t N = x->size;
+
+  if (y->size != N)
+    {
+      GSL_ERROR ("vectors must have same length", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t stride_x = x->stride;
+      const size_t stride_y = y->stride;
+
+      size_t i;
+
+      if (beta == (BASE) 0)
+        {
+          /* y is not read, so that Inf or NaN in its previous contents
+             does not propagate into the result */
+
+          for (i = 0; i < N; i++)
+            {
+              y->data[i * stride_y] = alpha * x->data[i * stride_x];
+            }
+        }
+      else if (stride_x == 1 && stride_y == 1)
+        {
+          const ATOMIC * x_data = x->data;
+          ATOMIC * y_data = y->data;
+
+          for (i = 0; i < N; i++)
+            {
+              y_data[i] = alpha * x_data[i] + beta * y_data[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            {
+              y->data[i * stride_y] = alpha * x->data[i * stride_x] 
+                + beta * y->data[i * stride_y];
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
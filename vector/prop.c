@@ -2,6 +2,10 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_errno.h>
 
+/* number of independent partial results carried by the unit-stride
+   loops, enough to fill a 256-bit vector register with floats */
+#define NLANES 8
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "prop_source.c"
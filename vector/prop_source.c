@@ -58,6 +58,41 @@ FUNCTION (gsl_vector, isnull) (const TYPE (gsl_vector) * v)
   
   size_t j;
 
+  if (stride == 1)
+    {
+      /* contiguous storage: test blocks of NLANES elements without
+         branching inside the block */
+
+      const ATOMIC * data = v->data;
+      const size_t nm = MULTIPLICITY * n;
+
+      for (j = 0; j + NLANES <= nm; j += NLANES)
+        {
+          int fail = 0;
+          size_t k;
+
+          for (k = 0; k < NLANES; k++)
+            {
+              fail |= (data[j + k] != 0.0);
+            }
+
+          if (fail)
+            {
+              return 0;
+            }
+        }
+
+      for (; j < nm; j++)
+        {
+          if (data[j] != 0.0)
+            {
+              return 0;
+            }
+        }
+
+      return 1;
+    }
+
   for (j = 0; j < n; j++)
     {
       size_t k;
@@ -82,6 +117,41 @@ FUNCTION (gsl_vector, ispos) (const TYPE (gsl_vector) * v)
   
   size_t j;
 
+  if (stride == 1)
+    {
+      /* contiguous storage: test blocks of NLANES elements without
+         branching inside the block */
+
+      const ATOMIC * data = v->data;
+      const size_t nm = MULTIPLICITY * n;
+
+      for (j = 0; j + NLANES <= nm; j += NLANES)
+        {
+          int fail = 0;
+          size_t k;
+
+          for (k = 0; k < NLANES; k++)
+            {
+              fail |= (data[j + k] <= 0.0);
+            }
+
+          if (fail)
+            {
+              return 0;
+            }
+        }
+
+      for (; j < nm; j++)
+        {
+          if (data[j] <= 0.0)
+            {
+              return 0;
+            }
+        }
+
+      return 1;
+    }
+
   for (j = 0; j < n; j++)
     {
       size_t k;
@@ -106,6 +176,41 @@ FUNCTION (gsl_vector, isneg) (const TYPE (gsl_vector) * v)
   
   size_t j;
 
+  if (stride == 1)
+    {
+      /* contiguous storage: test blocks of NLANES elements without
+         branching inside the block */
+
+      const ATOMIC * data = v->data;
+      const size_t nm = MULTIPLICITY * n;
+
+      for (j = 0; j + NLANES <= nm; j += NLANES)
+        {
+          int fail = 0;
+          size_t k;
+
+          for (k = 0; k < NLANES; k++)
+            {
+              fail |= (data[j + k] >= 0.0);
+            }
+
+          if (fail)
+            {
+              return 0;
+            }
+        }
+
+      for (; j < nm; j++)
+        {
+          if (data[j] >= 0.0)
+            {
+              return 0;
+            }
+        }
+
+      return 1;
+    }
+
   for (j = 0; j < n; j++)
     {
       size_t k;
@@ -130,6 +235,41 @@ FUNCTION (gsl_vector, isnonneg) (const TYPE (gsl_vector) * v)
   
   size_t j;
 
+  if (stride == 1)
+    {
+      /* contiguous storage: test blocks of NLANES elements without
+         branching inside the block */
+
+      const ATOMIC * data = v->data;
+      const size_t nm = MULTIPLICITY * n;
+
+      for (j = 0; j + NLANES <= nm; j += NLANES)
+        {
+          int fail = 0;
+          size_t k;
+
+          for (k = 0; k < NLANES; k++)
+            {
+              fail |= (data[j + k] < 0.0);
+            }
+
+          if (fail)
+            {
+              return 0;
+            }
+        }
+
+      for (; j < nm; j++)
+        {
+          if (data[j] < 0.0)
+            {
+              return 0;
+            }
+        }
+
+      return 1;
+    }
+
   for (j = 0; j < n; j++)
     {
       size_t k;
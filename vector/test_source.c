@@ -704,6 +704,43 @@ FUNCTION (test, ops) (size_t stride1, size_t stride2, size_t N)
     TEST2 (status, "_div division");
   }
 
+  FUNCTION(gsl_vector, memcpy) (v, a);
+  FUNCTION(gsl_vector, axpby) ((BASE) 2, b, (BASE) 3, v);
+
+  {
+    int status = 0;
+    
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE x = FUNCTION(gsl_vector,get) (b,i);
+        BASE y = FUNCTION(gsl_vector,get) (a,i);
+        BASE z = (BASE)((BASE) 2 * x + (BASE) 3 * y);
+        if (r != z)
+          status = 1;
+      }
+
+    TEST2 (status, "_axpby");
+  }
+
+  FUNCTION(gsl_vector, memcpy) (v, a);
+  FUNCTION(gsl_vector, axpby) ((BASE) 2, b, (BASE) 0, v);
+
+  {
+    int status = 0;
+    
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE x = FUNCTION(gsl_vector,get) (b,i);
+        BASE z = (BASE)((BASE) 2 * x);
+        if (r != z)
+          status = 1;
+      }
+
+    TEST2 (status, "_axpby with beta = 0");
+  }
+
   FUNCTION(gsl_vector, free) (a);
   FUNCTION(gsl_vector, free) (b);
   FUNCTION(gsl_vector, free) (v);